@@ -69,6 +69,15 @@ hg_test_usage(const char *execname)
     printf("    -m, --memory        Use shared-memory with local targets\n");
     printf("    -t, --threads       Number of server threads\n");
     printf("    -B, --bidirectional Bidirectional communication\n");
+    printf("    -T, --trigger_batch Trigger callbacks in batches of N\n");
+    printf("    -W, --workers       Number of engine trigger workers\n");
+    printf("    -Y, --spin          Busy-poll N us before blocking\n");
+    printf("    -A, --spin_adaptive Self-tune busy-poll window\n");
+    printf("    -K, --bulk_chunk    Max size of bulk NA operations\n");
+    printf("    -J, --bulk_reg_cache Size of bulk registration cache\n");
+    printf("    -F, --bulk_copy     Number of bulk copy threads\n");
+    printf("    -E, --bulk_eager    Max size of eager bulk data\n");
+    printf("    -Q, --bulk_checksum Checksum bulk data\n");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -111,6 +120,40 @@ hg_test_parse_options(int argc, char *argv[], struct hg_test_info *hg_test_info)
             case 'B': /* bidirectional */
                 hg_test_info->bidirectional = HG_TRUE;
                 break;
+            case 'T': /* trigger batch */
+                hg_test_info->trigger_batch =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'W': /* trigger workers */
+                hg_test_info->trigger_workers =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'Y': /* busy-poll window */
+                hg_test_info->spin_time =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'A': /* adaptive busy-poll window */
+                hg_test_info->spin_adaptive = HG_TRUE;
+                break;
+            case 'K': /* bulk chunk size */
+                hg_test_info->bulk_chunk_size =
+                    (hg_size_t) strtoull(na_test_opt_arg_g, NULL, 0);
+                break;
+            case 'J': /* bulk registration cache size */
+                hg_test_info->bulk_reg_cache_size =
+                    (hg_size_t) strtoull(na_test_opt_arg_g, NULL, 0);
+                break;
+            case 'F': /* bulk copy threads */
+                hg_test_info->bulk_copy_threads =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'E': /* max size of eager bulk data */
+                hg_test_info->bulk_eager_size_max =
+                    (hg_size_t) strtoull(na_test_opt_arg_g, NULL, 0);
+                break;
+            case 'Q': /* bulk data checksums */
+                hg_test_info->bulk_checksum = HG_TRUE;
+                break;
             default:
                 break;
         }
@@ -237,6 +280,28 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
         /* Multi-recv */
         hg_init_info.no_multi_recv = hg_test_info->na_test_info.no_multi_recv;
 
+        /* Progress engine */
+        hg_init_info.trigger_workers = hg_test_info->trigger_workers;
+
+        /* Busy-polling */
+        hg_init_info.progress_spin_time = hg_test_info->spin_time;
+        hg_init_info.progress_spin_adaptive = hg_test_info->spin_adaptive;
+
+        /* Bulk pipelining */
+        hg_init_info.bulk_chunk_size = hg_test_info->bulk_chunk_size;
+
+        /* Bulk registration cache */
+        hg_init_info.bulk_reg_cache_size = hg_test_info->bulk_reg_cache_size;
+
+        /* Bulk copy helper threads */
+        hg_init_info.bulk_copy_threads = hg_test_info->bulk_copy_threads;
+
+        /* Eager bulk data */
+        hg_init_info.bulk_eager_size_max = hg_test_info->bulk_eager_size_max;
+
+        /* Bulk data checksums */
+        hg_init_info.bulk_checksum = hg_test_info->bulk_checksum;
+
         /* Init HG with init options */
         hg_test_info->hg_classes[i] =
             HG_Init_opt(NULL, hg_test_info->na_test_info.listen, &hg_init_info);
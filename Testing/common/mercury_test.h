@@ -30,11 +30,20 @@ struct hg_test_info {
     drc_info_handle_t credential_info;
     uint32_t cookie;
 #endif
-    unsigned int handle_max;   /* Max number of handles in-flight */
-    unsigned int thread_count; /* Max number of threads */
+    unsigned int handle_max;        /* Max number of handles in-flight */
+    unsigned int thread_count;      /* Max number of threads */
+    unsigned int trigger_batch;     /* Max callbacks per trigger batch */
+    unsigned int trigger_workers;   /* Number of engine trigger workers */
+    unsigned int spin_time;         /* Progress busy-poll window (us) */
+    unsigned int bulk_copy_threads; /* Number of bulk copy threads */
+    hg_size_t bulk_chunk_size;      /* Max size of bulk NA operations */
+    hg_size_t bulk_reg_cache_size;  /* Size of bulk registration cache */
+    hg_size_t bulk_eager_size_max;  /* Max size of eager bulk data */
     hg_bool_t auth;
     hg_bool_t auto_sm;       /* Use shared-memory */
     hg_bool_t bidirectional; /* Bidirectional tests */
+    hg_bool_t spin_adaptive; /* Self-tune busy-poll window */
+    hg_bool_t bulk_checksum; /* Checksum bulk data */
 };
 
 /*****************/
@@ -109,9 +109,11 @@ na_test_usage(const char *execname)
     printf("    -y  --buf_size_min   Min buffer size (in bytes)\n");
     printf("    -z, --buf_size_max   Max buffer size (in bytes)\n");
     printf("    -w  --buf_count      Number of buffers used\n");
+    printf("    -I, --inflight       Sweep in-flight msgs from 1 to N\n");
     printf("    -R, --force-register Force registration of buffers\n");
     printf("    -M, --mbps           Output in MB/s instead of MiB/s\n");
     printf("    -U, --no-multi-recv  Disable multi-recv\n");
+    printf("    -G, --sm_mapped      Use exported SM memory for RMA\n");
     printf("    -V, --verbose        Print verbose output\n");
 }
 
@@ -184,6 +186,9 @@ na_test_parse_options(int argc, char *argv[], struct na_test_info *na_test_info)
             case 'w': /* buffer count */
                 na_test_info->buf_count = (size_t) atol(na_test_opt_arg_g);
                 break;
+            case 'I': /* max in-flight msgs */
+                na_test_info->inflight_max = (size_t) atol(na_test_opt_arg_g);
+                break;
             case 'Z': /* msg size */
                 na_test_info->max_msg_size = (size_t) atol(na_test_opt_arg_g);
                 break;
@@ -202,6 +207,9 @@ na_test_parse_options(int argc, char *argv[], struct na_test_info *na_test_info)
             case 'U': /* no-multi-recv */
                 na_test_info->no_multi_recv = true;
                 break;
+            case 'G': /* sm_mapped */
+                na_test_info->sm_mapped = true;
+                break;
             default:
                 break;
         }
@@ -42,6 +42,7 @@ struct na_test_info {
     size_t buf_size_min;     /* Min buffer size */
     size_t buf_size_max;     /* Max buffer size */
     size_t buf_count;        /* Buffer count */
+    size_t inflight_max;     /* Max number of in-flight msgs (sweep) */
     bool verbose;            /* Verbose mode */
     int max_number_of_peers; /* Max number of peers */
 #ifdef HG_TEST_HAS_PARALLEL
@@ -56,6 +57,7 @@ struct na_test_info {
     bool verify;         /* Verify data */
     bool mbps;           /* OSU-style of output in MB/s */
     bool no_multi_recv;  /* Disable multi-recv */
+    bool sm_mapped;      /* Use exported SM memory for RMA */
 };
 
 /*****************/
@@ -14,7 +14,8 @@
 
 int na_test_opt_ind_g = 1;            /* token pointer */
 const char *na_test_opt_arg_g = NULL; /* flag argument (or value) */
-const char *na_test_short_opt_g = "hc:d:p:H:P:LsSk:l:bC:X:VaZ:y:z:w:x:mt:BRvMU";
+const char *na_test_short_opt_g =
+    "hc:d:p:H:P:LsSk:l:bC:X:VaZ:y:z:w:I:x:mt:BRvMUGT:W:Y:AK:J:F:E:Q";
 /* clang-format off */
 const struct na_test_opt na_test_opt_g[] = {
     {"help", no_arg, 'h'},
@@ -37,6 +38,7 @@ const struct na_test_opt na_test_opt_g[] = {
     {"buf_size_min", require_arg, 'y'},
     {"buf_size_max", require_arg, 'z'},
     {"buf_count", require_arg, 'w'},
+    {"inflight", require_arg, 'I'},
     {"handle", require_arg, 'x'},
     {"memory", no_arg, 'm'},
     {"threads", require_arg, 't'},
@@ -45,6 +47,16 @@ const struct na_test_opt na_test_opt_g[] = {
     {"verify", no_arg, 'v'},
     {"millionbps", no_arg, 'M'},
     {"no-multi-recv", no_arg, 'U'},
+    {"sm_mapped", no_arg, 'G'},
+    {"trigger_batch", require_arg, 'T'},
+    {"workers", require_arg, 'W'},
+    {"spin", require_arg, 'Y'},
+    {"spin_adaptive", no_arg, 'A'},
+    {"bulk_chunk", require_arg, 'K'},
+    {"bulk_reg_cache", require_arg, 'J'},
+    {"bulk_copy", require_arg, 'F'},
+    {"bulk_eager", require_arg, 'E'},
+    {"bulk_checksum", no_arg, 'Q'},
     {NULL, 0, '\0'} /* Must add this at the end */
 };
 /* clang-format on */
@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mercury_test.h"
+
+#include "mercury_bulk.h"
+#include "mercury_time.h"
+
+#include <stdlib.h>
+
+/****************/
+/* Local Macros */
+/****************/
+#define BENCHMARK_NAME "Bulk partial transfer setup"
+
+#define STRING(s)  #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME                                                           \
+    XSTRING(HG_VERSION_MAJOR)                                                  \
+    "." XSTRING(HG_VERSION_MINOR) "." XSTRING(HG_VERSION_PATCH)
+
+#define NDIGITS 2
+#define NWIDTH  27
+
+/* Size of each segment of origin handle */
+#define HG_BULK_TRANSLATE_SEGMENT_SIZE (8)
+
+/* Max number of segments of origin handle */
+#define HG_BULK_TRANSLATE_SEGMENT_MAX (65536)
+
+/* Size of each partial transfer */
+#define HG_BULK_TRANSLATE_TRANSFER_SIZE (64)
+
+/* Number of partial transfers per loop */
+#define HG_BULK_TRANSLATE_COUNT (10000)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct hg_bulk_translate_info {
+    hg_class_t *hg_class;   /* HG class */
+    hg_context_t *context;  /* HG context */
+    hg_addr_t self_addr;    /* Self address */
+    hg_bulk_t local_handle; /* Local handle */
+    size_t transfer_count;  /* Number of transfers per segment count */
+    hg_bool_t completed;    /* Last transfer completed */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static hg_return_t
+hg_bulk_translate_cb(const struct hg_cb_info *callback_info);
+
+static hg_return_t
+hg_bulk_translate_run(
+    struct hg_bulk_translate_info *info, hg_uint32_t segment_count);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_translate_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_bulk_translate_info *info =
+        (struct hg_bulk_translate_info *) callback_info->arg;
+
+    HG_TEST_CHECK_ERROR_NORET(callback_info->ret != HG_SUCCESS, done,
+        "Error in bulk callback (%s)", HG_Error_to_string(callback_info->ret));
+
+done:
+    info->completed = HG_TRUE;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_translate_run(
+    struct hg_bulk_translate_info *info, hg_uint32_t segment_count)
+{
+    hg_size_t total_size =
+        (hg_size_t) segment_count * HG_BULK_TRANSLATE_SEGMENT_SIZE;
+    hg_bulk_t origin_handle = HG_BULK_NULL;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    char *buf = NULL;
+    hg_time_t t1, t2;
+    double transfer_time;
+    hg_return_t ret, cleanup_ret;
+    size_t i;
+
+    /* Many small segments within the same buffer */
+    buf = (char *) calloc(1, total_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, error, ret, HG_NOMEM, "Could not allocate buffer");
+    buf_ptrs = (void **) malloc(segment_count * sizeof(*buf_ptrs));
+    HG_TEST_CHECK_ERROR(buf_ptrs == NULL, error, ret, HG_NOMEM,
+        "Could not allocate buf_ptrs");
+    buf_sizes = (hg_size_t *) malloc(segment_count * sizeof(*buf_sizes));
+    HG_TEST_CHECK_ERROR(buf_sizes == NULL, error, ret, HG_NOMEM,
+        "Could not allocate buf_sizes");
+    for (i = 0; i < segment_count; i++) {
+        buf_ptrs[i] = buf + i * HG_BULK_TRANSLATE_SEGMENT_SIZE;
+        buf_sizes[i] = HG_BULK_TRANSLATE_SEGMENT_SIZE;
+    }
+
+    ret = HG_Bulk_create(info->hg_class, segment_count, buf_ptrs, buf_sizes,
+        HG_BULK_READ_ONLY, &origin_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Partial transfers at increasing offsets */
+    hg_time_get_current(&t1);
+    for (i = 0; i < info->transfer_count; i++) {
+        hg_size_t offset = (hg_size_t) i *
+                           (total_size - HG_BULK_TRANSLATE_TRANSFER_SIZE) /
+                           info->transfer_count;
+
+        info->completed = HG_FALSE;
+        ret = HG_Bulk_transfer(info->context, hg_bulk_translate_cb, info,
+            HG_BULK_PULL, info->self_addr, origin_handle, offset,
+            info->local_handle, 0, HG_BULK_TRANSLATE_TRANSFER_SIZE,
+            HG_OP_ID_IGNORE);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer() failed (%s)",
+            HG_Error_to_string(ret));
+
+        while (!info->completed) {
+            ret = HG_Trigger(info->context, 0, 1, NULL);
+            if (ret == HG_TIMEOUT)
+                ret = HG_Progress(info->context, 0);
+            HG_TEST_CHECK_ERROR(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
+                ret, ret, "Could not make progress (%s)",
+                HG_Error_to_string(ret));
+        }
+    }
+    hg_time_get_current(&t2);
+
+    /* Average time per transfer */
+    transfer_time = hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6 /
+                    (double) info->transfer_count;
+    printf("%-*u%*.*f%*.*f\n", 10, segment_count, NWIDTH, NDIGITS,
+        transfer_time, NWIDTH, NDIGITS, 1e3 / transfer_time);
+    fflush(stdout);
+
+    ret = HG_Bulk_free(origin_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    free(buf_ptrs);
+    free(buf_sizes);
+    free(buf);
+
+    return HG_SUCCESS;
+
+error:
+    cleanup_ret = HG_Bulk_free(origin_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+    free(buf_ptrs);
+    free(buf_sizes);
+    free(buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = {0};
+    struct hg_bulk_translate_info info = {0};
+    char local_buf[HG_BULK_TRANSLATE_TRANSFER_SIZE];
+    void *buf_ptr = local_buf;
+    hg_size_t buf_size = sizeof(local_buf);
+    hg_uint32_t segment_count;
+    hg_return_t hg_ret;
+
+    /* Only local transfers, no target is needed */
+    hg_test_info.na_test_info.self_send = true;
+
+    /* Initialize the interface */
+    hg_ret = HG_Test_init(argc, argv, &hg_test_info);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "HG_Test_init() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    info.hg_class = hg_test_info.hg_class;
+    info.transfer_count =
+        (size_t) hg_test_info.na_test_info.loop * HG_BULK_TRANSLATE_COUNT;
+
+    info.context = HG_Context_create(info.hg_class);
+    HG_TEST_CHECK_ERROR_NORET(
+        info.context == NULL, error, "HG_Context_create() failed");
+
+    hg_ret = HG_Addr_self(info.hg_class, &info.self_addr);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "HG_Addr_self() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
+    hg_ret = HG_Bulk_create(info.hg_class, 1, &buf_ptr, &buf_size,
+        HG_BULK_WRITE_ONLY, &info.local_handle);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "HG_Bulk_create() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
+    /* Header info */
+    printf("# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+    printf("# %zu transfer(s) of %d bytes from segments of %d bytes\n",
+        info.transfer_count, HG_BULK_TRANSLATE_TRANSFER_SIZE,
+        HG_BULK_TRANSLATE_SEGMENT_SIZE);
+    printf("%-*s%*s%*s\n", 10, "# Segments", NWIDTH, "Avg time (us)", NWIDTH,
+        "Rate (Ktransfers/s)");
+    fflush(stdout);
+
+    for (segment_count = 16; segment_count <= HG_BULK_TRANSLATE_SEGMENT_MAX;
+         segment_count *= 4) {
+        hg_ret = hg_bulk_translate_run(&info, segment_count);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+            "hg_bulk_translate_run() failed (%s)", HG_Error_to_string(hg_ret));
+    }
+
+    (void) HG_Bulk_free(info.local_handle);
+    (void) HG_Addr_free(info.hg_class, info.self_addr);
+    (void) HG_Context_destroy(info.context);
+    (void) HG_Test_finalize(&hg_test_info);
+
+    return EXIT_SUCCESS;
+
+error:
+    (void) HG_Bulk_free(info.local_handle);
+    if (info.self_addr != HG_ADDR_NULL)
+        (void) HG_Addr_free(info.hg_class, info.self_addr);
+    if (info.context != NULL)
+        (void) HG_Context_destroy(info.context);
+    (void) HG_Test_finalize(&hg_test_info);
+
+    return EXIT_FAILURE;
+}
@@ -41,7 +41,7 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
     for (i = 0; i < skip + (size_t) hg_test_info->na_test_info.loop; i++) {
         struct hg_perf_request args = {
             .expected_count = (int32_t) info->handle_max,
-            .complete_count = 0,
+            .complete_count = HG_ATOMIC_VAR_INIT(0),
             .request = info->request};
         unsigned int j;
 
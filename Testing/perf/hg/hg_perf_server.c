@@ -53,16 +53,19 @@ hg_perf_loop(struct hg_perf_class_info *info)
 {
     hg_return_t ret;
 
+    if (info->trigger_workers > 0)
+        return hg_perf_wait_done(info);
+
     do {
         unsigned int actual_count = 0;
 
         do {
-            ret = HG_Trigger(info->context, 0, 1, &actual_count);
+            ret = hg_perf_trigger(info, 0, &actual_count);
         } while ((ret == HG_SUCCESS) && actual_count);
         HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
-            "HG_Trigger() failed (%s)", HG_Error_to_string(ret));
+            "hg_perf_trigger() failed (%s)", HG_Error_to_string(ret));
 
-        if (info->done)
+        if (hg_atomic_get32(&info->done))
             break;
 
         ret = HG_Progress(info->context, 1000);
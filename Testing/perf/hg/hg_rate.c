@@ -33,7 +33,8 @@ struct iovec {
 
 static hg_return_t
 hg_perf_run(const struct hg_test_info *hg_test_info,
-    struct hg_perf_class_info *info, size_t buf_size, size_t skip);
+    struct hg_perf_class_info *info, size_t buf_size, size_t handle_count,
+    size_t skip);
 
 /*******************/
 /* Local Variables */
@@ -42,7 +43,8 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_perf_run(const struct hg_test_info *hg_test_info,
-    struct hg_perf_class_info *info, size_t buf_size, size_t skip)
+    struct hg_perf_class_info *info, size_t buf_size, size_t handle_count,
+    size_t skip)
 {
     struct iovec in_struct = {.iov_base = info->rpc_buf, .iov_len = buf_size};
     hg_time_t t1, t2;
@@ -52,8 +54,8 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
     /* Warm up for RPC */
     for (i = 0; i < skip + (size_t) hg_test_info->na_test_info.loop; i++) {
         struct hg_perf_request args = {
-            .expected_count = (int32_t) info->handle_max,
-            .complete_count = 0,
+            .expected_count = (int32_t) handle_count,
+            .complete_count = HG_ATOMIC_VAR_INIT(0),
             .request = info->request};
         unsigned int j;
 
@@ -65,7 +67,7 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
 
         hg_request_reset(info->request);
 
-        for (j = 0; j < info->handle_max; j++) {
+        for (j = 0; j < handle_count; j++) {
             ret = HG_Forward(
                 info->handles[j], hg_perf_request_complete, &args, &in_struct);
             HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Forward() failed (%s)",
@@ -75,7 +77,7 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
         hg_request_wait(info->request, HG_MAX_IDLE_TIME, NULL);
 
         if (info->verify && info->bidir) {
-            for (j = 0; j < info->handle_max; j++) {
+            for (j = 0; j < handle_count; j++) {
                 struct iovec out_iov = {
                     .iov_base = info->rpc_verify_buf, .iov_len = buf_size};
                 memset(out_iov.iov_base, 0, out_iov.iov_len);
@@ -98,9 +100,14 @@ hg_perf_run(const struct hg_test_info *hg_test_info,
 
     hg_time_get_current(&t2);
 
-    if (hg_test_info->na_test_info.mpi_comm_rank == 0)
-        hg_perf_print_lat(
-            hg_test_info, info, buf_size, hg_time_subtract(t2, t1));
+    if (hg_test_info->na_test_info.mpi_comm_rank == 0) {
+        if (hg_test_info->na_test_info.inflight_max > 0)
+            hg_perf_print_inflight(
+                hg_test_info, handle_count, hg_time_subtract(t2, t1));
+        else
+            hg_perf_print_lat(
+                hg_test_info, info, buf_size, hg_time_subtract(t2, t1));
+    }
 
     return HG_SUCCESS;
 
@@ -135,25 +142,45 @@ main(int argc, char *argv[])
     HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_set_handles() failed (%s)",
         HG_Error_to_string(hg_ret));
 
-    /* Header info */
-    if (hg_test_info->na_test_info.mpi_comm_rank == 0)
-        hg_perf_print_header_lat(hg_test_info, info, BENCHMARK_NAME);
-
-    /* NULL RPC */
-    if (info->buf_size_min == 0) {
-        hg_ret = hg_perf_run(hg_test_info, info, 0, HG_PERF_LAT_SKIP_SMALL);
-        HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
-            HG_Error_to_string(hg_ret));
-    }
+    if (hg_test_info->na_test_info.inflight_max > 0) {
+        size_t handle_count;
+
+        /* Header info */
+        if (hg_test_info->na_test_info.mpi_comm_rank == 0)
+            hg_perf_print_header_inflight(
+                hg_test_info, info, BENCHMARK_NAME, info->buf_size_min);
+
+        /* RPC with different numbers of handles in-flight */
+        for (handle_count = 1;
+             handle_count <= hg_test_info->na_test_info.inflight_max;
+             handle_count *= 2) {
+            hg_ret = hg_perf_run(hg_test_info, info, info->buf_size_min,
+                handle_count, HG_PERF_LAT_SKIP_SMALL);
+            HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
+                HG_Error_to_string(hg_ret));
+        }
+    } else {
+        /* Header info */
+        if (hg_test_info->na_test_info.mpi_comm_rank == 0)
+            hg_perf_print_header_lat(hg_test_info, info, BENCHMARK_NAME);
+
+        /* NULL RPC */
+        if (info->buf_size_min == 0) {
+            hg_ret = hg_perf_run(hg_test_info, info, 0, info->handle_max,
+                HG_PERF_LAT_SKIP_SMALL);
+            HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
+                HG_Error_to_string(hg_ret));
+        }
 
-    /* RPC with different sizes */
-    for (size = MAX(1, info->buf_size_min); size <= info->buf_size_max;
-         size *= 2) {
-        hg_ret = hg_perf_run(hg_test_info, info, size,
-            (size > HG_PERF_LARGE_SIZE) ? HG_PERF_LAT_SKIP_LARGE
-                                        : HG_PERF_LAT_SKIP_SMALL);
-        HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
-            HG_Error_to_string(hg_ret));
+        /* RPC with different sizes */
+        for (size = MAX(1, info->buf_size_min); size <= info->buf_size_max;
+             size *= 2) {
+            hg_ret = hg_perf_run(hg_test_info, info, size, info->handle_max,
+                (size > HG_PERF_LARGE_SIZE) ? HG_PERF_LAT_SKIP_LARGE
+                                            : HG_PERF_LAT_SKIP_SMALL);
+            HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
+                HG_Error_to_string(hg_ret));
+        }
     }
 
     /* Finalize interface */
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mercury_test.h"
+
+#include "mercury_atomic.h"
+#include "mercury_thread.h"
+#include "mercury_time.h"
+
+#include <stdlib.h>
+
+/****************/
+/* Local Macros */
+/****************/
+#define BENCHMARK_NAME "RPC ID lookup"
+
+#define STRING(s)  #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME                                                           \
+    XSTRING(HG_VERSION_MAJOR)                                                  \
+    "." XSTRING(HG_VERSION_MINOR) "." XSTRING(HG_VERSION_PATCH)
+
+#define NDIGITS 2
+#define NWIDTH  27
+
+/* Number of registered RPCs */
+#define HG_RPC_LOOKUP_RPC_COUNT (1024)
+
+/* Default max number of threads */
+#define HG_RPC_LOOKUP_THREAD_MAX (64)
+
+/* Number of lookups per thread and per loop */
+#define HG_RPC_LOOKUP_COUNT (100000)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct hg_rpc_lookup_info {
+    hg_class_t *hg_class;     /* HG class */
+    hg_id_t *ids;             /* Registered RPC IDs */
+    hg_atomic_int32_t ready;  /* Number of threads ready */
+    hg_atomic_int32_t errors; /* Number of lookup errors */
+    size_t lookup_count;      /* Number of lookups per thread */
+    unsigned int thread_count;
+};
+
+struct hg_rpc_lookup_thread_info {
+    struct hg_rpc_lookup_info *info; /* Shared info */
+    hg_time_t t;                     /* Time spent in lookups */
+    unsigned int thread_id;          /* Thread index */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static HG_THREAD_RETURN_TYPE
+hg_rpc_lookup_thread(void *arg);
+
+static hg_return_t
+hg_rpc_lookup_run(struct hg_rpc_lookup_info *info, unsigned int thread_count);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_rpc_lookup_thread(void *arg)
+{
+    struct hg_rpc_lookup_thread_info *thread_info =
+        (struct hg_rpc_lookup_thread_info *) arg;
+    struct hg_rpc_lookup_info *info = thread_info->info;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+    unsigned int seed = thread_info->thread_id;
+    hg_time_t t1, t2;
+    size_t i;
+
+    /* Start all threads at once */
+    hg_atomic_incr32(&info->ready);
+    while ((unsigned int) hg_atomic_get32(&info->ready) < info->thread_count)
+        continue;
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < info->lookup_count; i++) {
+        hg_bool_t flag = HG_FALSE;
+        hg_return_t ret;
+
+        /* Simple LCG so that threads do not hit the same entries in sync */
+        seed = seed * 1103515245 + 12345;
+        ret = HG_Registered(info->hg_class,
+            info->ids[(seed >> 16) % HG_RPC_LOOKUP_RPC_COUNT], &flag);
+        if (ret != HG_SUCCESS || !flag) {
+            hg_atomic_incr32(&info->errors);
+            break;
+        }
+    }
+    hg_time_get_current(&t2);
+    thread_info->t = hg_time_subtract(t2, t1);
+
+    hg_thread_exit(tret);
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_rpc_lookup_run(struct hg_rpc_lookup_info *info, unsigned int thread_count)
+{
+    struct hg_rpc_lookup_thread_info *thread_infos = NULL;
+    hg_thread_t *threads = NULL;
+    double t_sum = 0, lookup_time;
+    hg_return_t ret;
+    unsigned int i;
+
+    threads = (hg_thread_t *) malloc(thread_count * sizeof(*threads));
+    HG_TEST_CHECK_ERROR(threads == NULL, error, ret, HG_NOMEM,
+        "Could not allocate threads");
+    thread_infos = (struct hg_rpc_lookup_thread_info *) malloc(
+        thread_count * sizeof(*thread_infos));
+    HG_TEST_CHECK_ERROR(thread_infos == NULL, error, ret, HG_NOMEM,
+        "Could not allocate thread info");
+
+    info->thread_count = thread_count;
+    hg_atomic_set32(&info->ready, 0);
+
+    for (i = 0; i < thread_count; i++) {
+        int rc;
+
+        thread_infos[i] = (struct hg_rpc_lookup_thread_info){
+            .info = info, .t = hg_time_from_ms(0), .thread_id = i + 1};
+        rc = hg_thread_create(
+            &threads[i], hg_rpc_lookup_thread, &thread_infos[i]);
+        HG_TEST_CHECK_ERROR(
+            rc != 0, error, ret, HG_NOMEM, "hg_thread_create() failed");
+    }
+    for (i = 0; i < thread_count; i++) {
+        hg_thread_join(threads[i]);
+        t_sum += hg_time_to_double(thread_infos[i].t);
+    }
+
+    HG_TEST_CHECK_ERROR(hg_atomic_get32(&info->errors) > 0, error, ret,
+        HG_NOENTRY, "Could not lookup registered RPC IDs");
+
+    /* Average time per lookup and aggregate rate */
+    lookup_time = t_sum * 1e9 / (double) (info->lookup_count * thread_count);
+    printf("%-*u%*.*f%*.*f\n", 10, thread_count, NWIDTH, NDIGITS, lookup_time,
+        NWIDTH, NDIGITS, (double) thread_count * 1e3 / lookup_time);
+    fflush(stdout);
+
+    free(threads);
+    free(thread_infos);
+
+    return HG_SUCCESS;
+
+error:
+    free(threads);
+    free(thread_infos);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = {0};
+    struct hg_rpc_lookup_info info = {0};
+    unsigned int thread_count;
+    hg_return_t hg_ret;
+    size_t i;
+
+    /* Only local lookups, no target is needed */
+    hg_test_info.na_test_info.self_send = true;
+    hg_test_info.thread_count = HG_RPC_LOOKUP_THREAD_MAX;
+
+    /* Initialize the interface */
+    hg_ret = HG_Test_init(argc, argv, &hg_test_info);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "HG_Test_init() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    info.hg_class = hg_test_info.hg_class;
+    info.lookup_count =
+        (size_t) hg_test_info.na_test_info.loop * HG_RPC_LOOKUP_COUNT;
+    hg_atomic_init32(&info.errors, 0);
+
+    /* Register RPCs */
+    info.ids = (hg_id_t *) malloc(HG_RPC_LOOKUP_RPC_COUNT * sizeof(hg_id_t));
+    HG_TEST_CHECK_ERROR_NORET(
+        info.ids == NULL, error, "Could not allocate RPC IDs");
+    for (i = 0; i < HG_RPC_LOOKUP_RPC_COUNT; i++) {
+        char rpc_name[64];
+
+        sprintf(rpc_name, "hg_rpc_lookup_%zu", i);
+        info.ids[i] =
+            HG_Register_name(info.hg_class, rpc_name, NULL, NULL, NULL);
+        HG_TEST_CHECK_ERROR_NORET(
+            info.ids[i] == 0, error, "HG_Register_name() failed");
+    }
+
+    /* Header info */
+    printf("# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+    printf("# %zu lookup(s) per thread among %d registered RPC(s)\n",
+        info.lookup_count, HG_RPC_LOOKUP_RPC_COUNT);
+    printf("%-*s%*s%*s\n", 10, "# Threads", NWIDTH, "Avg time (ns)", NWIDTH,
+        "Rate (Mlookups/s)");
+    fflush(stdout);
+
+    for (thread_count = 1; thread_count <= hg_test_info.thread_count;
+         thread_count *= 2) {
+        hg_ret = hg_rpc_lookup_run(&info, thread_count);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+            "hg_rpc_lookup_run() failed (%s)", HG_Error_to_string(hg_ret));
+    }
+
+    free(info.ids);
+    (void) HG_Test_finalize(&hg_test_info);
+
+    return EXIT_SUCCESS;
+
+error:
+    free(info.ids);
+    (void) HG_Test_finalize(&hg_test_info);
+
+    return EXIT_FAILURE;
+}
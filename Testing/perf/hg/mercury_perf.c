@@ -10,6 +10,7 @@
 #include "mercury_mem.h"
 #include "mercury_proc.h"
 #include "mercury_proc_bulk.h"
+#include "mercury_thread.h"
 
 #ifndef _WIN32
 #    include <sys/uio.h>
@@ -66,11 +67,12 @@ static void
 hg_perf_class_cleanup(struct hg_perf_class_info *info);
 
 static hg_return_t
-hg_perf_bulk_buf_alloc(
-    struct hg_perf_class_info *info, uint8_t bulk_flags, bool init_data);
+hg_perf_bulk_buf_alloc(struct hg_perf_class_info *info, uint8_t bulk_flags,
+    bool init_data, void ***bulk_bufs_p, hg_bulk_t **bulk_handles_p);
 
 static void
-hg_perf_bulk_buf_free(struct hg_perf_class_info *info);
+hg_perf_bulk_buf_free(struct hg_perf_class_info *info, void ***bulk_bufs_p,
+    hg_bulk_t **bulk_handles_p);
 
 static void
 hg_perf_init_data(void *buf, size_t buf_size);
@@ -121,6 +123,12 @@ hg_perf_request_progress(unsigned int timeout, void *arg)
 {
     struct hg_perf_class_info *info = (struct hg_perf_class_info *) arg;
 
+    /* Engine makes progress, only give it a chance to run */
+    if (info->trigger_workers > 0) {
+        hg_thread_yield();
+        return HG_UTIL_SUCCESS;
+    }
+
     if (HG_Progress(info->context, timeout) != HG_SUCCESS)
         return HG_UTIL_FAIL;
 
@@ -134,7 +142,14 @@ hg_perf_request_trigger(unsigned int timeout, unsigned int *flag, void *arg)
     struct hg_perf_class_info *info = (struct hg_perf_class_info *) arg;
     unsigned int count = 0;
 
-    if (HG_Trigger(info->context, timeout, 1, &count) != HG_SUCCESS)
+    /* Callbacks are triggered by engine workers */
+    if (info->trigger_workers > 0) {
+        if (flag)
+            *flag = false;
+        return HG_UTIL_SUCCESS;
+    }
+
+    if (hg_perf_trigger(info, timeout, &count) != HG_SUCCESS)
         return HG_UTIL_FAIL;
 
     if (flag)
@@ -203,6 +218,14 @@ hg_perf_class_init(const struct hg_test_info *hg_test_info, int class_id,
     info->hg_class = hg_class;
     info->verify = hg_test_info->na_test_info.verify;
     info->bidir = hg_test_info->bidirectional;
+    info->trigger_batch = hg_test_info->trigger_batch;
+    info->trigger_workers = hg_test_info->trigger_workers;
+    info->spin = hg_test_info->spin_time > 0 || hg_test_info->spin_adaptive;
+    hg_atomic_init32(&info->done, 0);
+
+    /* RPC buffers are shared by callbacks */
+    HG_TEST_CHECK_ERROR(info->verify && info->trigger_workers > 0, error, ret,
+        HG_INVALID_ARG, "Cannot verify data when using trigger workers");
 
     /* Add extra info to handles created */
     ret = HG_Class_set_handle_create_callback(
@@ -293,6 +316,8 @@ hg_perf_class_init(const struct hg_test_info *hg_test_info, int class_id,
         info->handle_max = hg_test_info->handle_max;
         if (info->handle_max == 0)
             info->handle_max = info->target_addr_max;
+        if (info->handle_max < hg_test_info->na_test_info.inflight_max)
+            info->handle_max = hg_test_info->na_test_info.inflight_max;
 
         info->handles = malloc(info->handle_max * sizeof(hg_handle_t));
         HG_TEST_CHECK_ERROR(info->handles == NULL, error, ret, HG_NOMEM,
@@ -338,7 +363,9 @@ hg_perf_class_cleanup(struct hg_perf_class_info *info)
         free(info->remote_bulk_handles);
     }
 
-    hg_perf_bulk_buf_free(info);
+    hg_perf_bulk_buf_free(info, &info->bulk_bufs, &info->local_bulk_handles);
+    hg_perf_bulk_buf_free(
+        info, &info->loopback_bulk_bufs, &info->loopback_bulk_handles);
 
     if (info->rpc_buf != NULL) {
         hg_mem_aligned_free(info->rpc_buf);
@@ -361,85 +388,88 @@ hg_perf_class_cleanup(struct hg_perf_class_info *info)
     if (info->request_class)
         hg_request_finalize(info->request_class, NULL);
 
-    if (info->context)
+    if (info->context) {
+        struct hg_progress_stats stats;
+
+        if (info->spin &&
+            HG_Context_get_progress_stats(info->context, &stats) == HG_SUCCESS)
+            printf("# Class %d: %" PRIu64 " busy-poll hit(s) out of %" PRIu64
+                   ", %" PRIu64 " blocking wait(s), window %" PRIu32 " us\n",
+                info->class_id, stats.spin_hits, stats.spin_count,
+                stats.sleep_count, stats.spin_time);
+
         HG_Context_destroy(info->context);
+    }
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_perf_bulk_buf_alloc(
-    struct hg_perf_class_info *info, uint8_t bulk_flags, bool init_data)
+hg_perf_bulk_buf_alloc(struct hg_perf_class_info *info, uint8_t bulk_flags,
+    bool init_data, void ***bulk_bufs_p, hg_bulk_t **bulk_handles_p)
 {
     size_t page_size = (size_t) hg_mem_get_page_size();
+    void **bulk_bufs = NULL;
+    hg_bulk_t *bulk_handles = NULL;
     hg_return_t ret;
     size_t i;
 
-    info->bulk_bufs = (void **) calloc(info->handle_max, sizeof(void *));
-    HG_TEST_CHECK_ERROR(info->bulk_bufs == NULL, error, ret, HG_NOMEM,
+    bulk_bufs = (void **) calloc(info->handle_max, sizeof(void *));
+    HG_TEST_CHECK_ERROR(bulk_bufs == NULL, error, ret, HG_NOMEM,
         "malloc(%zu) failed", info->handle_max * sizeof(void *));
 
-    info->local_bulk_handles =
-        (hg_bulk_t *) calloc(info->handle_max, sizeof(hg_bulk_t));
-    HG_TEST_CHECK_ERROR(info->local_bulk_handles == NULL, error, ret, HG_NOMEM,
+    bulk_handles = (hg_bulk_t *) calloc(info->handle_max, sizeof(hg_bulk_t));
+    HG_TEST_CHECK_ERROR(bulk_handles == NULL, error, ret, HG_NOMEM,
         "malloc(%zu) failed", info->handle_max * sizeof(hg_bulk_t));
 
     for (i = 0; i < info->handle_max; i++) {
         hg_size_t alloc_size = info->buf_size_max * info->bulk_count;
 
         /* Prepare buf */
-        info->bulk_bufs[i] = hg_mem_aligned_alloc(page_size, alloc_size);
-        HG_TEST_CHECK_ERROR(info->bulk_bufs[i] == NULL, error, ret, HG_NOMEM,
+        bulk_bufs[i] = hg_mem_aligned_alloc(page_size, alloc_size);
+        HG_TEST_CHECK_ERROR(bulk_bufs[i] == NULL, error, ret, HG_NOMEM,
             "hg_mem_aligned_alloc(%zu, %zu) failed", page_size,
             info->buf_size_max);
 
         /* Initialize data */
         if (init_data)
-            hg_perf_init_data(info->bulk_bufs[i], alloc_size);
+            hg_perf_init_data(bulk_bufs[i], alloc_size);
 
-        ret = HG_Bulk_create(info->hg_class, 1, &info->bulk_bufs[i],
-            &alloc_size, bulk_flags, &info->local_bulk_handles[i]);
+        ret = HG_Bulk_create(info->hg_class, 1, &bulk_bufs[i], &alloc_size,
+            bulk_flags, &bulk_handles[i]);
         HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_create() failed (%s)",
             HG_Error_to_string(ret));
     }
 
+    *bulk_bufs_p = bulk_bufs;
+    *bulk_handles_p = bulk_handles;
+
     return HG_SUCCESS;
 
 error:
-    if (info->local_bulk_handles != NULL) {
-        for (i = 0; i < info->handle_max; i++)
-            (void) HG_Bulk_free(info->local_bulk_handles[i]);
-        free(info->local_bulk_handles);
-        info->local_bulk_handles = NULL;
-    }
-
-    if (info->bulk_bufs != NULL) {
-        for (i = 0; i < info->handle_max; i++)
-            hg_mem_aligned_free(info->bulk_bufs[i]);
-        free(info->bulk_bufs);
-        info->bulk_bufs = NULL;
-    }
+    hg_perf_bulk_buf_free(info, &bulk_bufs, &bulk_handles);
 
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static void
-hg_perf_bulk_buf_free(struct hg_perf_class_info *info)
+hg_perf_bulk_buf_free(struct hg_perf_class_info *info, void ***bulk_bufs_p,
+    hg_bulk_t **bulk_handles_p)
 {
     size_t i;
 
-    if (info->local_bulk_handles != NULL) {
+    if (*bulk_handles_p != NULL) {
         for (i = 0; i < info->handle_max; i++)
-            (void) HG_Bulk_free(info->local_bulk_handles[i]);
-        free(info->local_bulk_handles);
-        info->local_bulk_handles = NULL;
+            (void) HG_Bulk_free((*bulk_handles_p)[i]);
+        free(*bulk_handles_p);
+        *bulk_handles_p = NULL;
     }
 
-    if (info->bulk_bufs != NULL) {
+    if (*bulk_bufs_p != NULL) {
         for (i = 0; i < info->handle_max; i++)
-            hg_mem_aligned_free(info->bulk_bufs[i]);
-        free(info->bulk_bufs);
-        info->bulk_bufs = NULL;
+            hg_mem_aligned_free((*bulk_bufs_p)[i]);
+        free(*bulk_bufs_p);
+        *bulk_bufs_p = NULL;
     }
 }
 
@@ -508,7 +538,9 @@ hg_perf_rpc_buf_init(struct hg_perf_class_info *info)
 
     for (i = 0; i < info->target_addr_max; i++) {
         struct hg_perf_request args = {
-            .expected_count = 1, .complete_count = 0, .request = info->request};
+            .expected_count = 1,
+            .complete_count = HG_ATOMIC_VAR_INIT(0),
+            .request = info->request};
         unsigned int completed = 0;
 
         ret = HG_Reset(info->handles[0], info->target_addrs[i],
@@ -561,13 +593,16 @@ hg_perf_bulk_buf_init(const struct hg_test_info *hg_test_info,
     hg_return_t ret;
     size_t i;
 
-    ret = hg_perf_bulk_buf_alloc(info, bulk_flags, bulk_op == HG_BULK_PULL);
+    ret = hg_perf_bulk_buf_alloc(info, bulk_flags, bulk_op == HG_BULK_PULL,
+        &info->bulk_bufs, &info->local_bulk_handles);
     HG_TEST_CHECK_HG_ERROR(error, ret, "hg_perf_bulk_buf_alloc() failed (%s)",
         HG_Error_to_string(ret));
 
     for (i = 0; i < info->handle_max; i++) {
         struct hg_perf_request args = {
-            .expected_count = 1, .complete_count = 0, .request = info->request};
+            .expected_count = 1,
+            .complete_count = HG_ATOMIC_VAR_INIT(0),
+            .request = info->request};
         unsigned int completed = 0;
         struct hg_perf_bulk_init_info bulk_info = {
             .bulk = info->local_bulk_handles[i],
@@ -609,7 +644,7 @@ hg_perf_bulk_buf_init(const struct hg_test_info *hg_test_info,
     return HG_SUCCESS;
 
 error:
-    hg_perf_bulk_buf_free(info);
+    hg_perf_bulk_buf_free(info, &info->bulk_bufs, &info->local_bulk_handles);
 
     return ret;
 }
@@ -661,6 +696,12 @@ hg_perf_print_header_lat(const struct hg_test_info *hg_test_info,
                "targets\n");
     if (info->verify)
         printf("# WARNING verifying data, output will be slower\n");
+    if (info->trigger_batch > 0)
+        printf(
+            "# Triggering callbacks in batches of %u\n", info->trigger_batch);
+    if (info->trigger_workers > 0)
+        printf("# Triggering callbacks from %u engine worker(s)\n",
+            info->trigger_workers);
     printf("%-*s%*s%*s\n", 10, "# Size", NWIDTH, "Avg time (us)", NWIDTH,
         "Avg rate (RPC/s)");
     fflush(stdout);
@@ -684,6 +725,47 @@ hg_perf_print_lat(const struct hg_test_info *hg_test_info,
         (long unsigned int) (1e6 / rpc_time));
 }
 
+/*---------------------------------------------------------------------------*/
+void
+hg_perf_print_header_inflight(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, const char *benchmark,
+    size_t buf_size)
+{
+    printf("# %s v%s\n", benchmark, VERSION_NAME);
+    printf("# Loop %d times with size %zu byte(s) and up to %zu handle(s) "
+           "in-flight\n",
+        hg_test_info->na_test_info.loop, buf_size, info->handle_max);
+    if (info->verify)
+        printf("# WARNING verifying data, output will be slower\n");
+    if (info->trigger_batch > 0)
+        printf(
+            "# Triggering callbacks in batches of %u\n", info->trigger_batch);
+    if (info->trigger_workers > 0)
+        printf("# Triggering callbacks from %u engine worker(s)\n",
+            info->trigger_workers);
+    printf("%-*s%*s%*s\n", 10, "# In-flight", NWIDTH, "Avg time (us)", NWIDTH,
+        "Avg rate (RPC/s)");
+    fflush(stdout);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_perf_print_inflight(const struct hg_test_info *hg_test_info,
+    size_t handle_count, hg_time_t t)
+{
+    double rpc_time;
+    size_t loop = (size_t) hg_test_info->na_test_info.loop,
+           dir = (size_t) (hg_test_info->bidirectional ? 2 : 1),
+           mpi_comm_size = (size_t) hg_test_info->na_test_info.mpi_comm_size;
+
+    /* Time amortized over all RPCs in-flight */
+    rpc_time = hg_time_to_double(t) * 1e6 /
+               (double) (loop * handle_count * dir * mpi_comm_size);
+
+    printf("%-*zu%*.*f%*lu\n", 10, handle_count, NWIDTH, NDIGITS, rpc_time,
+        NWIDTH, (long unsigned int) (1e6 / rpc_time));
+}
+
 /*---------------------------------------------------------------------------*/
 void
 hg_perf_print_header_bw(const struct hg_test_info *hg_test_info,
@@ -694,6 +776,9 @@ hg_perf_print_header_bw(const struct hg_test_info *hg_test_info,
            "in-flight\n# - %zu bulk transfer(s) per handle\n",
         hg_test_info->na_test_info.loop, info->buf_size_min, info->buf_size_max,
         info->handle_max, (size_t) info->bulk_count);
+    if (hg_test_info->na_test_info.self_send)
+        printf("# - loopback transfers to self with %u bulk copy thread(s)\n",
+            hg_test_info->bulk_copy_threads);
     if (info->verify)
         printf("# WARNING verifying data, output will be slower\n");
     if (hg_test_info->na_test_info.mbps)
@@ -737,7 +822,7 @@ hg_perf_request_complete(const struct hg_cb_info *hg_cb_info)
 {
     struct hg_perf_request *info = (struct hg_perf_request *) hg_cb_info->arg;
 
-    if ((++info->complete_count) == info->expected_count)
+    if (hg_atomic_incr32(&info->complete_count) == info->expected_count)
         hg_request_complete(info->request);
 
     return HG_SUCCESS;
@@ -953,7 +1038,7 @@ hg_perf_bulk_init_cb(hg_handle_t handle)
     HG_TEST_CHECK_HG_ERROR(
         error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
 
-    if (info->bulk_bufs == NULL) {
+    if (info->remote_bulk_handles == NULL) {
         hg_uint8_t bulk_flags = (bulk_info.bulk_op == HG_BULK_PULL)
                                     ? HG_BULK_WRITE_ONLY
                                     : HG_BULK_READ_ONLY;
@@ -964,8 +1049,16 @@ hg_perf_bulk_init_cb(hg_handle_t handle)
         info->bulk_count = bulk_info.bulk_count;
         info->buf_size_max = bulk_info.size_max;
 
-        ret = hg_perf_bulk_buf_alloc(
-            info, bulk_flags, bulk_info.bulk_op == HG_BULK_PUSH);
+        /* When transferring to self, origin buffers were already allocated
+         * by this class and target buffers are kept separately */
+        if (info->bulk_bufs != NULL)
+            ret = hg_perf_bulk_buf_alloc(info, bulk_flags,
+                bulk_info.bulk_op == HG_BULK_PUSH, &info->loopback_bulk_bufs,
+                &info->loopback_bulk_handles);
+        else
+            ret = hg_perf_bulk_buf_alloc(info, bulk_flags,
+                bulk_info.bulk_op == HG_BULK_PUSH, &info->bulk_bufs,
+                &info->local_bulk_handles);
         HG_TEST_CHECK_HG_ERROR(error_free, ret,
             "hg_perf_bulk_buf_alloc() failed (%s)", HG_Error_to_string(ret));
 
@@ -1023,6 +1116,9 @@ hg_perf_bulk_common(hg_handle_t handle, hg_bulk_op_t op)
     struct hg_perf_request *request =
         (struct hg_perf_request *) HG_Get_data(handle);
     struct hg_perf_bulk_info bulk_info;
+    hg_bulk_t *local_bulk_handles = (info->loopback_bulk_handles != NULL)
+                                        ? info->loopback_bulk_handles
+                                        : info->local_bulk_handles;
     hg_return_t ret;
     size_t i, bulk_index;
 
@@ -1035,7 +1131,8 @@ hg_perf_bulk_common(hg_handle_t handle, hg_bulk_op_t op)
                  info->handle_per_rank * bulk_info.comm_rank;
 
     /* Initialize request */
-    *request = (struct hg_perf_request){.complete_count = 0,
+    *request = (struct hg_perf_request){
+        .complete_count = HG_ATOMIC_VAR_INIT(0),
         .expected_count = (int32_t) info->bulk_count,
         .request = NULL};
 
@@ -1043,7 +1140,7 @@ hg_perf_bulk_common(hg_handle_t handle, hg_bulk_op_t op)
     for (i = 0; i < info->bulk_count; i++) {
         ret = HG_Bulk_transfer(info->context, hg_perf_bulk_transfer_cb, handle,
             op, hg_info->addr, info->remote_bulk_handles[bulk_index],
-            i * info->buf_size_max, info->local_bulk_handles[bulk_index],
+            i * info->buf_size_max, local_bulk_handles[bulk_index],
             i * info->buf_size_max, bulk_info.size, HG_OP_ID_IGNORE);
         HG_TEST_CHECK_HG_ERROR(error_free, ret,
             "HG_Bulk_transfer() failed (%s)", HG_Error_to_string(ret));
@@ -1075,7 +1172,8 @@ hg_perf_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
         HG_Error_to_string(hg_cb_info->ret));
 
 done:
-    if ((++request->complete_count) == request->expected_count) {
+    if (hg_atomic_incr32(&request->complete_count) ==
+        request->expected_count) {
         if (hg_cb_info->info.bulk.op == HG_BULK_PULL && info->verify) {
             void *buf;
             hg_size_t buf_size;
@@ -1125,7 +1223,7 @@ hg_perf_done_cb(hg_handle_t handle)
     hg_return_t ret;
 
     /* Set done for context data */
-    info->done = true;
+    hg_atomic_set32(&info->done, 1);
 
     /* Send response back */
     ret = HG_Respond(handle, NULL, NULL, NULL);
@@ -1151,7 +1249,9 @@ hg_perf_send_done(struct hg_perf_class_info *info)
 
     for (i = 0; i < info->target_addr_max; i++) {
         struct hg_perf_request args = {
-            .expected_count = 1, .complete_count = 0, .request = info->request};
+            .expected_count = 1,
+            .complete_count = HG_ATOMIC_VAR_INIT(0),
+            .request = info->request};
         unsigned int completed = 0;
 
         ret = HG_Reset(
@@ -1184,3 +1284,26 @@ hg_perf_send_done(struct hg_perf_class_info *info)
 error:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_perf_trigger(struct hg_perf_class_info *info, unsigned int timeout,
+    unsigned int *actual_count_p)
+{
+    if (info->trigger_batch > 0)
+        return HG_Trigger_batch(
+            info->context, timeout, info->trigger_batch, actual_count_p);
+    else
+        return HG_Trigger(info->context, timeout, 1, actual_count_p);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_perf_wait_done(struct hg_perf_class_info *info)
+{
+    /* Engine makes progress and triggers callbacks */
+    while (!hg_atomic_get32(&info->done))
+        hg_time_sleep(hg_time_from_ms(10));
+
+    return HG_SUCCESS;
+}
@@ -52,19 +52,24 @@ struct hg_perf_class_info {
     size_t handle_per_rank;
     size_t buf_size_min;
     size_t buf_size_max;
+    unsigned int trigger_batch;
+    unsigned int trigger_workers;
     hg_bulk_t *local_bulk_handles;
     hg_bulk_t *remote_bulk_handles;
+    void **loopback_bulk_bufs;        /* Target buffers when sending to self */
+    hg_bulk_t *loopback_bulk_handles; /* Target handles when sending to self */
     hg_request_t *request; /* Request */
     int class_id;
-    bool done;
+    hg_atomic_int32_t done;
     bool verify;
     bool bidir;
+    bool spin;
 };
 
 struct hg_perf_request {
-    int32_t expected_count; /* Expected count */
-    int32_t complete_count; /* Completed count */
-    hg_request_t *request;  /* Request */
+    int32_t expected_count;           /* Expected count */
+    hg_atomic_int32_t complete_count; /* Completed count */
+    hg_request_t *request;            /* Request */
 };
 
 struct hg_perf_bulk_init_info {
@@ -129,6 +134,15 @@ void
 hg_perf_print_lat(const struct hg_test_info *hg_test_info,
     const struct hg_perf_class_info *info, size_t buf_size, hg_time_t t);
 
+void
+hg_perf_print_header_inflight(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, const char *benchmark,
+    size_t buf_size);
+
+void
+hg_perf_print_inflight(const struct hg_test_info *hg_test_info,
+    size_t handle_count, hg_time_t t);
+
 void
 hg_perf_print_header_bw(const struct hg_test_info *hg_test_info,
     const struct hg_perf_class_info *info, const char *benchmark);
@@ -143,6 +157,13 @@ hg_perf_request_complete(const struct hg_cb_info *hg_cb_info);
 hg_return_t
 hg_perf_send_done(struct hg_perf_class_info *info);
 
+hg_return_t
+hg_perf_trigger(struct hg_perf_class_info *info, unsigned int timeout,
+    unsigned int *actual_count_p);
+
+hg_return_t
+hg_perf_wait_done(struct hg_perf_class_info *info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,15 @@
 /* Local Type and Struct Definition */
 /************************************/
 
+struct na_perf_inflight_info {
+    na_op_id_t **send_op_ids; /* Send op IDs */
+    na_op_id_t **recv_op_ids; /* Recv op IDs */
+    void **recv_bufs;         /* Recv buffers */
+    void **recv_data;         /* Recv buffer plugin data */
+    size_t count;             /* Max number of in-flight msgs */
+    size_t buf_size;          /* Msg size */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -23,6 +32,21 @@
 static na_return_t
 na_perf_run(struct na_perf_info *info, size_t buf_size, size_t skip);
 
+static na_return_t
+na_perf_inflight_init(struct na_perf_info *info,
+    struct na_perf_inflight_info *inflight_info, size_t count, size_t buf_size);
+
+static void
+na_perf_inflight_cleanup(
+    struct na_perf_info *info, struct na_perf_inflight_info *inflight_info);
+
+static na_return_t
+na_perf_run_inflight(struct na_perf_info *info,
+    struct na_perf_inflight_info *inflight_info, size_t inflight, size_t skip);
+
+static na_return_t
+na_perf_run_inflight_sweep(struct na_perf_info *info, size_t buf_size);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -119,6 +143,174 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_inflight_init(struct na_perf_info *info,
+    struct na_perf_inflight_info *inflight_info, size_t count, size_t buf_size)
+{
+    na_return_t ret;
+    size_t i;
+
+    inflight_info->count = count;
+    inflight_info->buf_size = buf_size;
+
+    inflight_info->send_op_ids =
+        (na_op_id_t **) calloc(count, sizeof(na_op_id_t *));
+    NA_TEST_CHECK_ERROR(inflight_info->send_op_ids == NULL, error, ret,
+        NA_NOMEM, "Could not allocate send op IDs");
+    inflight_info->recv_op_ids =
+        (na_op_id_t **) calloc(count, sizeof(na_op_id_t *));
+    NA_TEST_CHECK_ERROR(inflight_info->recv_op_ids == NULL, error, ret,
+        NA_NOMEM, "Could not allocate recv op IDs");
+    inflight_info->recv_bufs = (void **) calloc(count, sizeof(void *));
+    NA_TEST_CHECK_ERROR(inflight_info->recv_bufs == NULL, error, ret,
+        NA_NOMEM, "Could not allocate recv buffers");
+    inflight_info->recv_data = (void **) calloc(count, sizeof(void *));
+    NA_TEST_CHECK_ERROR(inflight_info->recv_data == NULL, error, ret,
+        NA_NOMEM, "Could not allocate recv buffer data");
+
+    for (i = 0; i < count; i++) {
+        inflight_info->send_op_ids[i] =
+            NA_Op_create(info->na_class, NA_OP_SINGLE);
+        NA_TEST_CHECK_ERROR(inflight_info->send_op_ids[i] == NULL, error, ret,
+            NA_NOMEM, "NA_Op_create() failed");
+        inflight_info->recv_op_ids[i] =
+            NA_Op_create(info->na_class, NA_OP_SINGLE);
+        NA_TEST_CHECK_ERROR(inflight_info->recv_op_ids[i] == NULL, error, ret,
+            NA_NOMEM, "NA_Op_create() failed");
+        inflight_info->recv_bufs[i] = NA_Msg_buf_alloc(info->na_class,
+            buf_size, NA_RECV, &inflight_info->recv_data[i]);
+        NA_TEST_CHECK_ERROR(inflight_info->recv_bufs[i] == NULL, error, ret,
+            NA_NOMEM, "NA_Msg_buf_alloc() failed");
+    }
+
+    return NA_SUCCESS;
+
+error:
+    na_perf_inflight_cleanup(info, inflight_info);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_perf_inflight_cleanup(
+    struct na_perf_info *info, struct na_perf_inflight_info *inflight_info)
+{
+    size_t i;
+
+    for (i = 0; i < inflight_info->count; i++) {
+        if (inflight_info->send_op_ids && inflight_info->send_op_ids[i])
+            NA_Op_destroy(info->na_class, inflight_info->send_op_ids[i]);
+        if (inflight_info->recv_op_ids && inflight_info->recv_op_ids[i])
+            NA_Op_destroy(info->na_class, inflight_info->recv_op_ids[i]);
+        if (inflight_info->recv_bufs && inflight_info->recv_bufs[i])
+            NA_Msg_buf_free(info->na_class, inflight_info->recv_bufs[i],
+                inflight_info->recv_data[i]);
+    }
+    free(inflight_info->send_op_ids);
+    free(inflight_info->recv_op_ids);
+    free(inflight_info->recv_bufs);
+    free(inflight_info->recv_data);
+    memset(inflight_info, 0, sizeof(*inflight_info));
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_run_inflight(struct na_perf_info *info,
+    struct na_perf_inflight_info *inflight_info, size_t inflight, size_t skip)
+{
+    size_t buf_size = inflight_info->buf_size;
+    hg_time_t t1, t2;
+    na_return_t ret;
+    size_t i, j;
+
+    for (i = 0; i < skip + (size_t) info->na_test_info.loop; i++) {
+        struct na_perf_rma_info args = {.expected_count = (int32_t) inflight,
+            .complete_count = 0,
+            .request = info->request};
+
+        if (i == skip) {
+            if (info->na_test_info.mpi_comm_size > 1)
+                NA_Test_barrier(&info->na_test_info);
+            hg_time_get_current(&t1);
+        }
+
+        hg_request_reset(info->request);
+
+        /* Post recvs in reverse order of sends, responses then never match
+         * the oldest posted recv (worst case for a linear match) */
+        for (j = inflight; j > 0; j--) {
+            ret = NA_Msg_recv_expected(info->na_class, info->context,
+                na_perf_rma_request_complete, &args,
+                inflight_info->recv_bufs[j - 1], buf_size,
+                inflight_info->recv_data[j - 1], info->target_addr, 0,
+                (na_tag_t) (NA_PERF_TAG_INFLIGHT + j - 1),
+                inflight_info->recv_op_ids[j - 1]);
+            NA_TEST_CHECK_NA_ERROR(error, ret,
+                "NA_Msg_recv_expected() failed (%s)", NA_Error_to_string(ret));
+        }
+
+        for (j = 0; j < inflight; j++) {
+            ret = NA_Msg_send_unexpected(info->na_class, info->context, NULL,
+                NULL, info->msg_unexp_buf, buf_size, info->msg_unexp_data,
+                info->target_addr, 0, (na_tag_t) (NA_PERF_TAG_INFLIGHT + j),
+                inflight_info->send_op_ids[j]);
+            NA_TEST_CHECK_NA_ERROR(error, ret,
+                "NA_Msg_send_unexpected() failed (%s)",
+                NA_Error_to_string(ret));
+        }
+
+        hg_request_wait(info->request, NA_MAX_IDLE_TIME, NULL);
+    }
+
+    if (info->na_test_info.mpi_comm_size > 1)
+        NA_Test_barrier(&info->na_test_info);
+
+    hg_time_get_current(&t2);
+
+    if (info->na_test_info.mpi_comm_rank == 0)
+        na_perf_print_inflight(info, inflight, hg_time_subtract(t2, t1));
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_run_inflight_sweep(struct na_perf_info *info, size_t buf_size)
+{
+    struct na_perf_inflight_info inflight_info;
+    size_t inflight;
+    na_return_t ret;
+
+    ret = na_perf_inflight_init(
+        info, &inflight_info, info->na_test_info.inflight_max, buf_size);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "na_perf_inflight_init() failed (%s)",
+        NA_Error_to_string(ret));
+
+    /* Header info */
+    if (info->na_test_info.mpi_comm_rank == 0)
+        na_perf_print_header_inflight(info, BENCHMARK_NAME, buf_size);
+
+    for (inflight = 1; inflight <= info->na_test_info.inflight_max;
+         inflight *= 2) {
+        ret = na_perf_run_inflight(
+            info, &inflight_info, inflight, NA_PERF_LAT_SKIP_SMALL);
+        NA_TEST_CHECK_NA_ERROR(cleanup, ret,
+            "na_perf_run_inflight(%zu) failed (%s)", inflight,
+            NA_Error_to_string(ret));
+    }
+
+cleanup:
+    na_perf_inflight_cleanup(info, &inflight_info);
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(int argc, char *argv[])
@@ -141,17 +333,26 @@ main(int argc, char *argv[])
     min_size =
         (info.msg_unexp_header_size > 0) ? info.msg_unexp_header_size : 1;
 
-    /* Header info */
-    if (info.na_test_info.mpi_comm_rank == 0)
-        na_perf_print_header_lat(&info, BENCHMARK_NAME, min_size);
-
-    /* Msg with different sizes */
-    for (size = min_size; size <= info.msg_unexp_size_max; size *= 2) {
-        na_ret = na_perf_run(&info, size,
-            (size > NA_PERF_LARGE_SIZE) ? NA_PERF_LAT_SKIP_LARGE
-                                        : NA_PERF_LAT_SKIP_SMALL);
-        NA_TEST_CHECK_NA_ERROR(error, na_ret, "na_perf_run(%zu) failed (%s)",
-            size, NA_Error_to_string(na_ret));
+    if (info.na_test_info.inflight_max > 0) {
+        /* Msg with different numbers of msgs in-flight */
+        na_ret = na_perf_run_inflight_sweep(&info, min_size);
+        NA_TEST_CHECK_NA_ERROR(error, na_ret,
+            "na_perf_run_inflight_sweep() failed (%s)",
+            NA_Error_to_string(na_ret));
+    } else {
+        /* Header info */
+        if (info.na_test_info.mpi_comm_rank == 0)
+            na_perf_print_header_lat(&info, BENCHMARK_NAME, min_size);
+
+        /* Msg with different sizes */
+        for (size = min_size; size <= info.msg_unexp_size_max; size *= 2) {
+            na_ret = na_perf_run(&info, size,
+                (size > NA_PERF_LARGE_SIZE) ? NA_PERF_LAT_SKIP_LARGE
+                                            : NA_PERF_LAT_SKIP_SMALL);
+            NA_TEST_CHECK_NA_ERROR(error, na_ret,
+                "na_perf_run(%zu) failed (%s)", size,
+                NA_Error_to_string(na_ret));
+        }
     }
 
     /* Finalize interface */
@@ -9,6 +9,10 @@
 
 #include "mercury_mem.h"
 
+#ifdef NA_HAS_SM
+#    include "na_sm.h"
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -245,10 +249,18 @@ na_perf_init(int argc, char *argv[], bool listen, struct na_perf_info *info)
     }
 
     /* Prepare RMA buf */
-    info->rma_buf =
-        hg_mem_aligned_alloc(page_size, info->rma_size_max * info->rma_count);
+#ifdef NA_HAS_SM
+    if (info->na_test_info.sm_mapped) {
+        /* Peers can then map the buffer and bypass CMA */
+        info->rma_buf = NA_SM_Mem_alloc(
+            info->na_class, info->rma_size_max * info->rma_count);
+    } else
+#endif
+        info->rma_buf = hg_mem_aligned_alloc(
+            page_size, info->rma_size_max * info->rma_count);
     NA_TEST_CHECK_ERROR(info->rma_buf == NULL, error, ret, NA_NOMEM,
-        "hg_mem_aligned_alloc(%zu, %zu) failed", page_size, info->rma_size_max);
+        "Could not allocate RMA buffer (%zu, %zu)", page_size,
+        info->rma_size_max);
     memset(info->rma_buf, 0, info->rma_size_max * info->rma_count);
 
     if (!info->na_test_info.force_register) {
@@ -355,7 +367,12 @@ na_perf_cleanup(struct na_perf_info *info)
     }
     if (info->remote_handle != NULL)
         NA_Mem_handle_free(info->na_class, info->remote_handle);
-    hg_mem_aligned_free(info->rma_buf);
+#ifdef NA_HAS_SM
+    if (info->na_test_info.sm_mapped)
+        NA_SM_Mem_free(info->na_class, info->rma_buf);
+    else
+#endif
+        hg_mem_aligned_free(info->rma_buf);
     hg_mem_aligned_free(info->verify_buf);
 
     if (info->target_addr != NULL)
@@ -406,6 +423,38 @@ na_perf_print_lat(const struct na_perf_info *info, size_t buf_size, hg_time_t t)
     printf("%-*zu%*.*f\n", 10, buf_size, NWIDTH, NDIGITS, msg_lat);
 }
 
+/*---------------------------------------------------------------------------*/
+void
+na_perf_print_header_inflight(
+    const struct na_perf_info *info, const char *benchmark, size_t buf_size)
+{
+    printf("# %s v%s\n", benchmark, VERSION_NAME);
+    printf("# Loop %d times with size %zu byte(s) and up to %zu msg(s) "
+           "in-flight\n",
+        info->na_test_info.loop, buf_size, info->na_test_info.inflight_max);
+    printf("%-*s%*s%*s\n", 10, "# In-flight", NWIDTH, "Avg time (us)", NWIDTH,
+        "Avg rate (msg/s)");
+    fflush(stdout);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+na_perf_print_inflight(
+    const struct na_perf_info *info, size_t inflight, hg_time_t t)
+{
+    double msg_time;
+    size_t loop = (size_t) info->na_test_info.loop,
+           mpi_comm_size = (size_t) info->na_test_info.mpi_comm_size;
+
+    /* Round-trip time amortized over all in-flight msgs */
+    msg_time =
+        hg_time_to_double(t) * 1e6 / (double) (loop * inflight * mpi_comm_size);
+
+    printf("%-*zu%*.*f%*lu\n", 10, inflight, NWIDTH, NDIGITS, msg_time, NWIDTH,
+        (long unsigned int) (1e6 / msg_time));
+    fflush(stdout);
+}
+
 /*---------------------------------------------------------------------------*/
 void
 na_perf_print_header_bw(const struct na_perf_info *info, const char *benchmark)
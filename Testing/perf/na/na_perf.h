@@ -68,6 +68,9 @@ struct na_perf_rma_info {
 #define NA_PERF_TAG_GET      20
 #define NA_PERF_TAG_DONE     111
 
+/* Tags from NA_PERF_TAG_INFLIGHT onward are used by in-flight msgs */
+#define NA_PERF_TAG_INFLIGHT 1000
+
 #define NA_PERF_LAT_SKIP_SMALL 100
 #define NA_PERF_LAT_SKIP_LARGE 10
 #define NA_PERF_BW_SKIP_SMALL  10
@@ -102,6 +105,14 @@ void
 na_perf_print_lat(
     const struct na_perf_info *info, size_t buf_size, hg_time_t t);
 
+void
+na_perf_print_header_inflight(
+    const struct na_perf_info *info, const char *benchmark, size_t buf_size);
+
+void
+na_perf_print_inflight(
+    const struct na_perf_info *info, size_t inflight, hg_time_t t);
+
 void
 na_perf_print_header_bw(const struct na_perf_info *info, const char *benchmark);
 
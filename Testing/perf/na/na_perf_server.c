@@ -15,8 +15,15 @@
 /* Local Type and Struct Definition */
 /************************************/
 
+struct na_perf_send_op {
+    struct na_perf_send_op *next;        /* Next free op */
+    struct na_perf_recv_info *recv_info; /* Recv info */
+    na_op_id_t *op_id;                   /* Send op ID */
+};
+
 struct na_perf_recv_info {
     struct na_perf_info *info;
+    struct na_perf_send_op *send_op_free; /* Free in-flight send ops */
     na_return_t ret;
     bool post_new_recv;
     bool done;
@@ -44,6 +51,13 @@ static void
 na_perf_process_recv(struct na_perf_recv_info *recv_info, void *actual_buf,
     size_t actual_buf_size, na_addr_t *source, na_tag_t tag);
 
+static na_return_t
+na_perf_send_inflight(struct na_perf_recv_info *recv_info,
+    size_t actual_buf_size, na_addr_t *source, na_tag_t tag);
+
+static void
+na_perf_send_inflight_cb(const struct na_cb_info *na_cb_info);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -92,6 +106,15 @@ na_perf_loop(
     NA_TEST_CHECK_ERROR_NORET(ret != NA_SUCCESS && ret != NA_TIMEOUT, error,
         "NA_Progress() failed (%s)", NA_Error_to_string(ret));
 
+    /* Free in-flight send ops */
+    while (recv_info.send_op_free) {
+        struct na_perf_send_op *send_op = recv_info.send_op_free;
+
+        recv_info.send_op_free = send_op->next;
+        NA_Op_destroy(info->na_class, send_op->op_id);
+        free(send_op);
+    }
+
     return NA_SUCCESS;
 
 error:
@@ -174,7 +197,15 @@ na_perf_process_recv(struct na_perf_recv_info *recv_info,
             recv_info->done = true;
             break;
         default:
-            ret = NA_PROTOCOL_ERROR;
+            if (tag >= NA_PERF_TAG_INFLIGHT) {
+                /* Respond with same tag, many can be in flight at once */
+                ret = na_perf_send_inflight(
+                    recv_info, actual_buf_size, source, tag);
+                NA_TEST_CHECK_NA_ERROR(done, ret,
+                    "na_perf_send_inflight() failed (%s)",
+                    NA_Error_to_string(ret));
+            } else
+                ret = NA_PROTOCOL_ERROR;
             break;
     }
 
@@ -184,6 +215,58 @@ done:
     recv_info->ret = ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_send_inflight(struct na_perf_recv_info *recv_info,
+    size_t actual_buf_size, na_addr_t *source, na_tag_t tag)
+{
+    struct na_perf_info *info = recv_info->info;
+    struct na_perf_send_op *send_op = recv_info->send_op_free;
+    na_return_t ret;
+
+    /* Reuse a completed op or create a new one */
+    if (send_op != NULL)
+        recv_info->send_op_free = send_op->next;
+    else {
+        send_op = (struct na_perf_send_op *) malloc(sizeof(*send_op));
+        NA_TEST_CHECK_ERROR(send_op == NULL, error, ret, NA_NOMEM,
+            "Could not allocate send op");
+        send_op->recv_info = recv_info;
+        send_op->op_id = NA_Op_create(info->na_class, NA_OP_SINGLE);
+        NA_TEST_CHECK_ERROR(send_op->op_id == NULL, error_free, ret, NA_NOMEM,
+            "NA_Op_create() failed");
+    }
+
+    ret = NA_Msg_send_expected(info->na_class, info->context,
+        na_perf_send_inflight_cb, send_op, info->msg_exp_buf, actual_buf_size,
+        info->msg_exp_data, source, 0, tag, send_op->op_id);
+    NA_TEST_CHECK_NA_ERROR(error_release, ret,
+        "NA_Msg_send_expected() failed (%s)", NA_Error_to_string(ret));
+
+    return NA_SUCCESS;
+
+error_free:
+    free(send_op);
+error:
+    return ret;
+
+error_release:
+    send_op->next = recv_info->send_op_free;
+    recv_info->send_op_free = send_op;
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_perf_send_inflight_cb(const struct na_cb_info *na_cb_info)
+{
+    struct na_perf_send_op *send_op =
+        (struct na_perf_send_op *) na_cb_info->arg;
+
+    send_op->next = send_op->recv_info->send_op_free;
+    send_op->recv_info->send_op_free = send_op;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(int argc, char *argv[])
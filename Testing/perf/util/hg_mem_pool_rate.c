@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mercury_atomic.h"
+#include "mercury_mem_pool.h"
+#include "mercury_thread.h"
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define CHUNK_SIZE  (4096)
+#define CHUNK_COUNT (64)
+#define BLOCK_COUNT (1)
+
+#define THREAD_MAX (8)
+
+/* Each thread holds BATCH chunks at once */
+#define BATCH (8)
+#define OPS   (200000)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct rate_args {
+    struct hg_mem_pool *mem_pool;
+    hg_atomic_int32_t ready;
+    hg_atomic_int32_t errors;
+    unsigned int n_threads;
+};
+
+struct rate_thread_args {
+    struct rate_args *rate_args;
+    hg_time_t t;
+    unsigned int id;
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static int
+hg_perf_mem_pool_register(
+    const void *buf, size_t len, unsigned long flags, void **handle, void *arg);
+
+static int
+hg_perf_mem_pool_deregister(void *handle, void *arg);
+
+static int
+hg_perf_mem_pool_rate(struct hg_mem_pool *hg_mem_pool, unsigned int n_threads);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_perf_mem_pool_register(
+    const void *buf, size_t len, unsigned long flags, void **handle, void *arg)
+{
+    (void) buf;
+    (void) len;
+    (void) flags;
+    (void) arg;
+
+    *handle = NULL;
+
+    return HG_UTIL_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_perf_mem_pool_deregister(void *handle, void *arg)
+{
+    (void) handle;
+    (void) arg;
+
+    return HG_UTIL_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_perf_rate_thread(void *arg)
+{
+    struct rate_thread_args *thread_args = (struct rate_thread_args *) arg;
+    struct rate_args *rate_args = thread_args->rate_args;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+    void *mem_ptrs[BATCH], *mr_handles[BATCH];
+    hg_time_t t1, t2;
+    int i, j;
+
+    /* Start all threads at once */
+    hg_atomic_incr32(&rate_args->ready);
+    while ((unsigned int) hg_atomic_get32(&rate_args->ready) !=
+           rate_args->n_threads)
+        hg_thread_yield();
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < OPS / BATCH; i++) {
+        for (j = 0; j < BATCH; j++) {
+            mem_ptrs[j] = hg_mem_pool_alloc(
+                rate_args->mem_pool, CHUNK_SIZE, &mr_handles[j]);
+            if (mem_ptrs[j] == NULL)
+                goto error;
+            *(unsigned int *) mem_ptrs[j] = thread_args->id;
+        }
+        for (j = 0; j < BATCH; j++)
+            hg_mem_pool_free(rate_args->mem_pool, mem_ptrs[j], mr_handles[j]);
+    }
+    hg_time_get_current(&t2);
+    thread_args->t = hg_time_subtract(t2, t1);
+
+    hg_thread_exit(thread_ret);
+    return thread_ret;
+
+error:
+    hg_atomic_incr32(&rate_args->errors);
+    while (j-- > 0)
+        hg_mem_pool_free(rate_args->mem_pool, mem_ptrs[j], mr_handles[j]);
+
+    hg_thread_exit(thread_ret);
+    return thread_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_perf_mem_pool_rate(struct hg_mem_pool *hg_mem_pool, unsigned int n_threads)
+{
+    struct rate_args rate_args;
+    struct rate_thread_args thread_args[THREAD_MAX];
+    hg_thread_t threads[THREAD_MAX];
+    double t_max = 0;
+    unsigned int i;
+
+    rate_args.mem_pool = hg_mem_pool;
+    rate_args.n_threads = n_threads;
+    hg_atomic_init32(&rate_args.ready, 0);
+    hg_atomic_init32(&rate_args.errors, 0);
+
+    for (i = 0; i < n_threads; i++) {
+        thread_args[i].rate_args = &rate_args;
+        thread_args[i].t = hg_time_from_ms(0);
+        thread_args[i].id = i + 1;
+        hg_thread_create(&threads[i], hg_perf_rate_thread, &thread_args[i]);
+    }
+    for (i = 0; i < n_threads; i++) {
+        double t;
+
+        hg_thread_join(threads[i]);
+        t = hg_time_to_double(thread_args[i].t);
+        if (t > t_max)
+            t_max = t;
+    }
+
+    if (hg_atomic_get32(&rate_args.errors) > 0) {
+        fprintf(stderr, "Error: %d chunk(s) could not be allocated\n",
+            (int) hg_atomic_get32(&rate_args.errors));
+        return EXIT_FAILURE;
+    }
+
+    /* Each op is an alloc/free pair */
+    printf("%-10u%16.2f\n", n_threads,
+        (double) (n_threads * OPS) / (t_max * 1e6));
+
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(void)
+{
+    struct hg_mem_pool *hg_mem_pool;
+    unsigned int i;
+    int ret = EXIT_SUCCESS;
+
+    hg_mem_pool = hg_mem_pool_create(CHUNK_SIZE, CHUNK_COUNT, BLOCK_COUNT,
+        hg_perf_mem_pool_register, 0, hg_perf_mem_pool_deregister, NULL);
+    if (hg_mem_pool == NULL) {
+        fprintf(stderr, "Error: could not create memory pool\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Measure alloc/free throughput with increasing number of threads */
+    printf("# %d alloc/free pair(s) per thread, %d chunk(s) held at once\n",
+        OPS, BATCH);
+    printf("%-10s%16s\n", "# Threads", "Mops/s");
+    for (i = 1; i <= THREAD_MAX; i *= 2) {
+        ret = hg_perf_mem_pool_rate(hg_mem_pool, i);
+        if (ret != EXIT_SUCCESS)
+            break;
+    }
+
+    hg_mem_pool_destroy(hg_mem_pool);
+
+    return ret;
+}
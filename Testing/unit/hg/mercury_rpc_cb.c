@@ -8,6 +8,7 @@
 #include "mercury_unit.h"
 
 #include "mercury_atomic.h"
+#include "mercury_crc32c.h"
 #include "mercury_rpc_cb.h"
 #include "mercury_thread_mutex.h"
 #include "mercury_thread_pool.h"
@@ -364,12 +365,37 @@ HG_TEST_RPC_CB(hg_test_bulk_write, handle)
                       "target_offset=%" PRIu64,
         bulk_args->transfer_size, bulk_args->origin_offset,
         bulk_args->target_offset);
-    ret = HG_Bulk_transfer_id(hg_info->context, hg_test_bulk_transfer_cb,
-        bulk_args, HG_BULK_PULL, hg_info->addr, hg_info->context_id,
-        origin_bulk_handle, bulk_args->origin_offset, local_bulk_handle,
-        bulk_args->target_offset, bulk_args->transfer_size, &hg_bulk_op_id);
-    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer_id() failed (%s)",
-        HG_Error_to_string(ret));
+    if (fildes == HG_TEST_BULK_FILDES_LIST) {
+        struct hg_bulk_transfer_desc descs[HG_TEST_BULK_LIST_COUNT];
+        hg_size_t piece_size =
+            bulk_args->transfer_size / HG_TEST_BULK_LIST_COUNT;
+        hg_uint32_t i;
+
+        /* Split transfer into pieces, last one gets the remainder */
+        for (i = 0; i < HG_TEST_BULK_LIST_COUNT; i++) {
+            descs[i].origin_handle = origin_bulk_handle;
+            descs[i].origin_offset = bulk_args->origin_offset + i * piece_size;
+            descs[i].local_handle = local_bulk_handle;
+            descs[i].local_offset = bulk_args->target_offset + i * piece_size;
+            descs[i].size = (i < HG_TEST_BULK_LIST_COUNT - 1)
+                                ? piece_size
+                                : bulk_args->transfer_size - i * piece_size;
+        }
+
+        ret = HG_Bulk_transfer_list(hg_info->context, hg_test_bulk_transfer_cb,
+            bulk_args, HG_BULK_PULL, hg_info->addr, hg_info->context_id, descs,
+            HG_TEST_BULK_LIST_COUNT, &hg_bulk_op_id);
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "HG_Bulk_transfer_list() failed (%s)", HG_Error_to_string(ret));
+    } else {
+        ret = HG_Bulk_transfer_id(hg_info->context, hg_test_bulk_transfer_cb,
+            bulk_args, HG_BULK_PULL, hg_info->addr, hg_info->context_id,
+            origin_bulk_handle, bulk_args->origin_offset, local_bulk_handle,
+            bulk_args->target_offset, bulk_args->transfer_size,
+            &hg_bulk_op_id);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer_id() failed (%s)",
+            HG_Error_to_string(ret));
+    }
 
     /* Test HG_Bulk_Cancel() */
     if (fildes < 0) {
@@ -574,6 +600,8 @@ hg_test_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
 {
     struct hg_test_bulk_args *bulk_args =
         (struct hg_test_bulk_args *) hg_cb_info->arg;
+    struct hg_unit_info *info = (struct hg_unit_info *) HG_Class_get_data(
+        HG_Get_info(bulk_args->handle)->hg_class);
     hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
     hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
     hg_return_t ret = HG_SUCCESS;
@@ -595,6 +623,21 @@ hg_test_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
     HG_TEST_CHECK_HG_ERROR(
         done, ret, "HG_Bulk_access() failed (%s)", HG_Error_to_string(ret));
 
+    /* Checksum reported must match data that was pulled */
+    if (info->hg_test_info.bulk_checksum) {
+        hg_uint32_t checksum = hg_crc32c_update(0,
+            (const char *) buf + bulk_args->target_offset,
+            (size_t) bulk_args->transfer_size);
+
+        if (checksum != hg_cb_info->info.bulk.checksum) {
+            HG_TEST_LOG_ERROR("Bulk checksum 0x%08" PRIx32
+                              " does not match data checksum 0x%08" PRIx32,
+                hg_cb_info->info.bulk.checksum, checksum);
+            out_struct.ret = 0;
+            goto done;
+        }
+    }
+
     /* Call bulk_write */
     write_ret = bulk_write(bulk_args->fildes, buf, bulk_args->target_offset,
         bulk_args->origin_offset - bulk_args->target_offset,
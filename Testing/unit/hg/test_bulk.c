@@ -292,7 +292,8 @@ static hg_return_t
 hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
     hg_request_class_t *request_class, hg_addr_t target_addr,
     hg_size_t bulk_size, hg_size_t transfer_size, hg_size_t origin_offset,
-    hg_size_t target_offset, hg_uint32_t origin_segment_count)
+    hg_size_t target_offset, hg_uint32_t origin_segment_count,
+    hg_bool_t list)
 {
     hg_request_t *request = NULL;
     hg_handle_t handle = HG_HANDLE_NULL;
@@ -342,7 +343,7 @@ hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
         done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
 
     /* Fill input structure */
-    bulk_write_in_struct.fildes = 0;
+    bulk_write_in_struct.fildes = (list) ? HG_TEST_BULK_FILDES_LIST : 0;
     bulk_write_in_struct.transfer_size = transfer_size;
     bulk_write_in_struct.origin_offset = origin_offset;
     bulk_write_in_struct.target_offset = target_offset;
@@ -470,6 +471,179 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_strided(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t bulk_size, hg_size_t transfer_size, hg_size_t origin_offset,
+    hg_size_t target_offset, hg_size_t block_len)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL, block_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t bulk_write_in_struct;
+    hg_size_t stride = block_len + block_len / 2;
+    hg_uint32_t count = (hg_uint32_t) (bulk_size / block_len);
+    char *bulk_buf = NULL;
+    size_t i;
+
+    HG_TEST_CHECK_ERROR(origin_offset + transfer_size > count * block_len,
+        done, ret, HG_OVERFLOW, "Exceeding bulk size");
+
+    /* Prepare bulk_buf, gaps between blocks must not be transferred */
+    bulk_buf = malloc(count * stride);
+    HG_TEST_CHECK_ERROR(bulk_buf == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate bulk_buf");
+
+    memset(bulk_buf, 0x5a, count * stride);
+    for (i = 0; i < count * block_len; i++)
+        bulk_buf[(i / block_len) * stride + i % block_len] = (char) i;
+
+    request = hg_request_create(request_class);
+
+    /* Register memory */
+    ret = HG_Bulk_create_strided(hg_class, bulk_buf, block_len, stride, count,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_create_strided() failed (%s)",
+        HG_Error_to_string(ret));
+
+    /* Descriptor size does not depend on number of blocks */
+    ret = HG_Bulk_create_strided(hg_class, bulk_buf, block_len, stride, 1,
+        HG_BULK_READ_ONLY, &block_handle);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_create_strided() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_serialize_size(bulk_handle, 0) !=
+                            HG_Bulk_get_serialize_size(block_handle, 0),
+        done, ret, HG_FAULT, "Serialize size depends on number of blocks");
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_size(bulk_handle) != count * block_len,
+        done, ret, HG_FAULT, "Invalid bulk size");
+
+    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Fill input structure */
+    bulk_write_in_struct.fildes = 0;
+    bulk_write_in_struct.transfer_size = transfer_size;
+    bulk_write_in_struct.origin_offset = origin_offset;
+    bulk_write_in_struct.target_offset = target_offset;
+    bulk_write_in_struct.bulk_handle = bulk_handle;
+    HG_TEST_LOG_DEBUG("Requesting transfer_size=%" PRIu64
+                      ", origin_offset=%" PRIu64 ",  target_offset=%" PRIu64,
+        bulk_write_in_struct.transfer_size, bulk_write_in_struct.origin_offset,
+        bulk_write_in_struct.target_offset);
+
+    /* Forward call to remote addr and get a new request */
+    HG_TEST_LOG_DEBUG(
+        "Forwarding call with op id: %" PRIu64 "...", hg_test_bulk_write_id_g);
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = transfer_size;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
+        &bulk_write_in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    /* Assign ret from CB */
+    ret = forward_cb_args.ret;
+
+done:
+    /* Free memory handles */
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Bulk_free(block_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    hg_request_destroy(request);
+
+    /* Free bulk data */
+    free(bulk_buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_reg_cache(hg_class_t *hg_class, hg_size_t cache_size)
+{
+    struct hg_bulk_reg_cache_stats stats[3];
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    char data[64];
+    void *buf_ptr = data;
+    hg_size_t buf_size = sizeof(data);
+    int i;
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats[0]);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+
+    /* Second registration of the same buffer must hit */
+    for (i = 0; i < 2; i++) {
+        ret = HG_Bulk_create(
+            hg_class, 1, &buf_ptr, &buf_size, HG_BULK_READWRITE, &bulk_handle);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+        ret = HG_Bulk_free(bulk_handle);
+        bulk_handle = HG_BULK_NULL;
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats[1]);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+
+    if (cache_size == 0) {
+        HG_TEST_CHECK_ERROR(stats[1].miss_count != 0 ||
+                                stats[1].hit_count != 0 ||
+                                stats[1].entry_count != 0,
+            done, ret, HG_FAULT, "Stats should be zero when cache is disabled");
+        goto done;
+    }
+
+    /* One entry per NA class the buffer was registered with */
+    HG_TEST_CHECK_ERROR(stats[1].miss_count - stats[0].miss_count == 0, done,
+        ret, HG_FAULT, "No registration was added to cache");
+    HG_TEST_CHECK_ERROR(stats[1].hit_count - stats[0].hit_count !=
+                            stats[1].miss_count - stats[0].miss_count,
+        done, ret, HG_FAULT,
+        "Hits (%" PRIu64 ") do not match misses (%" PRIu64 ")",
+        stats[1].hit_count - stats[0].hit_count,
+        stats[1].miss_count - stats[0].miss_count);
+
+    /* Invalidating part of the buffer removes its registrations */
+    ret = HG_Bulk_reg_cache_invalidate(hg_class, data + 8, 8);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_invalidate() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats[2]);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats[2].evict_count - stats[1].evict_count !=
+                            stats[1].miss_count - stats[0].miss_count,
+        done, ret, HG_FAULT, "Registrations were not invalidated");
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(int argc, char *argv[])
@@ -550,14 +724,15 @@ main(int argc, char *argv[])
 
     HG_TEST("segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
-        info.target_addr, buf_size, buf_size, 0, 0, 16);
+        info.target_addr, buf_size, buf_size, 0, 0, 16, HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "segmented RPC bulk failed");
     HG_PASSED();
 
     HG_TEST("segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
-        info.target_addr, buf_size, buf_size / 4, buf_size / 2 + 1, 0, 16);
+        info.target_addr, buf_size, buf_size / 4, buf_size / 2 + 1, 0, 16,
+        HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "segmented RPC bulk failed");
     HG_PASSED();
@@ -566,7 +741,7 @@ main(int argc, char *argv[])
             "BUFSIZE/4)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
         info.target_addr, buf_size, buf_size / 8, buf_size / 2 + 1,
-        buf_size / 4, 16);
+        buf_size / 4, 16, HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "segmented RPC bulk failed");
     HG_PASSED();
@@ -574,7 +749,7 @@ main(int argc, char *argv[])
 #ifndef HG_HAS_XDR
     HG_TEST("over-segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
-        info.target_addr, buf_size, buf_size, 0, 0, 1024);
+        info.target_addr, buf_size, buf_size, 0, 0, 1024, HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "over-segmented RPC bulk failed");
     HG_PASSED();
@@ -582,7 +757,8 @@ main(int argc, char *argv[])
     HG_TEST(
         "over-segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
-        info.target_addr, buf_size, buf_size / 4, buf_size / 2 + 1, 0, 1024);
+        info.target_addr, buf_size, buf_size / 4, buf_size / 2 + 1, 0, 1024,
+        HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "over-segmented RPC bulk failed");
     HG_PASSED();
@@ -591,12 +767,51 @@ main(int argc, char *argv[])
             "BUFSIZE/4)");
     hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
         info.target_addr, buf_size, buf_size / 8, buf_size / 2 + 1,
-        buf_size / 4, 1024);
+        buf_size / 4, 1024, HG_FALSE);
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "over-segmented RPC bulk failed");
     HG_PASSED();
 #endif
 
+    HG_TEST("list RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
+        info.target_addr, buf_size, buf_size, 0, 0, 16, HG_TRUE);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "list RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("list RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_seg(info.hg_class, info.context, info.request_class,
+        info.target_addr, buf_size, buf_size / 8, buf_size / 2 + 1,
+        buf_size / 4, 16, HG_TRUE);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "list RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_strided(info.hg_class, info.context,
+        info.request_class, info.target_addr, buf_size, buf_size, 0, 0, 64);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "strided RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_strided(info.hg_class, info.context,
+        info.request_class, info.target_addr, buf_size, buf_size / 8,
+        buf_size / 2 + 1, buf_size / 4, 64);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "strided RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("bulk registration cache");
+    hg_ret = hg_test_bulk_reg_cache(
+        info.hg_class, info.hg_test_info.bulk_reg_cache_size);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk registration cache failed");
+    HG_PASSED();
+
     if (strcmp(HG_Class_get_name(info.hg_class), "ofi") == 0 ||
         strcmp(HG_Class_get_name(info.hg_class), "na") == 0 ||
         strcmp(HG_Class_get_name(info.hg_class), "ucx") == 0) {
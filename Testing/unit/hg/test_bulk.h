@@ -13,6 +13,11 @@
 /* Dummy function that needs to be shipped */
 /* size_t bulk_write(int fildes, const void *buf, size_t nbyte); */
 
+/* When fildes is set to this value, the server pulls data using
+ * HG_Bulk_transfer_list() with transfers split into HG_TEST_BULK_LIST_COUNT */
+#define HG_TEST_BULK_FILDES_LIST (2)
+#define HG_TEST_BULK_LIST_COUNT  (8)
+
 #ifdef HG_HAS_BOOST
 /* Generate processor and struct for required input/output structs
  * MERCURY_GEN_PROC( struct_type_name, fields )
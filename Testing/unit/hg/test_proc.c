@@ -30,6 +30,12 @@ typedef struct {
     hg_const_string_t string;
 } hg_test_proc_string_t;
 
+typedef struct {
+    hg_const_string_t string;
+    hg_uint64_t buf_size;
+    void *buf;
+} hg_test_proc_blob_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -72,6 +78,27 @@ hg_proc_hg_test_proc_string_t(hg_proc_t proc, void *data)
     return ret;
 }
 
+static hg_return_t
+hg_proc_hg_test_proc_blob_t(hg_proc_t proc, void *data)
+{
+    hg_test_proc_blob_t *struct_data = (hg_test_proc_blob_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = hg_proc_hg_const_string_t(proc, &struct_data->string);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->buf_size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_bytes_ptr(proc, &struct_data->buf, struct_data->buf_size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    return ret;
+}
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -226,6 +253,101 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_blob(void)
+{
+    hg_return_t ret;
+    char blob[64];
+    hg_test_proc_blob_t in = {"Hello", sizeof(blob), blob},
+                        out = {NULL, 0, NULL};
+
+    memset(blob, 'a', sizeof(blob));
+
+    ret = hg_test_proc_generic(hg_proc_hg_test_proc_blob_t, &in, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_generic() failed");
+
+    HG_TEST_CHECK_ERROR(strcmp(in.string, out.string) != 0 ||
+                            in.buf_size != out.buf_size ||
+                            memcmp(in.buf, out.buf, sizeof(blob)) != 0,
+        done, ret, HG_PROTOCOL_ERROR, "Encoded and decoded blobs do not match");
+
+    ret = hg_test_proc_free(hg_proc_hg_test_proc_blob_t, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_free() failed");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_zero_copy(void)
+{
+    hg_proc_t proc = HG_PROC_NULL;
+    char *buf = NULL, blob[64];
+    size_t buf_size = (size_t) hg_mem_get_page_size();
+    hg_test_proc_blob_t in = {"Hello", sizeof(blob), blob},
+                        out = {NULL, 0, NULL};
+    hg_return_t ret;
+
+    memset(blob, 'a', sizeof(blob));
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_CRC32, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    ret = hg_proc_hg_test_proc_blob_t(proc, &in);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc blob_t struct");
+
+    ret = hg_proc_flush(proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Error in proc flush");
+
+    /* Decode without copying */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_ZERO_COPY);
+
+    ret = hg_proc_hg_test_proc_blob_t(proc, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc blob_t struct");
+
+    ret = hg_proc_flush(proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Error in proc flush");
+
+    HG_TEST_CHECK_ERROR(strcmp(in.string, out.string) != 0 ||
+                            in.buf_size != out.buf_size ||
+                            memcmp(in.buf, out.buf, sizeof(blob)) != 0,
+        done, ret, HG_PROTOCOL_ERROR, "Encoded and decoded blobs do not match");
+
+#ifndef HG_HAS_XDR
+    /* Decoded data must point into the proc buffer */
+    HG_TEST_CHECK_ERROR(out.string < buf || out.string >= buf + buf_size ||
+                            (char *) out.buf < buf ||
+                            (char *) out.buf >= buf + buf_size,
+        done, ret, HG_PROTOCOL_ERROR, "Decoded data was copied");
+#endif
+
+    /* Borrowed data must not be freed */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_FREE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_ZERO_COPY);
+
+    ret = hg_proc_hg_test_proc_blob_t(proc, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc blob_t struct");
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+    free(buf);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(void)
@@ -247,6 +369,20 @@ main(void)
         "string proc test failed");
     HG_PASSED();
 
+    /* blob proc test */
+    HG_TEST("blob proc");
+    hg_ret = hg_test_proc_blob();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "blob proc test failed");
+    HG_PASSED();
+
+    /* zero-copy proc test */
+    HG_TEST("zero-copy proc");
+    hg_ret = hg_test_proc_zero_copy();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "zero-copy proc test failed");
+    HG_PASSED();
+
 done:
     if (ret != EXIT_SUCCESS)
         HG_FAILED();
@@ -302,10 +302,19 @@ hg_test_rpc_output_overflow_cb(const struct hg_cb_info *callback_info)
 #    endif
     HG_TEST_LOG_DEBUG("Returned string (length %zu): %s", string_len, string);
 
+    /* Payload must be intact */
+    if (out_struct.string == NULL ||
+        strspn(out_struct.string, "h") != out_struct.string_len ||
+        out_struct.string[out_struct.string_len] != '\0') {
+        HG_TEST_LOG_ERROR("Returned string is corrupted");
+        ret = HG_PROTOCOL_ERROR;
+    }
+
     /* Free output */
-    ret = HG_Free_output(handle, &out_struct);
-    HG_TEST_CHECK_HG_ERROR(
-        done, ret, "HG_Free_output() failed (%s)", HG_Error_to_string(ret));
+    if (HG_Free_output(handle, &out_struct) != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("HG_Free_output() failed");
+        ret = HG_FAULT;
+    }
 
 done:
     args->ret = ret;
@@ -590,12 +599,21 @@ main(int argc, char *argv[])
 
 #ifndef HG_HAS_XDR
     /* Overflow RPC test */
-    HG_TEST("RPC with output overflow");
-    hg_ret = hg_test_rpc_no_input(info.handles[0], info.target_addr,
-        hg_test_overflow_id_g, hg_test_rpc_output_overflow_cb, info.request);
-    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_rpc_no_input() failed (%s)",
-        HG_Error_to_string(hg_ret));
-    HG_PASSED();
+    {
+        int i;
+
+        HG_TEST("RPC with output overflow");
+        /* Twice so that pooled extra payload buffers get re-used */
+        for (i = 0; i < 2; i++) {
+            hg_ret = hg_test_rpc_no_input(info.handles[0], info.target_addr,
+                hg_test_overflow_id_g, hg_test_rpc_output_overflow_cb,
+                info.request);
+            HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+                "hg_test_rpc_no_input() failed (%s)",
+                HG_Error_to_string(hg_ret));
+        }
+        HG_PASSED();
+    }
 #endif
 
     /* Cancel RPC test (self cancelation is not supported) */
@@ -25,6 +25,9 @@ main(void)
     struct my_entry my_entry1 = {.value = value1};
     struct my_entry my_entry2 = {.value = value2};
     struct my_entry *my_entry_ptr;
+    struct my_entry my_entries[HG_TEST_QUEUE_SIZE - 1];
+    void *entries[HG_TEST_QUEUE_SIZE];
+    unsigned int i, count;
 
     hg_atomic_queue = hg_atomic_queue_alloc(HG_TEST_QUEUE_SIZE);
     if (!hg_atomic_queue) {
@@ -62,6 +65,50 @@ main(void)
         goto done;
     }
 
+    /* Fill queue so that batch pops wrap around the ring */
+    for (i = 0; i < HG_TEST_QUEUE_SIZE - 1; i++) {
+        my_entries[i].value = (int) i;
+        if (hg_atomic_queue_push(hg_atomic_queue, &my_entries[i]) !=
+            HG_UTIL_SUCCESS) {
+            fprintf(stderr, "Error: could not push entry %u\n", i);
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+    }
+
+    count = hg_atomic_queue_pop_mc_batch(hg_atomic_queue, entries, 4);
+    if (count != 4) {
+        fprintf(stderr, "Error: expected 4 entries, got %u\n", count);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    count += hg_atomic_queue_pop_mc_batch(
+        hg_atomic_queue, &entries[count], HG_TEST_QUEUE_SIZE);
+    if (count != HG_TEST_QUEUE_SIZE - 1) {
+        fprintf(stderr, "Error: expected %d entries, got %u\n",
+            HG_TEST_QUEUE_SIZE - 1, count);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    for (i = 0; i < count; i++) {
+        my_entry_ptr = (struct my_entry *) entries[i];
+        if (my_entry_ptr->value != (int) i) {
+            fprintf(stderr, "Error: values do not match, expected %u, got %d\n",
+                i, my_entry_ptr->value);
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+    }
+
+    if (!hg_atomic_queue_is_empty(hg_atomic_queue) ||
+        hg_atomic_queue_pop_mc_batch(hg_atomic_queue, entries, 1) != 0) {
+        fprintf(stderr, "Error: queue should be empty\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
 done:
     hg_atomic_queue_free(hg_atomic_queue);
     return ret;
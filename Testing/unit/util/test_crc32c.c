@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mercury_crc32c.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_SIZE   (3 * 4096 * 4 + 123)
+#define OFFSET_MAX (3)
+
+/* Bit-by-bit reference */
+static uint32_t
+crc32c_ref(const unsigned char *buf, size_t len)
+{
+    uint32_t crc = 0xffffffff;
+    size_t i;
+    int j;
+
+    for (i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (j = 0; j < 8; j++)
+            crc = (crc & 1) ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+    }
+
+    return ~crc;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main(int argc, char *argv[])
+{
+    const char *check_str = "123456789";
+    unsigned char *buf = NULL, *copy_buf = NULL;
+    uint32_t crc, ref, acc;
+    size_t lens[] = {0, 1, 7, 8, 9, 63, 4096, 3 * 4096, 3 * 4096 + 17,
+        BUF_SIZE - 1};
+    size_t i, j;
+    int ret = EXIT_SUCCESS;
+
+    (void) argc;
+    (void) argv;
+
+    /* Standard check value */
+    crc = hg_crc32c_update(0, check_str, strlen(check_str));
+    if (crc != 0xe3069283) {
+        fprintf(stderr, "Error: CRC of check string is 0x%08x\n", crc);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Leave room for the unaligned offsets below */
+    buf = (unsigned char *) malloc(BUF_SIZE + OFFSET_MAX);
+    copy_buf = (unsigned char *) malloc(BUF_SIZE + OFFSET_MAX);
+    if (buf == NULL || copy_buf == NULL) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (i = 0; i < BUF_SIZE + OFFSET_MAX; i++)
+        buf[i] = (unsigned char) (i * 31 + (i >> 8));
+
+    /* Various lengths and unaligned buffers */
+    for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        for (j = 0; j < OFFSET_MAX; j++) {
+            ref = crc32c_ref(buf + j, lens[i]);
+            crc = hg_crc32c_update(0, buf + j, lens[i]);
+            if (crc != ref) {
+                fprintf(stderr,
+                    "Error: CRC of %zu bytes at offset %zu is 0x%08x "
+                    "(expected 0x%08x)\n",
+                    lens[i], j, crc, ref);
+                ret = EXIT_FAILURE;
+                goto done;
+            }
+
+            memset(copy_buf, 0, BUF_SIZE + OFFSET_MAX);
+            crc = hg_crc32c_copy(0, copy_buf + j, buf + j, lens[i]);
+            if (crc != ref || memcmp(copy_buf + j, buf + j, lens[i]) != 0) {
+                fprintf(stderr, "Error: copy of %zu bytes failed\n", lens[i]);
+                ret = EXIT_FAILURE;
+                goto done;
+            }
+        }
+    }
+
+    /* Incremental update, combine and out-of-order accumulation */
+    ref = crc32c_ref(buf, BUF_SIZE);
+    crc = hg_crc32c_update(0, buf, 1000);
+    crc = hg_crc32c_update(crc, buf + 1000, BUF_SIZE - 1000);
+    if (crc != ref) {
+        fprintf(stderr, "Error: incremental CRC is 0x%08x\n", crc);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    crc = hg_crc32c_combine(hg_crc32c_update(0, buf, 1000),
+        hg_crc32c_update(0, buf + 1000, BUF_SIZE - 1000), BUF_SIZE - 1000);
+    if (crc != ref) {
+        fprintf(stderr, "Error: combined CRC is 0x%08x\n", crc);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (acc = 0, i = BUF_SIZE; i > 0;) {
+        size_t len = (i > 5000) ? 5000 : i;
+
+        i -= len;
+        acc ^= hg_crc32c_combine(
+            hg_crc32c_update(0, buf + i, len), 0, BUF_SIZE - i - len);
+    }
+    if (acc != ref) {
+        fprintf(stderr, "Error: accumulated CRC is 0x%08x\n", acc);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+done:
+    free(buf);
+    free(copy_buf);
+
+    return ret;
+}
@@ -13,8 +13,10 @@
 int
 main(void)
 {
+    struct hg_mem_numa_policy policy;
     size_t page_size;
     void *ptr;
+    int node;
 
     page_size = (size_t) hg_mem_get_page_size();
     if (page_size == 0) {
@@ -29,6 +31,40 @@ main(void)
     }
     hg_mem_aligned_free(ptr);
 
+    node = hg_mem_numa_node_get();
+    if (node < 0) {
+        fprintf(stderr, "Warning: could not get NUMA node\n");
+    } else {
+        if (hg_mem_numa_node_prefer(node, &policy) != HG_UTIL_SUCCESS) {
+            fprintf(stderr, "Error: could not prefer NUMA node %d\n", node);
+            goto error;
+        }
+        ptr = hg_mem_aligned_alloc(page_size, page_size * 4);
+        if (ptr == NULL) {
+            fprintf(stderr, "Error: could not allocate %zu bytes\n",
+                page_size * 4);
+            goto error;
+        }
+        hg_mem_aligned_free(ptr);
+        if (hg_mem_numa_policy_restore(&policy) != HG_UTIL_SUCCESS) {
+            fprintf(stderr, "Error: could not reset NUMA policy\n");
+            goto error;
+        }
+    }
+
+    /* Memory bound to a node must be zeroed, node may not be known */
+    ptr = hg_mem_numa_alloc(page_size * 4, node);
+    if (ptr == NULL) {
+        fprintf(stderr, "Error: could not allocate %zu bytes on node %d\n",
+            page_size * 4, node);
+        goto error;
+    }
+    if (((char *) ptr)[page_size * 4 - 1] != 0) {
+        fprintf(stderr, "Error: NUMA memory is not zeroed\n");
+        goto error;
+    }
+    hg_mem_numa_free(ptr, page_size * 4);
+
     page_size = (size_t) hg_mem_get_hugepage_size();
     if (page_size == 0) {
         fprintf(stderr, "Warning: hugepage size is 0\n");
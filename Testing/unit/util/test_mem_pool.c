@@ -26,6 +26,11 @@
 #    define HG_TEST_NUM_THREADS_DEFAULT (8)
 #endif
 
+/* Each thread holds CONCURRENT_BATCH chunks at once */
+#define CONCURRENT_CHUNK_COUNT (64)
+#define CONCURRENT_BATCH       (8)
+#define CONCURRENT_OPS         (1024)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -39,6 +44,17 @@ struct thread_args {
     int mr;
 };
 
+struct concurrent_args {
+    struct hg_mem_pool *mem_pool;
+    hg_atomic_int32_t ready;
+    hg_atomic_int32_t errors;
+};
+
+struct concurrent_thread_args {
+    struct concurrent_args *concurrent_args;
+    unsigned int id;
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -53,6 +69,9 @@ hg_test_mem_pool_deregister(void *handle, void *arg);
 static void
 hg_test_mem_pool_alloc(struct hg_mem_pool *hg_mem_pool, int mr);
 
+static int
+hg_test_mem_pool_concurrent(struct hg_mem_pool *hg_mem_pool);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -137,6 +156,85 @@ hg_test_mem_pool_alloc(struct hg_mem_pool *hg_mem_pool, int mr)
     }
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_test_concurrent_thread(void *arg)
+{
+    struct concurrent_thread_args *thread_args =
+        (struct concurrent_thread_args *) arg;
+    struct concurrent_args *concurrent_args = thread_args->concurrent_args;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+    void *mem_ptrs[CONCURRENT_BATCH], *mr_handles[CONCURRENT_BATCH];
+    int i, j;
+
+    /* Start all threads at once */
+    hg_atomic_incr32(&concurrent_args->ready);
+    while (hg_atomic_get32(&concurrent_args->ready) !=
+           HG_TEST_NUM_THREADS_DEFAULT)
+        hg_thread_yield();
+
+    for (i = 0; i < CONCURRENT_OPS / CONCURRENT_BATCH; i++) {
+        for (j = 0; j < CONCURRENT_BATCH; j++) {
+            mem_ptrs[j] = hg_mem_pool_alloc(
+                concurrent_args->mem_pool, CHUNK_SIZE1, &mr_handles[j]);
+            if (mem_ptrs[j] == NULL)
+                goto error;
+            *(unsigned int *) mem_ptrs[j] = thread_args->id;
+        }
+
+        /* Chunks must not have been given out twice */
+        for (j = 0; j < CONCURRENT_BATCH; j++)
+            if (*(unsigned int *) mem_ptrs[j] != thread_args->id)
+                hg_atomic_incr32(&concurrent_args->errors);
+
+        for (j = 0; j < CONCURRENT_BATCH; j++)
+            hg_mem_pool_free(
+                concurrent_args->mem_pool, mem_ptrs[j], mr_handles[j]);
+    }
+
+    hg_thread_exit(thread_ret);
+    return thread_ret;
+
+error:
+    hg_atomic_incr32(&concurrent_args->errors);
+    while (j-- > 0)
+        hg_mem_pool_free(concurrent_args->mem_pool, mem_ptrs[j], mr_handles[j]);
+
+    hg_thread_exit(thread_ret);
+    return thread_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_test_mem_pool_concurrent(struct hg_mem_pool *hg_mem_pool)
+{
+    struct concurrent_args concurrent_args;
+    struct concurrent_thread_args thread_args[HG_TEST_NUM_THREADS_DEFAULT];
+    hg_thread_t threads[HG_TEST_NUM_THREADS_DEFAULT];
+    unsigned int i;
+
+    concurrent_args.mem_pool = hg_mem_pool;
+    hg_atomic_init32(&concurrent_args.ready, 0);
+    hg_atomic_init32(&concurrent_args.errors, 0);
+
+    for (i = 0; i < HG_TEST_NUM_THREADS_DEFAULT; i++) {
+        thread_args[i].concurrent_args = &concurrent_args;
+        thread_args[i].id = i + 1;
+        hg_thread_create(
+            &threads[i], hg_test_concurrent_thread, &thread_args[i]);
+    }
+    for (i = 0; i < HG_TEST_NUM_THREADS_DEFAULT; i++)
+        hg_thread_join(threads[i]);
+
+    if (hg_atomic_get32(&concurrent_args.errors) > 0) {
+        fprintf(stderr, "Error: %d chunk(s) were corrupted or not allocated\n",
+            (int) hg_atomic_get32(&concurrent_args.errors));
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(void)
@@ -187,6 +285,19 @@ main(void)
             (int) hg_atomic_get32(&thread_args.n_mr));
     }
 
+    /* Concurrent allocations must never share a chunk */
+    thread_args.mem_pool = hg_mem_pool_create(CHUNK_SIZE1,
+        CONCURRENT_CHUNK_COUNT, BLOCK_COUNT1, hg_test_mem_pool_register, 0,
+        hg_test_mem_pool_deregister, &thread_args.n_mr);
+    if (thread_args.mem_pool == NULL) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    ret = hg_test_mem_pool_concurrent(thread_args.mem_pool);
+
+    hg_mem_pool_destroy(thread_args.mem_pool);
+
 done:
     hg_thread_mutex_destroy(&thread_args.mutex);
     hg_thread_cond_destroy(&thread_args.cond);
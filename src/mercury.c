@@ -29,6 +29,18 @@
 #define HG_HANDLE_CLASS(handle)                                                \
     ((struct hg_private_class *) ((handle)->info.hg_class))
 
+#define HG_HANDLE_CONTEXT(handle)                                              \
+    ((struct hg_private_context *) ((handle)->info.context))
+
+/* Size classes of pooled extra payload buffers (4 KB to 1 MB) */
+#define HG_EXTRA_BUF_SHIFT_MIN (12)
+#define HG_EXTRA_BUF_SHIFT_MAX (20)
+#define HG_EXTRA_BUF_CLASS_COUNT                                               \
+    (HG_EXTRA_BUF_SHIFT_MAX - HG_EXTRA_BUF_SHIFT_MIN + 1)
+
+/* Max number of idle buffers kept per size class */
+#define HG_EXTRA_BUF_CLASS_MAX (8)
+
 /* Name of this subsystem */
 #define HG_SUBSYS_NAME        hg
 #define HG_STRINGIFY(x)       HG_UTIL_STRINGIFY(x)
@@ -46,6 +58,33 @@ struct hg_private_class {
     hg_checksum_level_t checksum_level;                /* Checksum level */
     hg_bool_t bulk_eager;                              /* Eager bulk proc */
     hg_bool_t release_input_early;                     /* Release input early */
+    hg_bool_t zero_copy_input;                         /* Borrow input data */
+};
+
+/* Pooled extra payload buffer */
+struct hg_extra_buf {
+    HG_LIST_ENTRY(hg_extra_buf) entry; /* Entry in pool free list */
+    struct hg_extra_buf_pool *pool;     /* Pool that buffer belongs to */
+    void *buf;                          /* Payload buffer */
+    hg_bulk_t bulk;                     /* Bulk handle for buffer */
+    unsigned int class_id;              /* Size class */
+};
+
+/* Pool of extra payload buffers */
+struct hg_extra_buf_pool {
+    HG_LIST_HEAD(hg_extra_buf) free_lists[HG_EXTRA_BUF_CLASS_COUNT];
+    unsigned int free_counts[HG_EXTRA_BUF_CLASS_COUNT]; /* Idle buffers */
+    hg_class_t *hg_class;                                /* HG class */
+    hg_thread_spin_t lock;                               /* Pool lock */
+    hg_uint8_t flags;                                    /* Bulk permission */
+    hg_bool_t keep_bulk;                                 /* Keep idle bulk */
+};
+
+/* HG context */
+struct hg_private_context {
+    struct hg_context context; /* Must remain as first field */
+    struct hg_extra_buf_pool expose_buf_pool; /* Buffers exposed to targets */
+    struct hg_extra_buf_pool pull_buf_pool;   /* Buffers pulled into */
 };
 
 /* Info for function map */
@@ -74,6 +113,8 @@ struct hg_private_handle {
     hg_proc_t out_proc;                 /* Proc for output */
     hg_bulk_t in_extra_bulk;            /* Extra input bulk handle */
     hg_bulk_t out_extra_bulk;           /* Extra output bulk handle */
+    struct hg_extra_buf *in_extra_pool_buf;  /* Pooled extra input buffer */
+    struct hg_extra_buf *out_extra_pool_buf; /* Pooled extra output buffer */
     hg_size_t in_extra_buf_size;        /* Extra input buffer size */
     hg_size_t out_extra_buf_size;       /* Extra output buffer size */
     hg_bool_t use_checksums;            /* Handle uses checksums */
@@ -188,6 +229,49 @@ hg_get_extra_payload_cb(const struct hg_cb_info *callback_info);
 static void
 hg_free_extra_payload(struct hg_private_handle *hg_handle);
 
+/**
+ * Free extra payload of a given op.
+ */
+static void
+hg_free_extra_buf(void **extra_buf, hg_size_t *extra_buf_size,
+    hg_bulk_t *extra_bulk, struct hg_extra_buf **extra_pool_buf);
+
+/**
+ * Initialize pool of extra payload buffers. Buffers are registered with the
+ * given permission flags. Buffers of pools that do not keep their bulk handle
+ * are deregistered when released so that no memory stays exposed between
+ * RPCs.
+ */
+static void
+hg_extra_buf_pool_init(struct hg_extra_buf_pool *hg_extra_buf_pool,
+    hg_class_t *hg_class, hg_uint8_t flags, hg_bool_t keep_bulk);
+
+/**
+ * Finalize pool of extra payload buffers.
+ */
+static void
+hg_extra_buf_pool_finalize(struct hg_extra_buf_pool *hg_extra_buf_pool);
+
+/**
+ * Get a registered buffer of at least size bytes from the pool. Returns NULL
+ * if size exceeds the largest size class or on allocation/registration
+ * failure.
+ */
+static struct hg_extra_buf *
+hg_extra_buf_get(struct hg_extra_buf_pool *hg_extra_buf_pool, hg_size_t size);
+
+/**
+ * Release buffer back to its pool.
+ */
+static void
+hg_extra_buf_release(struct hg_extra_buf *hg_extra_buf);
+
+/**
+ * Free buffer.
+ */
+static void
+hg_extra_buf_free(struct hg_extra_buf *hg_extra_buf);
+
 /**
  * Forward callback.
  */
@@ -530,6 +614,10 @@ hg_get_struct(struct hg_private_handle *hg_handle,
     ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
     HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not reset proc");
 
+    /* Let proc routines borrow input data directly from the buffer */
+    if (op == HG_INPUT && HG_HANDLE_CLASS(&hg_handle->handle)->zero_copy_input)
+        hg_proc_set_flags(proc, HG_PROC_ZERO_COPY);
+
     /* Decode parameters */
     ret = proc_cb(proc, struct_ptr);
     HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not decode parameters");
@@ -550,9 +638,12 @@ hg_get_struct(struct hg_private_handle *hg_handle,
 
 #ifndef HG_HAS_XDR
     if (HG_HANDLE_CLASS(&hg_handle->handle)->release_input_early &&
-        op == HG_INPUT) {
+        op == HG_INPUT &&
+        !(HG_HANDLE_CLASS(&hg_handle->handle)->zero_copy_input &&
+            extra_buf == NULL)) {
         /* Now that the parameters have been decoded, release the buffer so it
-         * can be re-used while the RPC is being executed. */
+         * can be re-used while the RPC is being executed. Borrowed input data
+         * must remain valid until HG_Free_input() is called. */
         ret = HG_Core_release_input(hg_handle->handle.core_handle);
         HG_CHECK_SUBSYS_HG_ERROR(
             rpc, error, ret, "Could not release input buffer");
@@ -581,6 +672,7 @@ hg_set_struct(struct hg_private_handle *hg_handle,
     void *buf, **extra_buf;
     hg_size_t buf_size, *extra_buf_size;
     hg_bulk_t *extra_bulk;
+    struct hg_extra_buf **extra_pool_buf;
     struct hg_header *hg_header = &hg_handle->hg_header;
 #ifdef HG_HAS_CHECKSUMS
     struct hg_header_hash *hg_header_hash = NULL;
@@ -608,6 +700,7 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+            extra_pool_buf = &hg_handle->in_extra_pool_buf;
             break;
         case HG_OUTPUT:
             /* Cannot respond if no_response flag set */
@@ -633,6 +726,7 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+            extra_pool_buf = &hg_handle->out_extra_pool_buf;
             break;
         default:
             HG_GOTO_SUBSYS_ERROR(
@@ -694,24 +788,39 @@ hg_set_struct(struct hg_private_handle *hg_handle,
      * it to retrieve the data.
      */
     if (hg_proc_get_extra_buf(proc)) {
-        /* Potentially free previous payload if handle was not reset */
-        hg_free_extra_payload(hg_handle);
+        /* Potentially free previous payload if handle was not reset, only
+         * for that op as decoded input may still reference its payload */
+        hg_free_extra_buf(
+            extra_buf, extra_buf_size, extra_bulk, extra_pool_buf);
 #ifdef HG_HAS_XDR
         HG_GOTO_SUBSYS_ERROR(rpc, error, ret, HG_OVERFLOW,
             "Arguments overflow is not supported with XDR");
 #endif
         /* Create a bulk descriptor only of the size that is used */
-        *extra_buf = hg_proc_get_extra_buf(proc);
         *extra_buf_size = hg_proc_get_size_used(proc);
 
-        /* Prevent buffer from being freed when proc_reset is called */
-        hg_proc_set_extra_buf_is_mine(proc, HG_TRUE);
-
-        /* Create bulk descriptor */
-        ret = HG_Bulk_create(hg_handle->handle.info.hg_class, 1, extra_buf,
-            extra_buf_size, HG_BULK_READ_ONLY, extra_bulk);
-        HG_CHECK_SUBSYS_HG_ERROR(
-            rpc, error, ret, "Could not create bulk data handle");
+        /* Copying the payload into a pre-registered buffer is cheaper than
+         * registering the proc buffer, fall back to that if too large */
+        *extra_pool_buf = hg_extra_buf_get(
+            &HG_HANDLE_CONTEXT(&hg_handle->handle)->expose_buf_pool,
+            *extra_buf_size);
+        if (*extra_pool_buf) {
+            *extra_buf = (*extra_pool_buf)->buf;
+            *extra_bulk = (*extra_pool_buf)->bulk;
+            memcpy(*extra_buf, hg_proc_get_extra_buf(proc),
+                (size_t) *extra_buf_size);
+        } else {
+            *extra_buf = hg_proc_get_extra_buf(proc);
+
+            /* Prevent buffer from being freed when proc_reset is called */
+            hg_proc_set_extra_buf_is_mine(proc, HG_TRUE);
+
+            /* Create bulk descriptor */
+            ret = HG_Bulk_create(hg_handle->handle.info.hg_class, 1, extra_buf,
+                extra_buf_size, HG_BULK_READ_ONLY, extra_bulk);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                rpc, error, ret, "Could not create bulk data handle");
+        }
 
         /* Reset proc */
         ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
@@ -741,6 +850,11 @@ hg_set_struct(struct hg_private_handle *hg_handle,
         HG_CHECK_SUBSYS_HG_ERROR(
             rpc, error, ret, "Could not process extra bulk handle");
 
+        /* Pooled buffers may be larger than the payload */
+        ret = hg_proc_hg_size_t(proc, extra_buf_size);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            rpc, error, ret, "Could not process extra payload size");
+
         ret = hg_proc_flush(proc);
         HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Error in proc flush");
 
@@ -826,6 +940,10 @@ hg_free_struct(struct hg_private_handle *hg_handle,
     ret = hg_proc_reset(proc, buf, buf_size, HG_FREE);
     HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not reset proc");
 
+    /* Borrowed input data must not be freed */
+    if (op == HG_INPUT && HG_HANDLE_CLASS(&hg_handle->handle)->zero_copy_input)
+        hg_proc_set_flags(proc, HG_PROC_ZERO_COPY);
+
     /* Free memory allocated during decode operation */
     ret = proc_cb(proc, struct_ptr);
     HG_CHECK_SUBSYS_HG_ERROR(
@@ -853,9 +971,10 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
     void *buf, **extra_buf;
     hg_size_t buf_size, *extra_buf_size;
     hg_bulk_t *extra_bulk = NULL;
+    struct hg_extra_buf **extra_pool_buf;
     hg_size_t header_offset = hg_header_get_size(op);
     hg_size_t page_size = (hg_size_t) hg_mem_get_page_size();
-    hg_bulk_t local_handle = HG_BULK_NULL;
+    hg_bulk_t local_handle = HG_BULK_NULL, local_bulk;
     hg_return_t ret = HG_SUCCESS;
 
     switch (op) {
@@ -873,6 +992,7 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+            extra_pool_buf = &hg_handle->in_extra_pool_buf;
             break;
         case HG_OUTPUT:
             /* Use custom header offset */
@@ -888,6 +1008,7 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+            extra_pool_buf = &hg_handle->out_extra_pool_buf;
             break;
         default:
             HG_GOTO_SUBSYS_ERROR(
@@ -906,25 +1027,45 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
     HG_CHECK_SUBSYS_HG_ERROR(
         rpc, done, ret, "Could not process extra bulk handle");
 
+    ret = hg_proc_hg_size_t(proc, extra_buf_size);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        rpc, done, ret, "Could not process extra payload size");
+
     ret = hg_proc_flush(proc);
     HG_CHECK_SUBSYS_HG_ERROR(rpc, done, ret, "Error in proc flush");
 
-    /* Create a new local handle to read the data */
-    *extra_buf_size = HG_Bulk_get_size(*extra_bulk);
-    *extra_buf = hg_mem_aligned_alloc(page_size, *extra_buf_size);
-    HG_CHECK_SUBSYS_ERROR(rpc, *extra_buf == NULL, done, ret, HG_NOMEM,
-        "Could not allocate extra payload buffer");
+    HG_CHECK_SUBSYS_ERROR(rpc,
+        *extra_buf_size == 0 ||
+            *extra_buf_size > HG_Bulk_get_size(*extra_bulk),
+        done, ret, HG_PROTOCOL_ERROR,
+        "Invalid extra payload size (%" PRIu64 ")", *extra_buf_size);
+
+    /* Use a pre-registered buffer if possible or create a new local handle
+     * to read the data */
+    *extra_pool_buf = hg_extra_buf_get(
+        &HG_HANDLE_CONTEXT(&hg_handle->handle)->pull_buf_pool,
+        *extra_buf_size);
+    if (*extra_pool_buf) {
+        *extra_buf = (*extra_pool_buf)->buf;
+        local_bulk = (*extra_pool_buf)->bulk;
+    } else {
+        *extra_buf = hg_mem_aligned_alloc(page_size, *extra_buf_size);
+        HG_CHECK_SUBSYS_ERROR(rpc, *extra_buf == NULL, done, ret, HG_NOMEM,
+            "Could not allocate extra payload buffer");
 
-    ret = HG_Bulk_create(hg_handle->handle.info.hg_class, 1, extra_buf,
-        extra_buf_size, HG_BULK_READWRITE, &local_handle);
-    HG_CHECK_SUBSYS_HG_ERROR(rpc, done, ret, "Could not create HG bulk handle");
+        ret = HG_Bulk_create(hg_handle->handle.info.hg_class, 1, extra_buf,
+            extra_buf_size, HG_BULK_WRITE_ONLY, &local_handle);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            rpc, done, ret, "Could not create HG bulk handle");
+        local_bulk = local_handle;
+    }
 
     /* Read bulk data here and wait for the data to be here  */
     hg_handle->extra_bulk_transfer_cb = done_cb;
     ret = HG_Bulk_transfer_id(hg_handle->handle.info.context,
         hg_get_extra_payload_cb, hg_handle, HG_BULK_PULL,
         (hg_addr_t) hg_core_info->addr, hg_core_info->context_id, *extra_bulk,
-        0, local_handle, 0, *extra_buf_size,
+        0, local_bulk, 0, *extra_buf_size,
         HG_OP_ID_IGNORE /* TODO not used for now */);
     HG_CHECK_SUBSYS_HG_ERROR(rpc, done, ret, "Could not transfer bulk data");
 
@@ -955,21 +1096,164 @@ static void
 hg_free_extra_payload(struct hg_private_handle *hg_handle)
 {
     /* Free extra bulk buf if there was any */
-    if (hg_handle->in_extra_buf) {
-        HG_Bulk_free(hg_handle->in_extra_bulk);
-        hg_handle->in_extra_bulk = HG_BULK_NULL;
-        hg_mem_aligned_free(hg_handle->in_extra_buf);
-        hg_handle->in_extra_buf = NULL;
-        hg_handle->in_extra_buf_size = 0;
+    hg_free_extra_buf(&hg_handle->in_extra_buf, &hg_handle->in_extra_buf_size,
+        &hg_handle->in_extra_bulk, &hg_handle->in_extra_pool_buf);
+    hg_free_extra_buf(&hg_handle->out_extra_buf,
+        &hg_handle->out_extra_buf_size, &hg_handle->out_extra_bulk,
+        &hg_handle->out_extra_pool_buf);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_free_extra_buf(void **extra_buf, hg_size_t *extra_buf_size,
+    hg_bulk_t *extra_bulk, struct hg_extra_buf **extra_pool_buf)
+{
+    if (*extra_buf == NULL)
+        return;
+
+    /* Pooled buffers are released to their pool */
+    if (*extra_pool_buf) {
+        hg_extra_buf_release(*extra_pool_buf);
+        *extra_pool_buf = NULL;
+    } else {
+        HG_Bulk_free(*extra_bulk);
+        hg_mem_aligned_free(*extra_buf);
+    }
+    *extra_bulk = HG_BULK_NULL;
+    *extra_buf = NULL;
+    *extra_buf_size = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_extra_buf_pool_init(struct hg_extra_buf_pool *hg_extra_buf_pool,
+    hg_class_t *hg_class, hg_uint8_t flags, hg_bool_t keep_bulk)
+{
+    unsigned int i;
+
+    for (i = 0; i < HG_EXTRA_BUF_CLASS_COUNT; i++) {
+        HG_LIST_INIT(&hg_extra_buf_pool->free_lists[i]);
+        hg_extra_buf_pool->free_counts[i] = 0;
+    }
+    hg_extra_buf_pool->hg_class = hg_class;
+    hg_extra_buf_pool->flags = flags;
+    hg_extra_buf_pool->keep_bulk = keep_bulk;
+    hg_thread_spin_init(&hg_extra_buf_pool->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_extra_buf_pool_finalize(struct hg_extra_buf_pool *hg_extra_buf_pool)
+{
+    unsigned int i;
+
+    for (i = 0; i < HG_EXTRA_BUF_CLASS_COUNT; i++) {
+        struct hg_extra_buf *hg_extra_buf;
+
+        while ((hg_extra_buf =
+                    HG_LIST_FIRST(&hg_extra_buf_pool->free_lists[i]))) {
+            HG_LIST_REMOVE(hg_extra_buf, entry);
+            hg_extra_buf_free(hg_extra_buf);
+        }
+        hg_extra_buf_pool->free_counts[i] = 0;
+    }
+    hg_thread_spin_destroy(&hg_extra_buf_pool->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_extra_buf *
+hg_extra_buf_get(struct hg_extra_buf_pool *hg_extra_buf_pool, hg_size_t size)
+{
+    struct hg_extra_buf *hg_extra_buf;
+    unsigned int class_id = 0;
+    hg_size_t buf_size;
+    hg_return_t ret;
+
+    if (size > ((hg_size_t) 1 << HG_EXTRA_BUF_SHIFT_MAX))
+        return NULL;
+    while (((hg_size_t) 1 << (HG_EXTRA_BUF_SHIFT_MIN + class_id)) < size)
+        class_id++;
+
+    hg_thread_spin_lock(&hg_extra_buf_pool->lock);
+    hg_extra_buf = HG_LIST_FIRST(&hg_extra_buf_pool->free_lists[class_id]);
+    if (hg_extra_buf) {
+        HG_LIST_REMOVE(hg_extra_buf, entry);
+        hg_extra_buf_pool->free_counts[class_id]--;
+    }
+    hg_thread_spin_unlock(&hg_extra_buf_pool->lock);
+    buf_size = (hg_size_t) 1 << (HG_EXTRA_BUF_SHIFT_MIN + class_id);
+
+    if (hg_extra_buf == NULL) {
+        /* Allocate a new buffer for that size class */
+        hg_extra_buf =
+            (struct hg_extra_buf *) calloc(1, sizeof(*hg_extra_buf));
+        HG_CHECK_SUBSYS_ERROR_NORET(
+            rpc, hg_extra_buf == NULL, error, "Could not allocate extra buf");
+        hg_extra_buf->pool = hg_extra_buf_pool;
+        hg_extra_buf->class_id = class_id;
+        hg_extra_buf->bulk = HG_BULK_NULL;
+
+        hg_extra_buf->buf =
+            hg_mem_aligned_alloc((size_t) hg_mem_get_page_size(), buf_size);
+        HG_CHECK_SUBSYS_ERROR_NORET(rpc, hg_extra_buf->buf == NULL, error,
+            "Could not allocate extra payload buffer");
+    } else if (hg_extra_buf->bulk != HG_BULK_NULL)
+        return hg_extra_buf;
+
+    ret = HG_Bulk_create(hg_extra_buf_pool->hg_class, 1, &hg_extra_buf->buf,
+        &buf_size, hg_extra_buf_pool->flags, &hg_extra_buf->bulk);
+    HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret,
+        "Could not create bulk handle for extra payload buffer (%s)",
+        HG_Error_to_string(ret));
+
+    HG_LOG_SUBSYS_DEBUG(rpc,
+        "Registered extra payload buffer (%p, %" PRIu64 " bytes)",
+        hg_extra_buf->buf, buf_size);
+
+    return hg_extra_buf;
+
+error:
+    if (hg_extra_buf) {
+        hg_extra_buf->bulk = HG_BULK_NULL;
+        hg_extra_buf_free(hg_extra_buf);
+    }
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_extra_buf_release(struct hg_extra_buf *hg_extra_buf)
+{
+    struct hg_extra_buf_pool *hg_extra_buf_pool = hg_extra_buf->pool;
+    unsigned int class_id = hg_extra_buf->class_id;
+
+    /* Do not leave buffers that were exposed to remote peers registered */
+    if (!hg_extra_buf_pool->keep_bulk) {
+        HG_Bulk_free(hg_extra_buf->bulk);
+        hg_extra_buf->bulk = HG_BULK_NULL;
     }
 
-    if (hg_handle->out_extra_buf) {
-        HG_Bulk_free(hg_handle->out_extra_bulk);
-        hg_handle->out_extra_bulk = HG_BULK_NULL;
-        hg_mem_aligned_free(hg_handle->out_extra_buf);
-        hg_handle->out_extra_buf = NULL;
-        hg_handle->out_extra_buf_size = 0;
+    hg_thread_spin_lock(&hg_extra_buf_pool->lock);
+    if (hg_extra_buf_pool->free_counts[class_id] < HG_EXTRA_BUF_CLASS_MAX) {
+        HG_LIST_INSERT_HEAD(
+            &hg_extra_buf_pool->free_lists[class_id], hg_extra_buf, entry);
+        hg_extra_buf_pool->free_counts[class_id]++;
+        hg_extra_buf = NULL;
     }
+    hg_thread_spin_unlock(&hg_extra_buf_pool->lock);
+
+    /* Too many idle buffers of that size */
+    if (hg_extra_buf)
+        hg_extra_buf_free(hg_extra_buf);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_extra_buf_free(struct hg_extra_buf *hg_extra_buf)
+{
+    HG_Bulk_free(hg_extra_buf->bulk);
+    hg_mem_aligned_free(hg_extra_buf->buf);
+    free(hg_extra_buf);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1072,6 +1356,14 @@ HG_Init_opt(const char *na_info_string, hg_bool_t na_listen,
     hg_class->release_input_early =
         (hg_init_info) ? hg_init_info->release_input_early : HG_FALSE;
 
+    /* Zero-copy input decoding */
+    hg_class->zero_copy_input =
+        (hg_init_info) ? hg_init_info->zero_copy_input : HG_FALSE;
+#ifdef HG_HAS_XDR
+    HG_CHECK_SUBSYS_WARNING(cls, hg_class->zero_copy_input,
+        "Option zero_copy_input is ignored when XDR encoding is used.");
+#endif
+
     hg_class->hg_class.core_class =
         HG_Core_init_opt(na_info_string, na_listen, hg_init_info);
     HG_CHECK_SUBSYS_ERROR_NORET(cls, hg_class->hg_class.core_class == NULL,
@@ -1189,18 +1481,35 @@ HG_Context_create(hg_class_t *hg_class)
 hg_context_t *
 HG_Context_create_id(hg_class_t *hg_class, hg_uint8_t id)
 {
+    return HG_Context_create_id_opt(hg_class, id, NULL);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_context_t *
+HG_Context_create_id_opt(hg_class_t *hg_class, hg_uint8_t id,
+    const struct hg_context_init_info *hg_context_init_info)
+{
+    struct hg_private_context *hg_private_context = NULL;
     struct hg_context *hg_context = NULL;
     hg_return_t ret;
 
     HG_CHECK_SUBSYS_ERROR_NORET(ctx, hg_class == NULL, error, "NULL HG class");
 
-    hg_context = calloc(1, sizeof(*hg_context));
-    HG_CHECK_SUBSYS_ERROR_NORET(
-        ctx, hg_context == NULL, error, "Could not allocate HG context");
+    hg_private_context =
+        (struct hg_private_context *) calloc(1, sizeof(*hg_private_context));
+    HG_CHECK_SUBSYS_ERROR_NORET(ctx, hg_private_context == NULL, error,
+        "Could not allocate HG context");
+    hg_context = &hg_private_context->context;
+    /* Exposed buffers are only ever pulled from by targets, buffers that are
+     * pulled into are never advertised and can remain registered */
+    hg_extra_buf_pool_init(&hg_private_context->expose_buf_pool, hg_class,
+        HG_BULK_READ_ONLY, HG_FALSE);
+    hg_extra_buf_pool_init(&hg_private_context->pull_buf_pool, hg_class,
+        HG_BULK_WRITE_ONLY, HG_TRUE);
 
     hg_context->hg_class = hg_class;
-    hg_context->core_context =
-        HG_Core_context_create_id(hg_class->core_class, id);
+    hg_context->core_context = HG_Core_context_create_id_opt(
+        hg_class->core_class, id, hg_context_init_info);
     HG_CHECK_SUBSYS_ERROR_NORET(ctx, hg_context->core_context == NULL, error,
         "Could not create context for ID %u", id);
 
@@ -1218,10 +1527,12 @@ HG_Context_create_id(hg_class_t *hg_class, hg_uint8_t id)
     return hg_context;
 
 error:
-    if (hg_context) {
+    if (hg_private_context) {
         if (hg_context->core_context)
             (void) HG_Core_context_destroy(hg_context->core_context);
-        free(hg_context);
+        hg_extra_buf_pool_finalize(&hg_private_context->expose_buf_pool);
+        hg_extra_buf_pool_finalize(&hg_private_context->pull_buf_pool);
+        free(hg_private_context);
     }
     return NULL;
 }
@@ -1239,6 +1550,12 @@ HG_Context_destroy(hg_context_t *context)
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret,
         "Could not destroy HG core context (%s)", HG_Error_to_string(ret));
 
+    /* Handles have released their extra payload buffers at this point */
+    hg_extra_buf_pool_finalize(
+        &((struct hg_private_context *) context)->expose_buf_pool);
+    hg_extra_buf_pool_finalize(
+        &((struct hg_private_context *) context)->pull_buf_pool);
+
     free(context);
 
     return HG_SUCCESS;
@@ -2161,6 +2478,26 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Trigger_batch(hg_context_t *context, unsigned int timeout,
+    unsigned int max_count, unsigned int *actual_count_p)
+{
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        poll, context == NULL, done, ret, HG_INVALID_ARG, "NULL HG context");
+
+    ret = HG_Core_trigger_batch(
+        context->core_context, timeout, max_count, actual_count_p);
+    HG_CHECK_SUBSYS_ERROR_NORET(poll, ret != HG_SUCCESS && ret != HG_TIMEOUT,
+        done, "Could not trigger operations from context (%s)",
+        HG_Error_to_string(ret));
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Cancel(hg_handle_t handle)
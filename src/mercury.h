@@ -303,6 +303,23 @@ HG_Context_create(hg_class_t *hg_class);
 HG_PUBLIC hg_context_t *
 HG_Context_create_id(hg_class_t *hg_class, hg_uint8_t id);
 
+/**
+ * Create a new context with a user-defined context identifier and
+ * context-specific options such as the completion queue size or the NUMA node
+ * that context resources are allocated on (see HG_Context_create_id()).
+ * Context must be destroyed by calling HG_Context_destroy().
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               user-defined context ID
+ * \param hg_context_init_info [IN]
+ *                              (Optional) HG context init info, NULL if no info
+ *
+ * \return Pointer to HG context or NULL in case of failure
+ */
+HG_PUBLIC hg_context_t *
+HG_Context_create_id_opt(hg_class_t *hg_class, hg_uint8_t id,
+    const struct hg_context_init_info *hg_context_init_info);
+
 /**
  * Destroy a context created by HG_Context_create().
  *
@@ -357,6 +374,20 @@ HG_Context_set_data(
 static HG_INLINE void *
 HG_Context_get_data(const hg_context_t *context);
 
+/**
+ * Retrieve progress statistics of a context, i.e., the number of times
+ * progress was made while busy-polling versus the number of times progress
+ * had to block (see hg_init_info::progress_spin_time).
+ *
+ * \param context [IN]          pointer to HG context
+ * \param stats_p [OUT]         pointer to progress stats
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+HG_Context_get_progress_stats(
+    hg_context_t *context, struct hg_progress_stats *stats_p);
+
 /**
  * Dynamically register a function func_name as an RPC as well as the
  * RPC callback executed when the RPC request ID associated to func_name is
@@ -736,6 +767,10 @@ HG_Get_data(hg_handle_t handle);
  * release_input_early init info parameter has been set when initializing the
  * HG class.
  *
+ * \remark If the zero_copy_input init info parameter has been set, strings and
+ * byte buffers decoded with hg_proc_bytes_ptr() reference the input buffer
+ * directly and remain valid only until HG_Free_input() is called.
+ *
  * \param handle [IN]           HG handle
  * \param in_struct [IN/OUT]    pointer to input structure
  *
@@ -972,6 +1007,24 @@ HG_PUBLIC hg_return_t
 HG_Trigger(hg_context_t *context, unsigned int timeout, unsigned int max_count,
     unsigned int *actual_count_p);
 
+/**
+ * Execute at most max_count callbacks, similarly to HG_Trigger(), but claim
+ * completed operations in batches and dispatch them grouped by type (RPC,
+ * bulk, then lookup). This reduces synchronization on the completion queue
+ * when many operations complete at once, callbacks of different types may
+ * however not be executed in the order in which operations completed.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param timeout [IN]          timeout (in milliseconds)
+ * \param max_count [IN]        maximum number of callbacks triggered
+ * \param actual_count_p [OUT]  actual number of callbacks triggered
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Trigger_batch(hg_context_t *context, unsigned int timeout,
+    unsigned int max_count, unsigned int *actual_count_p);
+
 /**
  * Cancel an ongoing operation.
  *
@@ -1118,6 +1171,14 @@ HG_Context_get_data(const hg_context_t *context)
     return HG_Core_context_get_data(context->core_context);
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+HG_Context_get_progress_stats(
+    hg_context_t *context, struct hg_progress_stats *stats_p)
+{
+    return HG_Core_context_get_progress_stats(context->core_context, stats_p);
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_return_t
 HG_Ref_incr(hg_handle_t handle)
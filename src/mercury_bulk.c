@@ -12,8 +12,12 @@
 #include "mercury_private.h"
 
 #include "mercury_atomic.h"
+#include "mercury_crc32c.h"
+#include "mercury_hash_table.h"
 #include "mercury_list.h"
 #include "mercury_thread_condition.h"
+#include "mercury_thread_mutex.h"
+#include "mercury_thread_pool.h"
 #include "mercury_thread_spin.h"
 
 #include <stdlib.h>
@@ -26,12 +30,28 @@
 /* Limit for number of segments statically allocated */
 #define HG_BULK_STATIC_MAX (8)
 
+/* Min number of segments for which offsets are translated through an index of
+ * segment end offsets (built on first use) instead of a linear scan */
+#define HG_BULK_OFFSET_INDEX_MIN (64)
+
+/* Max number of NA operations that a bulk transfer keeps in flight (NA op IDs
+ * are preallocated with each bulk op ID and re-used once they complete) */
+#define HG_BULK_OP_WINDOW (HG_BULK_STATIC_MAX)
+
+/* Min size of local copies that are split between the calling thread and the
+ * bulk copy threads (one part per window slot at most) */
+#define HG_BULK_COPY_SPLIT_MIN (1 << 22)
+
 /* Additional internal bulk flags (can hold up to 8 bits) */
 #define HG_BULK_ALLOC (1 << 4) /* memory is allocated */
 #define HG_BULK_BIND  (1 << 5) /* address is bound to segment */
 #define HG_BULK_REGV  (1 << 6) /* single registration for multiple segments */
 #define HG_BULK_VIRT  (1 << 7) /* addresses are virtual */
 
+/* Descriptor layouts */
+#define HG_BULK_LAYOUT_SEGMENTS (0) /* explicit list of segments */
+#define HG_BULK_LAYOUT_STRIDED  (1) /* blocks at regular stride */
+
 /* Op ID status bits */
 #define HG_BULK_OP_COMPLETED (1 << 0)
 #define HG_BULK_OP_CANCELED  (1 << 1)
@@ -87,13 +107,6 @@
     (count > HG_BULK_STATIC_MAX && !(flags & HG_BULK_REGV)) ? (x)->handles.d   \
                                                             : (x)->handles.s
 
-#define HG_BULK_NA_OP_IDS(x)                                                   \
-    ((x)->op_count > HG_BULK_STATIC_MAX) ? (x)->na_op_ids.d : (x)->na_op_ids.s
-
-#define HG_BULK_NA_SM_OP_IDS(x)                                                \
-    ((x)->op_count > HG_BULK_STATIC_MAX) ? (x)->na_sm_op_ids.d                 \
-                                         : (x)->na_sm_op_ids.s
-
 /* Check permission flags */
 #define HG_BULK_CHECK_FLAGS(op, origin_flags, local_flags, label, ret)         \
     switch (op) {                                                              \
@@ -140,10 +153,18 @@ struct hg_bulk_segment {
     hg_size_t len; /* Size of the segment in bytes */
 };
 
+/* HG bulk stride (blocks laid out within the first and only segment) */
+struct hg_bulk_stride {
+    hg_size_t block_len; /* Size of each block */
+    hg_size_t stride;    /* Distance between start of blocks */
+    hg_uint32_t count;   /* Number of blocks */
+};
+
 /* HG bulk descriptor (cannot use flexible array members because count of
  * segments may not match count of handles) */
 struct hg_bulk_desc {
     struct hg_bulk_desc_info info; /* Segment info */
+    struct hg_bulk_stride stride;  /* Stride (if strided layout) */
     union {
         struct hg_bulk_segment s[HG_BULK_STATIC_MAX]; /* Static array */
         struct hg_bulk_segment *d;                    /* Dynamic array */
@@ -174,20 +195,93 @@ struct hg_bulk {
 #ifdef NA_HAS_SM
     na_class_t *na_sm_class; /* NA SM class */
 #endif
-    struct hg_bulk_attr attrs;   /* Memory attributes */
-    hg_core_addr_t addr;         /* Addr (valid if bound to handle) */
-    void *serialize_ptr;         /* Cached serialization buffer */
-    hg_size_t serialize_size;    /* Cached serialization size */
-    hg_atomic_int32_t ref_count; /* Reference count */
-    hg_uint8_t context_id;       /* Context ID (valid if bound to handle) */
-    hg_bool_t registered;        /* Handle was registered */
+    struct hg_bulk_reg_cache *reg_cache; /* Registration cache (optional) */
+    struct hg_bulk_attr attrs;      /* Memory attributes */
+    hg_core_addr_t addr;            /* Addr (valid if bound to handle) */
+    void *serialize_ptr;            /* Cached serialization buffer */
+    hg_size_t serialize_size;       /* Cached serialization size */
+    hg_atomic_int64_t offset_index; /* End offset of segments (optional) */
+    hg_atomic_int32_t ref_count;    /* Reference count */
+    hg_uint8_t context_id;          /* Context ID (valid if bound to handle) */
+    hg_bool_t registered;           /* Handle was registered */
+};
+
+/* Wrapper on top of memcpy (returns CRC updated with copied data if used) */
+typedef hg_uint32_t (*hg_bulk_copy_op_t)(hg_ptr_t local_address,
+    hg_size_t local_offset, hg_ptr_t remote_address, hg_size_t remote_offset,
+    hg_size_t data_size, hg_uint32_t crc);
+
+/* Wrapper on top of NA layer */
+typedef na_return_t (*na_bulk_op_t)(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t *local_mem_handle,
+    na_offset_t local_offset, na_mem_handle_t *remote_mem_handle,
+    na_offset_t remote_offset, size_t data_size, na_addr_t *remote_addr,
+    uint8_t remote_id, na_op_id_t *op_id);
+
+/* HG bulk cursor (position within the segments of a handle) */
+struct hg_bulk_cursor {
+    struct hg_bulk_segment block;           /* Block if strided or contig */
+    const struct hg_bulk_segment *segments; /* Segments */
+    hg_size_t stride;                       /* Block stride (0 if unused) */
+    hg_size_t index;                        /* Current segment */
+    hg_size_t offset;                       /* Offset in current segment */
+    hg_uint32_t count;                      /* Segment count */
+};
+
+/* HG bulk NA chunk (single NA operation) */
+struct hg_bulk_na_chunk {
+    const struct hg_bulk_xfer_entry *entry; /* Transfer entry of chunk */
+    na_mem_handle_t *origin_mem_handle;     /* Origin NA mem handle */
+    na_mem_handle_t *local_mem_handle;      /* Local NA mem handle */
+    hg_size_t origin_offset;                /* Offset in origin mem handle */
+    hg_size_t local_offset;                 /* Offset in local mem handle */
+    hg_size_t entry_offset;                 /* Offset in transfer entry */
+    hg_size_t size;                         /* Size of chunk */
+};
+
+/* HG bulk NA op (slot of the transfer window) */
+struct hg_bulk_na_op {
+    struct hg_bulk_na_chunk chunk;       /* Chunk in flight */
+    struct hg_bulk_op_id *hg_bulk_op_id; /* Parent bulk op ID */
+    na_op_id_t *na_op_id;                /* NA op ID used by that slot */
+};
+
+/* HG bulk transfer entry (one transfer of a transfer list) */
+struct hg_bulk_xfer_entry {
+    struct hg_bulk *origin;  /* Origin handle */
+    struct hg_bulk *local;   /* Local handle */
+    hg_size_t origin_offset; /* Offset in origin handle */
+    hg_size_t local_offset;  /* Offset in local handle */
+    hg_size_t size;          /* Size left to transfer through NA */
+    hg_size_t position;      /* Position of entry in transfer */
+};
+
+/* HG bulk NA transfer (position shared by all slots of the window) */
+struct hg_bulk_na_xfer {
+    struct hg_bulk_cursor origin;             /* Position in origin */
+    struct hg_bulk_cursor local;              /* Position in local */
+    const struct hg_bulk_xfer_entry *entries; /* Transfer entries */
+    na_mem_handle_t **origin_mem_handles;     /* Origin NA mem handles */
+    na_mem_handle_t **local_mem_handles;      /* Local NA mem handles */
+    na_addr_t *origin_addr;                   /* Origin NA address */
+    na_bulk_op_t na_bulk_op;                  /* NA put or get */
+    hg_size_t remaining_size;                 /* Size left to issue */
+    hg_size_t chunk_size;                     /* Max size of NA ops */
+    hg_thread_spin_t lock;                    /* Lock for position */
+    hg_uint32_t entry_count;                  /* Number of entries */
+    hg_uint32_t entry_index;                  /* Next entry to issue */
+    hg_uint8_t origin_id;                     /* Origin context ID */
+    hg_bool_t sm;                             /* Use NA SM mem handles */
 };
 
-/* HG bulk NA op IDs (not a union as we re-use op IDs) */
-typedef struct {
-    na_op_id_t *s[HG_BULK_STATIC_MAX]; /* Static array */
-    na_op_id_t **d;                    /* Dynamic array */
-} hg_bulk_na_op_id_t;
+/* HG bulk copy part (share of a local copy, uses one window slot) */
+struct hg_bulk_copy_part {
+    struct hg_thread_work thread_work;   /* Thread pool work */
+    struct hg_bulk_op_id *hg_bulk_op_id; /* Parent bulk op ID */
+    hg_size_t offset;                    /* Offset in first entry */
+    hg_size_t size;                      /* Size of part */
+    hg_uint32_t entry_index;             /* First entry of part */
+};
 
 /* HG Bulk op ID */
 struct hg_bulk_op_id {
@@ -197,19 +291,61 @@ struct hg_bulk_op_id {
     HG_LIST_ENTRY(hg_bulk_op_id) pending; /* Pending list entry */
     struct hg_bulk_op_pool *op_pool;      /* Pool that op ID belongs to */
     hg_cb_t callback;                     /* Pointer to function */
-    hg_bulk_na_op_id_t na_op_ids;         /* NA operations IDs */
+    na_op_id_t *na_op_ids[HG_BULK_OP_WINDOW]; /* NA operations IDs */
 #ifdef NA_HAS_SM
-    hg_bulk_na_op_id_t na_sm_op_ids; /* NA SM operations IDs */
+    na_op_id_t *na_sm_op_ids[HG_BULK_OP_WINDOW]; /* NA SM operations IDs */
 #endif
-    hg_core_context_t *core_context;      /* Context */
-    na_class_t *na_class;                 /* NA class */
-    na_context_t *na_context;             /* NA context */
-    hg_atomic_int32_t status;             /* Operation status */
-    hg_atomic_int32_t ret_status;         /* Return status */
-    hg_atomic_int32_t op_completed_count; /* Number of operations completed */
-    hg_atomic_int32_t ref_count;          /* Refcount */
-    hg_uint32_t op_count;                 /* Number of ongoing operations */
-    hg_bool_t reuse;                      /* Re-use op ID once ref_count is 0 */
+    struct hg_bulk_na_op na_ops[HG_BULK_OP_WINDOW]; /* Transfer window */
+    struct hg_bulk_na_xfer na_xfer;                 /* Transfer position */
+    struct hg_bulk_xfer_entry xfer_single;          /* Single transfer entry */
+    struct hg_bulk_xfer_entry *xfer_entries;        /* Transfer entries */
+    hg_uint32_t xfer_count;                         /* Number of entries */
+    hg_core_context_t *core_context;                /* Context */
+    na_class_t *na_class;                           /* NA class */
+    na_context_t *na_context;                       /* NA context */
+    hg_atomic_int32_t status;                       /* Operation status */
+    hg_atomic_int32_t ret_status;                   /* Return status */
+    hg_atomic_int32_t crc;                          /* CRC32C of data */
+    hg_atomic_int32_t op_active_count; /* Number of active window slots */
+    hg_atomic_int32_t ref_count;       /* Refcount */
+    hg_uint32_t op_count;              /* Number of window slots used */
+    hg_bool_t reuse;                   /* Re-use op ID once ref_count is 0 */
+    hg_bool_t checksum;                /* Compute CRC32C of data */
+    /* Parts of local copies that are split between copy threads */
+    struct hg_bulk_copy_part copy_parts[HG_BULK_OP_WINDOW];
+};
+
+/* Registration cache entry */
+struct hg_bulk_reg_entry {
+    struct hg_bulk_reg_entry *left;     /* Left child in tree */
+    struct hg_bulk_reg_entry *right;    /* Right child in tree */
+    struct hg_bulk_reg_entry *lru_prev; /* Previous unused entry */
+    struct hg_bulk_reg_entry *lru_next; /* Next unused entry */
+    struct hg_bulk_reg_entry *next;     /* Next entry in list of matches */
+    na_class_t *na_class;               /* NA class used for registration */
+    na_mem_handle_t *mem_handle;        /* Registered NA mem handle */
+    hg_ptr_t base;                      /* Start of registered range */
+    hg_ptr_t end;                       /* End of registered range */
+    hg_ptr_t max_end;                   /* Max end of range in subtree */
+    uint64_t device;                    /* Device ID */
+    size_t serialize_size;              /* Serialize size of mem handle */
+    unsigned long flags;                /* Access flags */
+    enum na_mem_type mem_type;          /* Memory type */
+    unsigned int prio;                  /* Priority in tree (heap order) */
+    unsigned int ref_count;             /* Number of segments using it */
+    hg_bool_t invalid;                  /* Removed from tree */
+};
+
+/* Registration cache (interval tree implemented as a treap ordered by start
+ * address, each node keeping the max end address of its subtree) */
+struct hg_bulk_reg_cache {
+    struct hg_bulk_reg_cache_stats stats; /* Stats */
+    struct hg_bulk_reg_entry *root;       /* Root of interval tree */
+    struct hg_bulk_reg_entry *lru_head;   /* Least recently used entry */
+    struct hg_bulk_reg_entry *lru_tail;   /* Most recently used entry */
+    hg_hash_table_t *handle_map;          /* Mem handle to entry */
+    hg_thread_mutex_t mutex;              /* Cache lock */
+    hg_size_t max_size;                   /* Max size of registered memory */
 };
 
 /* Pool of op IDs */
@@ -223,18 +359,6 @@ struct hg_bulk_op_pool {
     hg_bool_t extending;                      /* When extending the pool */
 };
 
-/* Wrapper on top of memcpy */
-typedef void (*hg_bulk_copy_op_t)(hg_ptr_t local_address,
-    hg_size_t local_offset, hg_ptr_t remote_address, hg_size_t remote_offset,
-    hg_size_t data_size);
-
-/* Wrapper on top of NA layer */
-typedef na_return_t (*na_bulk_op_t)(na_class_t *na_class, na_context_t *context,
-    na_cb_t callback, void *arg, na_mem_handle_t *local_mem_handle,
-    na_offset_t local_offset, na_mem_handle_t *remote_mem_handle,
-    na_offset_t remote_offset, size_t data_size, na_addr_t *remote_addr,
-    uint8_t remote_id, na_op_id_t *op_id);
-
 /********************/
 /* Local Prototypes */
 /********************/
@@ -247,6 +371,14 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
     const hg_size_t *lens, hg_uint8_t flags, const struct hg_bulk_attr *attrs,
     struct hg_bulk **hg_bulk_p);
 
+/**
+ * Create handle from strided layout.
+ */
+static hg_return_t
+hg_bulk_create_strided(hg_core_class_t *core_class, void *base,
+    hg_size_t block_len, hg_size_t stride, hg_uint32_t count, hg_uint8_t flags,
+    const struct hg_bulk_attr *attrs, struct hg_bulk **hg_bulk_p);
+
 /**
  * Free handle.
  */
@@ -259,14 +391,16 @@ hg_bulk_free(struct hg_bulk *hg_bulk);
 static hg_return_t
 hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
     na_class_t *na_class, struct hg_bulk_segment *segments, hg_uint32_t count,
-    hg_uint8_t flags, enum na_mem_type mem_type, uint64_t device);
+    hg_uint8_t flags, enum na_mem_type mem_type, uint64_t device,
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache);
 
 /**
  * Free NA memory descriptors.
  */
 static hg_return_t
 hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, hg_uint32_t count, bool registered);
+    na_class_t *na_class, hg_uint32_t count, bool registered,
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache);
 
 /**
  * Register single segment.
@@ -289,8 +423,106 @@ hg_bulk_register_segments(na_class_t *na_class, struct na_segment *segments,
  * Deregister segment.
  */
 static hg_return_t
-hg_bulk_deregister(
-    na_class_t *na_class, na_mem_handle_t *mem_handle, bool registered);
+hg_bulk_deregister(na_class_t *na_class, na_mem_handle_t *mem_handle,
+    bool registered, struct hg_bulk_reg_cache *hg_bulk_reg_cache);
+
+/**
+ * Get registration of single segment from cache, register it on miss.
+ */
+static hg_return_t
+hg_bulk_reg_cache_get(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, void *base, size_t len, unsigned long flags,
+    enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p);
+
+/**
+ * Release registration, return false if it does not belong to cache.
+ */
+static hg_bool_t
+hg_bulk_reg_cache_put(
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache, na_mem_handle_t *mem_handle);
+
+/**
+ * Remove entry from cache and add it to list of entries to release (must be
+ * called with cache lock held).
+ */
+static void
+hg_bulk_reg_cache_evict(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry,
+    struct hg_bulk_reg_entry **release_list_p);
+
+/**
+ * Deregister and free list of entries.
+ */
+static void
+hg_bulk_reg_entries_release(struct hg_bulk_reg_entry *release_list);
+
+/**
+ * Remove entry from LRU list.
+ */
+static HG_INLINE void
+hg_bulk_reg_lru_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Insert entry into interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(struct hg_bulk_reg_entry *root,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Remove entry from interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(struct hg_bulk_reg_entry *root,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Merge two interval trees, keys of left tree are lower than keys of right.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_merge(
+    struct hg_bulk_reg_entry *left, struct hg_bulk_reg_entry *right);
+
+/**
+ * Update max end address of node from its children.
+ */
+static HG_INLINE void
+hg_bulk_reg_tree_update(struct hg_bulk_reg_entry *node);
+
+/**
+ * Compare order of entries in interval tree.
+ */
+static HG_INLINE bool
+hg_bulk_reg_tree_less(
+    const struct hg_bulk_reg_entry *a, const struct hg_bulk_reg_entry *b);
+
+/**
+ * Find valid entry that matches registration parameters.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(struct hg_bulk_reg_entry *root,
+    const struct hg_bulk_reg_entry *key);
+
+/**
+ * Add entries that overlap [base, end) to list.
+ */
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    hg_ptr_t end, struct hg_bulk_reg_entry **list_p);
+
+/**
+ * Hash mem handle.
+ */
+static HG_INLINE unsigned int
+hg_bulk_reg_handle_hash(hg_hash_table_key_t key);
+
+/**
+ * Compare mem handles.
+ */
+static HG_INLINE int
+hg_bulk_reg_handle_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2);
 
 /**
  * Get serialize size.
@@ -347,9 +579,41 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
  * Get info for bulk transfer.
  */
 static HG_INLINE void
-hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
-    hg_uint32_t count, hg_size_t offset, hg_uint32_t *segment_start_index,
-    hg_size_t *segment_start_offset);
+hg_bulk_offset_translate(struct hg_bulk *hg_bulk, hg_size_t offset,
+    hg_uint32_t *segment_start_index, hg_size_t *segment_start_offset);
+
+/**
+ * Get end offset of each segment, build index on first use (NULL if index
+ * cannot be allocated).
+ */
+static const hg_size_t *
+hg_bulk_offset_index_get(struct hg_bulk *hg_bulk);
+
+/**
+ * Set cursor to offset in handle (if contig is set, the handle is seen as one
+ * single segment, which is only meaningful for NA offsets).
+ */
+static void
+hg_bulk_cursor_init(struct hg_bulk_cursor *hg_bulk_cursor,
+    struct hg_bulk *hg_bulk, hg_size_t offset, hg_bool_t contig);
+
+/**
+ * Get address of current segment.
+ */
+static HG_INLINE hg_ptr_t
+hg_bulk_cursor_base(const struct hg_bulk_cursor *hg_bulk_cursor);
+
+/**
+ * Get size of current segment.
+ */
+static HG_INLINE hg_size_t
+hg_bulk_cursor_len(const struct hg_bulk_cursor *hg_bulk_cursor);
+
+/**
+ * Move cursor forward by size (must not exceed current segment).
+ */
+static HG_INLINE void
+hg_bulk_cursor_advance(struct hg_bulk_cursor *hg_bulk_cursor, hg_size_t size);
 
 /**
  * Create bulk operation ID.
@@ -371,6 +635,13 @@ static hg_return_t
 hg_bulk_op_pool_get(struct hg_bulk_op_pool *hg_bulk_op_pool,
     struct hg_bulk_op_id **hg_bulk_op_id_p);
 
+/**
+ * Get bulk op ID from context pool or create a new one.
+ */
+static hg_return_t
+hg_bulk_op_get(
+    hg_core_context_t *core_context, struct hg_bulk_op_id **hg_bulk_op_id_p);
+
 /**
  * Bulk transfer.
  */
@@ -381,87 +652,182 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
     hg_op_id_t *op_id);
 
+/**
+ * List of bulk transfers completed as a single operation.
+ */
+static hg_return_t
+hg_bulk_transfer_list(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id);
+
+/**
+ * Start transfer of entries attached to op ID.
+ */
+static hg_return_t
+hg_bulk_transfer_start(struct hg_bulk_op_id *hg_bulk_op_id, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id);
+
+/**
+ * Release handles referenced by transfer entries.
+ */
+static hg_return_t
+hg_bulk_xfer_entries_release(struct hg_bulk_op_id *hg_bulk_op_id);
+
+/**
+ * Check whether data of transfer entry can be copied locally (self or eager).
+ */
+static HG_INLINE hg_bool_t
+hg_bulk_xfer_entry_local(const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry,
+    hg_bulk_op_t op, hg_bool_t self)
+{
+    return self ||
+           ((hg_bulk_xfer_entry->origin->desc.info.flags & HG_BULK_EAGER) &&
+               (op != HG_BULK_PUSH));
+}
+
+/**
+ * Add CRC of data found at position of transfer to CRC of operation.
+ */
+static HG_INLINE void
+hg_bulk_crc_add(struct hg_bulk_op_id *hg_bulk_op_id, hg_uint32_t crc,
+    hg_size_t position, hg_size_t size)
+{
+    /* Shift CRC by the size of data that follows, CRCs of parts can then be
+     * accumulated in any order */
+    hg_atomic_xor32(&hg_bulk_op_id->crc,
+        (int32_t) hg_crc32c_combine(crc, 0,
+            (size_t) (hg_bulk_op_id->callback_info.info.bulk.size - position -
+                      size)));
+}
+
+/**
+ * Compute CRC of local data of transfer entry.
+ */
+static hg_uint32_t
+hg_bulk_xfer_entry_crc(const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry,
+    hg_size_t offset, hg_size_t size);
+
 /**
  * Bulk transfer to self.
  */
 static hg_return_t
-hg_bulk_transfer_self(hg_bulk_op_t op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
-    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size,
-    struct hg_bulk_op_id *hg_bulk_op_id);
+hg_bulk_transfer_self(struct hg_bulk_op_id *hg_bulk_op_id,
+    const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry);
+
+/**
+ * Split local copy of all entries between calling thread and copy threads.
+ */
+static void
+hg_bulk_transfer_self_split(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_size_t size, hg_thread_pool_t *copy_pool, hg_uint32_t copy_threads);
 
 /**
- * Transfer segments to self (local copy).
+ * Copy part of entries, complete operation once all parts are copied.
  */
 static void
+hg_bulk_copy_part_run(struct hg_bulk_copy_part *hg_bulk_copy_part);
+
+/**
+ * Copy thread routine.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_bulk_copy_part_thread(void *arg);
+
+/**
+ * Transfer segments to self (local copy), return CRC updated by copy op.
+ */
+static hg_uint32_t
 hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size);
+    struct hg_bulk_cursor *origin_cursor, struct hg_bulk_cursor *local_cursor,
+    hg_size_t size, hg_uint32_t crc);
 
 /**
  * Memcpy.
  */
-static HG_INLINE void
+static HG_INLINE hg_uint32_t
 hg_bulk_memcpy_put(hg_ptr_t local_address, hg_size_t local_offset,
-    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size)
+    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size,
+    hg_uint32_t crc)
 {
     memcpy((void *) (remote_address + remote_offset),
         (const void *) (local_address + local_offset), data_size);
+
+    return crc;
 }
 
 /**
  * Memcpy.
  */
-static HG_INLINE void
+static HG_INLINE hg_uint32_t
 hg_bulk_memcpy_get(hg_ptr_t local_address, hg_size_t local_offset,
-    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size)
+    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size,
+    hg_uint32_t crc)
 {
     memcpy((void *) (local_address + local_offset),
         (const void *) (remote_address + remote_offset), data_size);
+
+    return crc;
+}
+
+/**
+ * Memcpy and update CRC with copied data.
+ */
+static HG_INLINE hg_uint32_t
+hg_bulk_memcpy_put_crc(hg_ptr_t local_address, hg_size_t local_offset,
+    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size,
+    hg_uint32_t crc)
+{
+    return hg_crc32c_copy(crc, (void *) (remote_address + remote_offset),
+        (const void *) (local_address + local_offset), (size_t) data_size);
+}
+
+/**
+ * Memcpy and update CRC with copied data.
+ */
+static HG_INLINE hg_uint32_t
+hg_bulk_memcpy_get_crc(hg_ptr_t local_address, hg_size_t local_offset,
+    hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size,
+    hg_uint32_t crc)
+{
+    return hg_crc32c_copy(crc, (void *) (local_address + local_offset),
+        (const void *) (remote_address + remote_offset), (size_t) data_size);
 }
 
 /**
  * Bulk transfer over NA.
  */
 static hg_return_t
-hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
-    hg_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
-    hg_uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, hg_uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size,
-    struct hg_bulk_op_id *hg_bulk_op_id);
+hg_bulk_transfer_na(hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, struct hg_bulk_op_id *hg_bulk_op_id);
 
 /**
- * Get number of required operations to transfer data.
+ * Set NA transfer position to the start of a transfer entry.
  */
-static hg_uint32_t
-hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, hg_size_t origin_segment_start_index,
-    hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size);
+static void
+hg_bulk_na_xfer_load(struct hg_bulk_na_xfer *na_xfer,
+    const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry);
 
 /**
- * Transfer segments.
+ * Get next chunk of NA transfer, return false if no data is left.
  */
-static hg_return_t
-hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
-    na_bulk_op_t na_bulk_op, na_cb_t callback, void *arg,
-    na_addr_t *origin_addr, uint8_t origin_id,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    na_mem_handle_t **origin_mem_handles, hg_size_t origin_segment_start_index,
-    hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, hg_size_t local_segment_start_index,
-    hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count);
+static hg_bool_t
+hg_bulk_na_xfer_next(
+    struct hg_bulk_na_xfer *na_xfer, struct hg_bulk_na_chunk *chunk);
+
+/**
+ * Issue next chunk on window slot or release slot if nothing can be issued.
+ */
+static hg_bool_t
+hg_bulk_na_op_post(struct hg_bulk_na_op *hg_bulk_na_op);
+
+/**
+ * Release window slot, complete operation once all slots are released.
+ */
+static void
+hg_bulk_na_op_release(
+    struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify);
 
 /**
  * NA_Put wrapper
@@ -545,6 +911,7 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
     hg_bulk->desc.info.segment_count = count;
     hg_bulk->desc.info.flags = flags;
     hg_bulk->attrs = *attrs;
+    hg_atomic_init64(&hg_bulk->offset_index, 0);
     hg_atomic_init32(&hg_bulk->ref_count, 1);
 
     if (count > HG_BULK_STATIC_MAX) {
@@ -589,6 +956,11 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
         "Creating bulk handle with %u segment(s), len is %" PRIu64 " bytes",
         hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
 
+    /* Memory that is allocated internally is released with the handle and
+     * must not be cached */
+    if (!(hg_bulk->desc.info.flags & HG_BULK_ALLOC))
+        hg_bulk->reg_cache = hg_core_bulk_reg_cache(core_class);
+
     /* Query max segment limit that NA plugin can handle */
     if ((count > 1) && na_class->ops->mem_handle_create_segments) {
         size_t max_segments =
@@ -642,7 +1014,7 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
         /* Register segments individually */
         ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_mem_descs, na_class,
             segments, count, flags, (enum na_mem_type) attrs->mem_type,
-            attrs->device);
+            attrs->device, hg_bulk->reg_cache);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not create NA mem descriptors");
 
@@ -650,7 +1022,8 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
         if (na_sm_class) {
             ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_sm_mem_descs,
                 na_sm_class, segments, count, flags,
-                (enum na_mem_type) attrs->mem_type, attrs->device);
+                (enum na_mem_type) attrs->mem_type, attrs->device,
+                hg_bulk->reg_cache);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not create NA SM mem descriptors");
         }
@@ -669,6 +1042,38 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_create_strided(hg_core_class_t *core_class, void *base,
+    hg_size_t block_len, hg_size_t stride, hg_uint32_t count, hg_uint8_t flags,
+    const struct hg_bulk_attr *attrs, struct hg_bulk **hg_bulk_p)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    hg_size_t span = (hg_size_t) (count - 1) * stride + block_len;
+    hg_return_t ret;
+
+    /* Blocks are registered once as the single segment that spans them */
+    ret = hg_bulk_create(core_class, 1, &base, &span, flags, attrs, &hg_bulk);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not create bulk handle");
+
+    hg_bulk->desc.info.layout = HG_BULK_LAYOUT_STRIDED;
+    hg_bulk->desc.info.len = (hg_size_t) count * block_len;
+    hg_bulk->desc.stride = (struct hg_bulk_stride){
+        .block_len = block_len, .stride = stride, .count = count};
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Created strided bulk handle with %u block(s) of %" PRIu64
+        " bytes, stride is %" PRIu64 " bytes",
+        count, block_len, stride);
+
+    *hg_bulk_p = hg_bulk;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_free(struct hg_bulk *hg_bulk)
@@ -688,7 +1093,8 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
         (hg_bulk->desc.info.segment_count == 1)) {
         if (hg_bulk->na_mem_descs.handles.s[0] != NULL) {
             ret = hg_bulk_deregister(hg_bulk->na_class,
-                hg_bulk->na_mem_descs.handles.s[0], hg_bulk->registered);
+                hg_bulk->na_mem_descs.handles.s[0], hg_bulk->registered,
+                hg_bulk->reg_cache);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not deregister segment");
         }
@@ -696,7 +1102,8 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
 #ifdef NA_HAS_SM
         if (hg_bulk->na_sm_mem_descs.handles.s[0] != NULL) {
             ret = hg_bulk_deregister(hg_bulk->na_sm_class,
-                hg_bulk->na_sm_mem_descs.handles.s[0], hg_bulk->registered);
+                hg_bulk->na_sm_mem_descs.handles.s[0], hg_bulk->registered,
+                hg_bulk->reg_cache);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not deregister segment with SM");
         }
@@ -705,7 +1112,8 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
         /* Free segments individually */
         ret =
             hg_bulk_free_na_mem_descs(&hg_bulk->na_mem_descs, hg_bulk->na_class,
-                hg_bulk->desc.info.segment_count, hg_bulk->registered);
+                hg_bulk->desc.info.segment_count, hg_bulk->registered,
+                hg_bulk->reg_cache);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not free NA mem descriptors");
 
@@ -713,7 +1121,7 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
         if (hg_bulk->na_sm_class) {
             ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_sm_mem_descs,
                 hg_bulk->na_sm_class, hg_bulk->desc.info.segment_count,
-                hg_bulk->registered);
+                hg_bulk->registered, hg_bulk->reg_cache);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not free NA SM mem descriptors");
         }
@@ -741,6 +1149,8 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
     if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
         free(segments);
 
+    free((void *) (intptr_t) hg_atomic_get64(&hg_bulk->offset_index));
+
     hg_core_bulk_decr(hg_bulk->core_class);
     free(hg_bulk);
 
@@ -754,7 +1164,8 @@ error:
 static hg_return_t
 hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
     na_class_t *na_class, struct hg_bulk_segment *segments, hg_uint32_t count,
-    hg_uint8_t flags, enum na_mem_type mem_type, uint64_t device)
+    hg_uint8_t flags, enum na_mem_type mem_type, uint64_t device,
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache)
 {
     na_mem_handle_t **na_mem_handles;
     size_t *na_mem_serialize_sizes;
@@ -787,9 +1198,14 @@ hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
             continue;
 
         /* Register segment */
-        ret = hg_bulk_register(na_class, (void *) segments[i].base,
-            segments[i].len, flags, mem_type, device, &na_mem_handles[i],
-            &na_mem_serialize_sizes[i]);
+        if (hg_bulk_reg_cache)
+            ret = hg_bulk_reg_cache_get(hg_bulk_reg_cache, na_class,
+                (void *) segments[i].base, segments[i].len, flags, mem_type,
+                device, &na_mem_handles[i], &na_mem_serialize_sizes[i]);
+        else
+            ret = hg_bulk_register(na_class, (void *) segments[i].base,
+                segments[i].len, flags, mem_type, device, &na_mem_handles[i],
+                &na_mem_serialize_sizes[i]);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not register segment");
     }
@@ -803,7 +1219,8 @@ error:
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, hg_uint32_t count, bool registered)
+    na_class_t *na_class, hg_uint32_t count, bool registered,
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache)
 {
     na_mem_handle_t **na_mem_handles;
     hg_return_t ret;
@@ -821,7 +1238,8 @@ hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
             if (na_mem_handles[i] == NULL)
                 continue;
 
-            ret = hg_bulk_deregister(na_class, na_mem_handles[i], registered);
+            ret = hg_bulk_deregister(
+                na_class, na_mem_handles[i], registered, hg_bulk_reg_cache);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not deregister segment");
         }
@@ -957,12 +1375,17 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_deregister(
-    na_class_t *na_class, na_mem_handle_t *mem_handle, bool registered)
+hg_bulk_deregister(na_class_t *na_class, na_mem_handle_t *mem_handle,
+    bool registered, struct hg_bulk_reg_cache *hg_bulk_reg_cache)
 {
     hg_return_t ret;
     na_return_t na_ret;
 
+    /* Registrations owned by the cache are released by the cache */
+    if (registered && hg_bulk_reg_cache &&
+        hg_bulk_reg_cache_put(hg_bulk_reg_cache, mem_handle))
+        return HG_SUCCESS;
+
     if (registered) {
         na_ret = NA_Mem_deregister(na_class, mem_handle);
         HG_CHECK_SUBSYS_ERROR(bulk, na_ret != NA_SUCCESS, error, ret,
@@ -979,66 +1402,511 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_size_t
-hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, hg_uint8_t flags)
+hg_return_t
+hg_bulk_reg_cache_create(
+    hg_size_t max_size, struct hg_bulk_reg_cache **hg_bulk_reg_cache_p)
 {
-    struct hg_bulk_desc_info *desc_info = &hg_bulk->desc.info;
-    hg_size_t ret = 0;
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache = NULL;
+    hg_return_t ret;
+    int rc;
 
-    /* Descriptor info + segments */
-    ret = sizeof(*desc_info) +
-          desc_info->segment_count * sizeof(struct hg_bulk_segment);
+    hg_bulk_reg_cache =
+        (struct hg_bulk_reg_cache *) calloc(1, sizeof(*hg_bulk_reg_cache));
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_reg_cache == NULL, error, ret,
+        HG_NOMEM, "Could not allocate registration cache");
+    hg_bulk_reg_cache->max_size = max_size;
 
-    /* Memory handles */
-    if ((desc_info->flags & HG_BULK_REGV) || (desc_info->segment_count == 1)) {
-        /* Only one single memory handle in that case */
-        if (hg_bulk->na_mem_descs.handles.s[0] != NULL)
-            ret += hg_bulk->na_mem_descs.serialize_sizes.s[0] + sizeof(size_t);
+    hg_bulk_reg_cache->handle_map =
+        hg_hash_table_new(hg_bulk_reg_handle_hash, hg_bulk_reg_handle_equal);
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_reg_cache->handle_map == NULL, error,
+        ret, HG_NOMEM, "Could not allocate registration cache map");
 
-#ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip it. */
-        if ((flags & HG_BULK_SM) &&
-            (hg_bulk->na_sm_mem_descs.handles.s[0] != NULL))
-            ret +=
-                hg_bulk->na_sm_mem_descs.serialize_sizes.s[0] + sizeof(size_t);
-#endif
-    } else {
-        ret += hg_bulk_get_serialize_size_mem_descs(
-            &hg_bulk->na_mem_descs, desc_info->segment_count);
+    rc = hg_thread_mutex_init(&hg_bulk_reg_cache->mutex);
+    HG_CHECK_SUBSYS_ERROR(bulk, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "hg_thread_mutex_init() failed");
 
-#ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip it. */
-        if ((flags & HG_BULK_SM) && hg_bulk->na_sm_class)
-            ret += hg_bulk_get_serialize_size_mem_descs(
-                &hg_bulk->na_sm_mem_descs, desc_info->segment_count);
-#endif
-    }
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Created registration cache (%p), max size is %" PRIu64 " bytes",
+        (void *) hg_bulk_reg_cache, max_size);
 
-    /* Address information (context ID + serialize size + address) */
-    if (desc_info->flags & HG_BULK_BIND) {
-        unsigned long addr_flags = 0;
+    *hg_bulk_reg_cache_p = hg_bulk_reg_cache;
 
-#ifdef NA_HAS_SM
-        if (flags & HG_BULK_SM)
-            addr_flags |= HG_CORE_SM;
-#endif
-        ret += sizeof(hg_uint8_t) + sizeof(hg_size_t) +
-               HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
-    }
+    return HG_SUCCESS;
 
-    /* Eager mode (in eager mode, the actual data will be copied) */
-    if ((flags & HG_BULK_EAGER) && (desc_info->flags & HG_BULK_READ_ONLY) &&
-        !(desc_info->flags & HG_BULK_VIRT) &&
-        (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST))
-        ret += desc_info->len;
+error:
+    if (hg_bulk_reg_cache != NULL) {
+        if (hg_bulk_reg_cache->handle_map != NULL)
+            hg_hash_table_free(hg_bulk_reg_cache->handle_map);
+        free(hg_bulk_reg_cache);
+    }
 
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_size_t
+void
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache)
+{
+    struct hg_bulk_reg_entry *release_list = NULL;
+    hg_hash_table_iter_t iter;
+
+    if (hg_bulk_reg_cache == NULL)
+        return;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Destroying registration cache (%p), %" PRIu64 " hit(s), %" PRIu64
+        " miss(es), %" PRIu64 " eviction(s)",
+        (void *) hg_bulk_reg_cache, hg_bulk_reg_cache->stats.hit_count,
+        hg_bulk_reg_cache->stats.miss_count,
+        hg_bulk_reg_cache->stats.evict_count);
+
+    /* All entries, including invalidated ones still in use, are in the map */
+    hg_hash_table_iterate(hg_bulk_reg_cache->handle_map, &iter);
+    while (hg_hash_table_iter_has_more(&iter)) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry =
+            (struct hg_bulk_reg_entry *) hg_hash_table_iter_next(&iter);
+
+        if (hg_bulk_reg_entry->ref_count > 0)
+            HG_LOG_SUBSYS_WARNING(bulk,
+                "Releasing cached registration (%p) with %u reference(s)",
+                (void *) hg_bulk_reg_entry->base, hg_bulk_reg_entry->ref_count);
+        hg_bulk_reg_entry->next = release_list;
+        release_list = hg_bulk_reg_entry;
+    }
+    hg_hash_table_free(hg_bulk_reg_cache->handle_map);
+    hg_bulk_reg_entries_release(release_list);
+
+    hg_thread_mutex_destroy(&hg_bulk_reg_cache->mutex);
+    free(hg_bulk_reg_cache);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_get(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, void *base, size_t len, unsigned long flags,
+    enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p)
+{
+    struct hg_bulk_reg_entry key = {.na_class = na_class,
+        .base = (hg_ptr_t) base,
+        .end = (hg_ptr_t) base + len,
+        .device = device,
+        .flags = flags,
+        .mem_type = mem_type};
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry, *release_list = NULL;
+    na_mem_handle_t *mem_handle = NULL;
+    size_t serialize_size = 0;
+    hg_return_t ret;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->mutex);
+    hg_bulk_reg_entry = hg_bulk_reg_tree_find(hg_bulk_reg_cache->root, &key);
+    if (hg_bulk_reg_entry != NULL) {
+        /* Entry is no longer a candidate for eviction */
+        if (hg_bulk_reg_entry->ref_count++ == 0)
+            hg_bulk_reg_lru_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_bulk_reg_cache->stats.hit_count++;
+        *mem_handle_p = hg_bulk_reg_entry->mem_handle;
+        *serialize_size_p = hg_bulk_reg_entry->serialize_size;
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+        return HG_SUCCESS;
+    }
+    hg_bulk_reg_cache->stats.miss_count++;
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+    /* Register outside of the lock */
+    ret = hg_bulk_register(na_class, base, len, flags, mem_type, device,
+        &mem_handle, &serialize_size);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not register segment");
+
+    *mem_handle_p = mem_handle;
+    *serialize_size_p = serialize_size;
+
+    /* Registrations that do not fit are simply not cached */
+    if (len > hg_bulk_reg_cache->max_size)
+        return HG_SUCCESS;
+
+    hg_bulk_reg_entry =
+        (struct hg_bulk_reg_entry *) malloc(sizeof(*hg_bulk_reg_entry));
+    if (hg_bulk_reg_entry == NULL)
+        return HG_SUCCESS;
+    *hg_bulk_reg_entry = key;
+    hg_bulk_reg_entry->mem_handle = mem_handle;
+    hg_bulk_reg_entry->serialize_size = serialize_size;
+    hg_bulk_reg_entry->prio =
+        hg_bulk_reg_handle_hash((hg_hash_table_key_t) hg_bulk_reg_entry);
+    hg_bulk_reg_entry->ref_count = 1;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->mutex);
+
+    /* Evict least recently used entries until there is enough room */
+    while (hg_bulk_reg_cache->stats.size + len > hg_bulk_reg_cache->max_size &&
+           hg_bulk_reg_cache->lru_head != NULL)
+        hg_bulk_reg_cache_evict(
+            hg_bulk_reg_cache, hg_bulk_reg_cache->lru_head, &release_list);
+
+    if (hg_bulk_reg_cache->stats.size + len <= hg_bulk_reg_cache->max_size &&
+        hg_hash_table_insert(hg_bulk_reg_cache->handle_map,
+            (hg_hash_table_key_t) mem_handle,
+            (hg_hash_table_value_t) hg_bulk_reg_entry)) {
+        hg_bulk_reg_cache->root =
+            hg_bulk_reg_tree_insert(hg_bulk_reg_cache->root, hg_bulk_reg_entry);
+        hg_bulk_reg_cache->stats.size += len;
+        hg_bulk_reg_cache->stats.entry_count++;
+        hg_bulk_reg_entry = NULL;
+    }
+
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+    /* Entry was not inserted, all remaining space is in use */
+    free(hg_bulk_reg_entry);
+
+    hg_bulk_reg_entries_release(release_list);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_reg_cache_put(
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache, na_mem_handle_t *mem_handle)
+{
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry, *release_list = NULL;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->mutex);
+
+    hg_bulk_reg_entry = (struct hg_bulk_reg_entry *) hg_hash_table_lookup(
+        hg_bulk_reg_cache->handle_map, (hg_hash_table_key_t) mem_handle);
+    if (hg_bulk_reg_entry == HG_HASH_TABLE_NULL) {
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+        return HG_FALSE;
+    }
+
+    if (--hg_bulk_reg_entry->ref_count == 0) {
+        if (hg_bulk_reg_entry->invalid) {
+            /* Range was invalidated while in use, release it now */
+            hg_hash_table_remove(hg_bulk_reg_cache->handle_map,
+                (hg_hash_table_key_t) mem_handle);
+            hg_bulk_reg_entry->next = NULL;
+            release_list = hg_bulk_reg_entry;
+        } else {
+            /* Most recently used entries are at the tail */
+            hg_bulk_reg_entry->lru_prev = hg_bulk_reg_cache->lru_tail;
+            hg_bulk_reg_entry->lru_next = NULL;
+            if (hg_bulk_reg_cache->lru_tail != NULL)
+                hg_bulk_reg_cache->lru_tail->lru_next = hg_bulk_reg_entry;
+            else
+                hg_bulk_reg_cache->lru_head = hg_bulk_reg_entry;
+            hg_bulk_reg_cache->lru_tail = hg_bulk_reg_entry;
+        }
+    }
+
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+    hg_bulk_reg_entries_release(release_list);
+
+    return HG_TRUE;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_cache_evict(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry,
+    struct hg_bulk_reg_entry **release_list_p)
+{
+    if (!hg_bulk_reg_entry->invalid) {
+        hg_bulk_reg_cache->root =
+            hg_bulk_reg_tree_remove(hg_bulk_reg_cache->root, hg_bulk_reg_entry);
+        hg_bulk_reg_entry->invalid = HG_TRUE;
+        hg_bulk_reg_cache->stats.size -=
+            (hg_size_t) (hg_bulk_reg_entry->end - hg_bulk_reg_entry->base);
+        hg_bulk_reg_cache->stats.entry_count--;
+        hg_bulk_reg_cache->stats.evict_count++;
+    }
+
+    /* Entries still in use are released on their last put */
+    if (hg_bulk_reg_entry->ref_count == 0) {
+        hg_bulk_reg_lru_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_hash_table_remove(hg_bulk_reg_cache->handle_map,
+            (hg_hash_table_key_t) hg_bulk_reg_entry->mem_handle);
+        hg_bulk_reg_entry->next = *release_list_p;
+        *release_list_p = hg_bulk_reg_entry;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_entries_release(struct hg_bulk_reg_entry *release_list)
+{
+    while (release_list != NULL) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry = release_list;
+        hg_return_t ret;
+
+        release_list = hg_bulk_reg_entry->next;
+
+        ret = hg_bulk_deregister(hg_bulk_reg_entry->na_class,
+            hg_bulk_reg_entry->mem_handle, true, NULL);
+        HG_CHECK_SUBSYS_ERROR_DONE(bulk, ret != HG_SUCCESS,
+            "Could not deregister cached segment (%d)", (int) ret);
+        free(hg_bulk_reg_entry);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_reg_lru_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    if (hg_bulk_reg_entry->lru_prev != NULL)
+        hg_bulk_reg_entry->lru_prev->lru_next = hg_bulk_reg_entry->lru_next;
+    else
+        hg_bulk_reg_cache->lru_head = hg_bulk_reg_entry->lru_next;
+    if (hg_bulk_reg_entry->lru_next != NULL)
+        hg_bulk_reg_entry->lru_next->lru_prev = hg_bulk_reg_entry->lru_prev;
+    else
+        hg_bulk_reg_cache->lru_tail = hg_bulk_reg_entry->lru_prev;
+    hg_bulk_reg_entry->lru_prev = NULL;
+    hg_bulk_reg_entry->lru_next = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_reg_tree_update(struct hg_bulk_reg_entry *node)
+{
+    node->max_end = node->end;
+    if (node->left != NULL && node->left->max_end > node->max_end)
+        node->max_end = node->left->max_end;
+    if (node->right != NULL && node->right->max_end > node->max_end)
+        node->max_end = node->right->max_end;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE bool
+hg_bulk_reg_tree_less(
+    const struct hg_bulk_reg_entry *a, const struct hg_bulk_reg_entry *b)
+{
+    /* Order by start address, ties are broken using the entry address */
+    return (a->base < b->base) ||
+           (a->base == b->base && (uintptr_t) a < (uintptr_t) b);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(struct hg_bulk_reg_entry *root,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    struct hg_bulk_reg_entry *pivot;
+
+    if (root == NULL) {
+        hg_bulk_reg_entry->left = NULL;
+        hg_bulk_reg_entry->right = NULL;
+        hg_bulk_reg_entry->max_end = hg_bulk_reg_entry->end;
+        return hg_bulk_reg_entry;
+    }
+
+    if (hg_bulk_reg_tree_less(hg_bulk_reg_entry, root)) {
+        root->left = hg_bulk_reg_tree_insert(root->left, hg_bulk_reg_entry);
+        if (root->left->prio > root->prio) {
+            /* Rotate right */
+            pivot = root->left;
+            root->left = pivot->right;
+            hg_bulk_reg_tree_update(root);
+            pivot->right = root;
+            root = pivot;
+        }
+    } else {
+        root->right = hg_bulk_reg_tree_insert(root->right, hg_bulk_reg_entry);
+        if (root->right->prio > root->prio) {
+            /* Rotate left */
+            pivot = root->right;
+            root->right = pivot->left;
+            hg_bulk_reg_tree_update(root);
+            pivot->left = root;
+            root = pivot;
+        }
+    }
+    hg_bulk_reg_tree_update(root);
+
+    return root;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_merge(
+    struct hg_bulk_reg_entry *left, struct hg_bulk_reg_entry *right)
+{
+    if (left == NULL)
+        return right;
+    if (right == NULL)
+        return left;
+
+    if (left->prio > right->prio) {
+        left->right = hg_bulk_reg_tree_merge(left->right, right);
+        hg_bulk_reg_tree_update(left);
+        return left;
+    } else {
+        right->left = hg_bulk_reg_tree_merge(left, right->left);
+        hg_bulk_reg_tree_update(right);
+        return right;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(struct hg_bulk_reg_entry *root,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    if (root == NULL)
+        return NULL;
+
+    if (root == hg_bulk_reg_entry)
+        return hg_bulk_reg_tree_merge(root->left, root->right);
+
+    if (hg_bulk_reg_tree_less(hg_bulk_reg_entry, root))
+        root->left = hg_bulk_reg_tree_remove(root->left, hg_bulk_reg_entry);
+    else
+        root->right = hg_bulk_reg_tree_remove(root->right, hg_bulk_reg_entry);
+    hg_bulk_reg_tree_update(root);
+
+    return root;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(
+    struct hg_bulk_reg_entry *root, const struct hg_bulk_reg_entry *key)
+{
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry;
+
+    if (root == NULL)
+        return NULL;
+
+    if (key->base < root->base)
+        return hg_bulk_reg_tree_find(root->left, key);
+    if (key->base > root->base)
+        return hg_bulk_reg_tree_find(root->right, key);
+
+    /* Entries with the same start address may be on both sides */
+    if (root->end == key->end && root->na_class == key->na_class &&
+        root->flags == key->flags && root->mem_type == key->mem_type &&
+        root->device == key->device)
+        return root;
+
+    hg_bulk_reg_entry = hg_bulk_reg_tree_find(root->left, key);
+    if (hg_bulk_reg_entry != NULL)
+        return hg_bulk_reg_entry;
+
+    return hg_bulk_reg_tree_find(root->right, key);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    hg_ptr_t end, struct hg_bulk_reg_entry **list_p)
+{
+    /* Nothing in this subtree ends after the start of the range */
+    if (root == NULL || root->max_end <= base)
+        return;
+
+    hg_bulk_reg_tree_overlap(root->left, base, end, list_p);
+
+    if (root->base < end) {
+        if (root->end > base) {
+            root->next = *list_p;
+            *list_p = root;
+        }
+        hg_bulk_reg_tree_overlap(root->right, base, end, list_p);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_bulk_reg_handle_hash(hg_hash_table_key_t key)
+{
+    uint64_t val = (uint64_t) (uintptr_t) key;
+
+    /* Mix pointer bits, low bits are mostly zero due to alignment */
+    val = (val ^ (val >> 33)) * 0xff51afd7ed558ccdULL;
+
+    return (unsigned int) (val ^ (val >> 33));
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE int
+hg_bulk_reg_handle_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
+{
+    return key1 == key2;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
+hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, hg_uint8_t flags)
+{
+    struct hg_bulk_desc_info *desc_info = &hg_bulk->desc.info;
+    hg_size_t ret = 0;
+
+    /* Descriptor info + segments */
+    ret = sizeof(*desc_info) +
+          desc_info->segment_count * sizeof(struct hg_bulk_segment);
+
+    /* Stride */
+    if (desc_info->layout == HG_BULK_LAYOUT_STRIDED)
+        ret += sizeof(struct hg_bulk_stride);
+
+    /* Memory handles */
+    if ((desc_info->flags & HG_BULK_REGV) || (desc_info->segment_count == 1)) {
+        /* Only one single memory handle in that case */
+        if (hg_bulk->na_mem_descs.handles.s[0] != NULL)
+            ret += hg_bulk->na_mem_descs.serialize_sizes.s[0] + sizeof(size_t);
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip it. */
+        if ((flags & HG_BULK_SM) &&
+            (hg_bulk->na_sm_mem_descs.handles.s[0] != NULL))
+            ret +=
+                hg_bulk->na_sm_mem_descs.serialize_sizes.s[0] + sizeof(size_t);
+#endif
+    } else {
+        ret += hg_bulk_get_serialize_size_mem_descs(
+            &hg_bulk->na_mem_descs, desc_info->segment_count);
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip it. */
+        if ((flags & HG_BULK_SM) && hg_bulk->na_sm_class)
+            ret += hg_bulk_get_serialize_size_mem_descs(
+                &hg_bulk->na_sm_mem_descs, desc_info->segment_count);
+#endif
+    }
+
+    /* Address information (context ID + serialize size + address) */
+    if (desc_info->flags & HG_BULK_BIND) {
+        unsigned long addr_flags = 0;
+
+#ifdef NA_HAS_SM
+        if (flags & HG_BULK_SM)
+            addr_flags |= HG_CORE_SM;
+#endif
+        ret += sizeof(hg_uint8_t) + sizeof(hg_size_t) +
+               HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
+    }
+
+    /* Eager mode (in eager mode, the actual data will be copied) */
+    if ((flags & HG_BULK_EAGER) && (desc_info->flags & HG_BULK_READ_ONLY) &&
+        !(desc_info->flags & HG_BULK_VIRT) &&
+        (desc_info->layout == HG_BULK_LAYOUT_SEGMENTS) &&
+        (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST))
+        ret += desc_info->len;
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
 hg_bulk_get_serialize_size_mem_descs(
     struct hg_bulk_na_mem_desc *na_mem_descs, hg_uint32_t count)
 {
@@ -1080,10 +1948,12 @@ hg_bulk_serialize(
     desc_info.flags &= (~HG_BULK_ALLOC & 0xff);
 
     /* Add eager flag to descriptor if requested and bulk handle is read-only,
-     * is not virtual (i.e., points to local data), and memory is not on device.
+     * is not virtual (i.e., points to local data), is not strided (gaps would
+     * be copied along), and memory is not on device.
      */
     if ((flags & HG_BULK_EAGER) && (desc_info.flags & HG_BULK_READ_ONLY) &&
         !(desc_info.flags & HG_BULK_VIRT) &&
+        (desc_info.layout == HG_BULK_LAYOUT_SEGMENTS) &&
         (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST)) {
         HG_LOG_SUBSYS_DEBUG(bulk, "HG_BULK_EAGER flag set");
         desc_info.flags |= HG_BULK_EAGER;
@@ -1111,6 +1981,11 @@ hg_bulk_serialize(
     HG_BULK_ENCODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
         struct hg_bulk_segment, desc_info.segment_count);
 
+    /* Stride */
+    if (desc_info.layout == HG_BULK_LAYOUT_STRIDED)
+        HG_BULK_ENCODE(error, ret, buf_ptr, buf_size_left,
+            &hg_bulk->desc.stride, struct hg_bulk_stride);
+
     /* TODO if eager or self flag, skip mem handles ? */
 
     /* Add the NA memory handles */
@@ -1292,6 +2167,7 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
     hg_bulk->core_class = core_class;
     hg_bulk->na_class = HG_Core_class_get_na(core_class);
     hg_bulk->registered = HG_FALSE;
+    hg_atomic_init64(&hg_bulk->offset_index, 0);
     hg_atomic_init32(&hg_bulk->ref_count, 1);
 
     /* Descriptor info */
@@ -1327,6 +2203,42 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
     HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
         struct hg_bulk_segment, hg_bulk->desc.info.segment_count);
 
+    /* Stride */
+    if (hg_bulk->desc.info.layout == HG_BULK_LAYOUT_STRIDED) {
+        const struct hg_bulk_stride *stride = &hg_bulk->desc.stride;
+        hg_size_t span;
+
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
+            &hg_bulk->desc.stride, struct hg_bulk_stride);
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            hg_bulk->desc.info.segment_count != 1 || stride->count == 0 ||
+                stride->block_len == 0 || stride->stride < stride->block_len,
+            error, ret, HG_PROTOCOL_ERROR, "Invalid strided layout");
+
+        /* Values come from the peer, check for overflows before using them */
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            stride->block_len > UINT64_MAX / stride->count ||
+                (stride->count > 1 &&
+                    stride->stride >
+                        (UINT64_MAX - stride->block_len) / (stride->count - 1)),
+            error, ret, HG_OVERFLOW, "Strided layout exceeds address space");
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            hg_bulk->desc.info.len !=
+                (hg_size_t) stride->count * stride->block_len,
+            error, ret, HG_PROTOCOL_ERROR,
+            "Strided layout does not match length");
+
+        /* Blocks must exactly span the registered segment */
+        span = (hg_size_t) (stride->count - 1) * stride->stride +
+               stride->block_len;
+        HG_CHECK_SUBSYS_ERROR(bulk, segments[0].len != span, error, ret,
+            HG_PROTOCOL_ERROR, "Strided layout does not match segment");
+    } else
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            hg_bulk->desc.info.layout != HG_BULK_LAYOUT_SEGMENTS, error, ret,
+            HG_PROTOCOL_ERROR, "Unknown layout (%u)",
+            (unsigned int) hg_bulk->desc.info.layout);
+
     /* Get the NA memory handles */
     if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
         (hg_bulk->desc.info.segment_count == 1)) {
@@ -1522,6 +2434,13 @@ hg_bulk_get_serialize_cached_size(struct hg_bulk *hg_bulk)
     return hg_bulk->serialize_size;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_bulk_get_eager_size_max(struct hg_bulk *hg_bulk)
+{
+    return hg_core_bulk_eager_size_max(hg_bulk->core_class);
+}
+
 /*---------------------------------------------------------------------------*/
 void
 hg_bulk_set_serialize_cached_ptr(
@@ -1537,28 +2456,27 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
     hg_uint8_t flags, hg_uint32_t max_count, void **buf_ptrs,
     hg_size_t *buf_sizes, hg_uint32_t *actual_count)
 {
-    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
-    hg_uint32_t segment_index;
-    hg_size_t segment_offset;
+    struct hg_bulk_cursor hg_bulk_cursor;
     hg_size_t remaining_size = size;
     hg_uint32_t count = 0;
 
     /* TODO use flags */
     (void) flags;
 
-    hg_bulk_offset_translate(segments, hg_bulk->desc.info.segment_count, offset,
-        &segment_index, &segment_offset);
+    hg_bulk_cursor_init(&hg_bulk_cursor, hg_bulk, offset, HG_FALSE);
 
-    while ((remaining_size > 0) && (count < max_count)) {
+    while ((remaining_size > 0) && (count < max_count) &&
+           (hg_bulk_cursor.index < hg_bulk_cursor.count)) {
         hg_ptr_t base;
         hg_size_t len;
 
         /* Can only transfer smallest size */
-        len = segments[segment_index].len - segment_offset;
+        len = hg_bulk_cursor_len(&hg_bulk_cursor) - hg_bulk_cursor.offset;
 
         /* Remaining size may be smaller */
         len = HG_BULK_MIN(remaining_size, len);
-        base = segments[segment_index].base + (hg_ptr_t) segment_offset;
+        base = hg_bulk_cursor_base(&hg_bulk_cursor) +
+               (hg_ptr_t) hg_bulk_cursor.offset;
 
         /* Fill segments */
         if (buf_ptrs)
@@ -1574,8 +2492,8 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
         remaining_size -= len;
 
         /* Change segment */
-        segment_index++;
-        segment_offset = 0;
+        hg_bulk_cursor.index++;
+        hg_bulk_cursor.offset = 0;
         count++;
     }
 
@@ -1585,13 +2503,52 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
 
 /*---------------------------------------------------------------------------*/
 static HG_INLINE void
-hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
-    hg_uint32_t count, hg_size_t offset, hg_uint32_t *segment_start_index,
-    hg_size_t *segment_start_offset)
+hg_bulk_offset_translate(struct hg_bulk *hg_bulk, hg_size_t offset,
+    hg_uint32_t *segment_start_index, hg_size_t *segment_start_offset)
 {
-    hg_uint32_t i, new_segment_start_index = 0;
+    const struct hg_bulk_segment *segments;
+    const hg_size_t *end_offsets;
+    hg_uint32_t i, count, new_segment_start_index = 0;
     hg_size_t new_segment_offset = offset, next_offset = 0;
 
+    /* Blocks of strided layouts have the same size */
+    if (hg_bulk->desc.info.layout == HG_BULK_LAYOUT_STRIDED) {
+        hg_size_t block_len = hg_bulk->desc.stride.block_len;
+
+        *segment_start_index = (hg_uint32_t) (offset / block_len);
+        *segment_start_offset = offset % block_len;
+        return;
+    }
+
+    segments = HG_BULK_SEGMENTS(hg_bulk);
+    count = hg_bulk->desc.info.segment_count;
+
+    /* Binary search of first segment that ends after offset */
+    if (count >= HG_BULK_OFFSET_INDEX_MIN &&
+        (end_offsets = hg_bulk_offset_index_get(hg_bulk)) != NULL) {
+        hg_uint32_t low = 0, high = count;
+
+        while (low < high) {
+            hg_uint32_t mid = low + (high - low) / 2;
+
+            if (end_offsets[mid] > offset)
+                high = mid;
+            else
+                low = mid + 1;
+        }
+
+        /* Same result as linear scan if offset is out of bounds */
+        if (low < count) {
+            *segment_start_index = low;
+            *segment_start_offset =
+                offset - (end_offsets[low] - segments[low].len);
+        } else {
+            *segment_start_index = 0;
+            *segment_start_offset = offset - end_offsets[count - 1];
+        }
+        return;
+    }
+
     /* Get start index and handle offset */
     for (i = 0; i < count; i++) {
         next_offset += segments[i].len;
@@ -1606,6 +2563,113 @@ hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
     *segment_start_offset = new_segment_offset;
 }
 
+/*---------------------------------------------------------------------------*/
+static const hg_size_t *
+hg_bulk_offset_index_get(struct hg_bulk *hg_bulk)
+{
+    const struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    hg_uint32_t i, count = hg_bulk->desc.info.segment_count;
+    hg_size_t *end_offsets, end_offset = 0;
+
+    end_offsets =
+        (hg_size_t *) (intptr_t) hg_atomic_get64(&hg_bulk->offset_index);
+    if (end_offsets != NULL)
+        return end_offsets;
+
+    end_offsets = (hg_size_t *) malloc(count * sizeof(*end_offsets));
+    if (end_offsets == NULL) {
+        HG_LOG_SUBSYS_WARNING(
+            bulk, "Could not allocate offset index, using linear scan");
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++) {
+        end_offset += segments[i].len;
+        end_offsets[i] = end_offset;
+    }
+
+    /* Index may have been concurrently built by another transfer */
+    if (!hg_atomic_cas64(
+            &hg_bulk->offset_index, 0, (int64_t) (intptr_t) end_offsets)) {
+        free(end_offsets);
+        end_offsets =
+            (hg_size_t *) (intptr_t) hg_atomic_get64(&hg_bulk->offset_index);
+    }
+
+    return end_offsets;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_cursor_init(struct hg_bulk_cursor *hg_bulk_cursor,
+    struct hg_bulk *hg_bulk, hg_size_t offset, hg_bool_t contig)
+{
+    hg_uint32_t segment_index = 0;
+    hg_size_t segment_offset = offset;
+
+    if (hg_bulk->desc.info.layout == HG_BULK_LAYOUT_STRIDED) {
+        /* Blocks are never expanded, block i starts at base + i * stride */
+        hg_bulk_cursor->block = (struct hg_bulk_segment){
+            .base = hg_bulk->desc.segments.s[0].base,
+            .len = hg_bulk->desc.stride.block_len};
+        hg_bulk_cursor->segments = &hg_bulk_cursor->block;
+        hg_bulk_cursor->stride = hg_bulk->desc.stride.stride;
+        hg_bulk_cursor->count = hg_bulk->desc.stride.count;
+        hg_bulk_offset_translate(
+            hg_bulk, offset, &segment_index, &segment_offset);
+    } else if (contig) {
+        /* Offset is directly used as offset within the single segment */
+        hg_bulk_cursor->block = (struct hg_bulk_segment){
+            .base = 0, .len = hg_bulk->desc.info.len};
+        hg_bulk_cursor->segments = &hg_bulk_cursor->block;
+        hg_bulk_cursor->stride = 0;
+        hg_bulk_cursor->count = 1;
+    } else {
+        hg_bulk_cursor->segments = HG_BULK_SEGMENTS(hg_bulk);
+        hg_bulk_cursor->stride = 0;
+        hg_bulk_cursor->count = hg_bulk->desc.info.segment_count;
+        if (offset > 0)
+            hg_bulk_offset_translate(
+                hg_bulk, offset, &segment_index, &segment_offset);
+    }
+
+    hg_bulk_cursor->index = segment_index;
+    hg_bulk_cursor->offset = segment_offset;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_ptr_t
+hg_bulk_cursor_base(const struct hg_bulk_cursor *hg_bulk_cursor)
+{
+    if (hg_bulk_cursor->stride > 0)
+        return hg_bulk_cursor->segments[0].base +
+               (hg_ptr_t) (hg_bulk_cursor->index * hg_bulk_cursor->stride);
+    else
+        return hg_bulk_cursor->segments[hg_bulk_cursor->index].base;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_bulk_cursor_len(const struct hg_bulk_cursor *hg_bulk_cursor)
+{
+    return hg_bulk_cursor
+        ->segments[(hg_bulk_cursor->stride > 0) ? 0 : hg_bulk_cursor->index]
+        .len;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_cursor_advance(struct hg_bulk_cursor *hg_bulk_cursor, hg_size_t size)
+{
+    hg_bulk_cursor->offset += size;
+
+    /* Change segment if new offset exceeds segment size */
+    if (hg_bulk_cursor->offset >= hg_bulk_cursor_len(hg_bulk_cursor)) {
+        hg_bulk_cursor->index++;
+        hg_bulk_cursor->offset = 0;
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_op_create(
@@ -1625,25 +2689,36 @@ hg_bulk_op_create(
     /* Completed by default */
     hg_atomic_init32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
     hg_atomic_init32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS);
+    hg_atomic_init32(&hg_bulk_op_id->crc, 0);
 
     hg_bulk_op_id->callback_info.type = HG_CB_BULK;
-    hg_bulk_op_id->op_count = 1; /* Default */
-    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+    hg_bulk_op_id->op_count = 0;
+    hg_atomic_init32(&hg_bulk_op_id->op_active_count, 0);
+    hg_thread_spin_init(&hg_bulk_op_id->na_xfer.lock);
+    for (i = 0; i < HG_BULK_OP_WINDOW; i++)
+        hg_bulk_op_id->na_ops[i].hg_bulk_op_id = hg_bulk_op_id;
+    for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+        struct hg_bulk_copy_part *copy_part = &hg_bulk_op_id->copy_parts[i];
+
+        copy_part->hg_bulk_op_id = hg_bulk_op_id;
+        copy_part->thread_work.func = hg_bulk_copy_part_thread;
+        copy_part->thread_work.args = copy_part;
+    }
 
     /* Preallocate NA OP IDs */
-    for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-        hg_bulk_op_id->na_op_ids.s[i] =
+    for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+        hg_bulk_op_id->na_op_ids[i] =
             NA_Op_create(core_context->core_class->na_class, 0);
-        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->na_op_ids.s[i] == NULL,
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->na_op_ids[i] == NULL,
             error, ret, HG_NA_ERROR, "NA_Op_create() failed");
     }
 #ifdef NA_HAS_SM
     if (core_context->core_class->na_sm_class) {
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            hg_bulk_op_id->na_sm_op_ids.s[i] =
+        for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+            hg_bulk_op_id->na_sm_op_ids[i] =
                 NA_Op_create(core_context->core_class->na_sm_class, 0);
             HG_CHECK_SUBSYS_ERROR(bulk,
-                hg_bulk_op_id->na_sm_op_ids.s[i] == NULL, error, ret,
+                hg_bulk_op_id->na_sm_op_ids[i] == NULL, error, ret,
                 HG_NA_ERROR, "NA_Op_create() failed");
         }
     }
@@ -1658,22 +2733,23 @@ hg_bulk_op_create(
 
 error:
     if (hg_bulk_op_id) {
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
+        for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+            if (hg_bulk_op_id->na_op_ids[i] == NULL)
                 continue;
 
             NA_Op_destroy(core_context->core_class->na_class,
-                hg_bulk_op_id->na_op_ids.s[i]);
+                hg_bulk_op_id->na_op_ids[i]);
         }
 #ifdef NA_HAS_SM
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            if (hg_bulk_op_id->na_sm_op_ids.s[i] == NULL)
+        for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+            if (hg_bulk_op_id->na_sm_op_ids[i] == NULL)
                 continue;
 
             NA_Op_destroy(core_context->core_class->na_sm_class,
-                hg_bulk_op_id->na_sm_op_ids.s[i]);
+                hg_bulk_op_id->na_sm_op_ids[i]);
         }
 #endif
+        hg_thread_spin_destroy(&hg_bulk_op_id->na_xfer.lock);
         free(hg_bulk_op_id);
     }
     return ret;
@@ -1688,33 +2764,6 @@ hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
     if (hg_atomic_decr32(&hg_bulk_op_id->ref_count))
         return; /* Cannot free yet */
 
-    /* We may have used extra op IDs if this NA class was used */
-    if (hg_bulk_op_id->na_class &&
-        hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
-        na_op_id_t **na_op_ids = NULL;
-#ifdef NA_HAS_SM
-        if (hg_bulk_op_id->na_class ==
-            hg_bulk_op_id->core_context->core_class->na_sm_class)
-            na_op_ids = hg_bulk_op_id->na_sm_op_ids.d;
-        else
-#endif
-            na_op_ids = hg_bulk_op_id->na_op_ids.d;
-
-        if (na_op_ids) {
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                if (na_op_ids[i] == NULL)
-                    continue;
-
-                NA_Op_destroy(hg_bulk_op_id->na_class, na_op_ids[i]);
-            }
-            free(na_op_ids);
-            hg_bulk_op_id->na_op_ids.d = NULL;
-#ifdef NA_HAS_SM
-            hg_bulk_op_id->na_sm_op_ids.d = NULL;
-#endif
-        }
-    }
-
     /* Repost handle if we were listening, otherwise destroy it */
     if (hg_bulk_op_id->reuse) {
         HG_LOG_SUBSYS_DEBUG(
@@ -1734,23 +2783,24 @@ hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
         HG_LOG_SUBSYS_DEBUG(
             bulk, "Freeing bulk op ID (%p)", (void *) hg_bulk_op_id);
 
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
+        for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+            if (hg_bulk_op_id->na_op_ids[i] == NULL)
                 continue;
 
             NA_Op_destroy(hg_bulk_op_id->core_context->core_class->na_class,
-                hg_bulk_op_id->na_op_ids.s[i]);
+                hg_bulk_op_id->na_op_ids[i]);
         }
 
 #ifdef NA_HAS_SM
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            if (hg_bulk_op_id->na_sm_op_ids.s[i] == NULL)
+        for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+            if (hg_bulk_op_id->na_sm_op_ids[i] == NULL)
                 continue;
 
             NA_Op_destroy(hg_bulk_op_id->core_context->core_class->na_sm_class,
-                hg_bulk_op_id->na_sm_op_ids.s[i]);
+                hg_bulk_op_id->na_sm_op_ids[i]);
         }
 #endif
+        hg_thread_spin_destroy(&hg_bulk_op_id->na_xfer.lock);
 
         free(hg_bulk_op_id);
     }
@@ -1911,6 +2961,31 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_get(
+    hg_core_context_t *core_context, struct hg_bulk_op_id **hg_bulk_op_id_p)
+{
+    struct hg_bulk_op_pool *hg_bulk_op_pool =
+        hg_core_context_get_bulk_op_pool(core_context);
+    hg_return_t ret;
+
+    /* Get a new OP ID from context */
+    if (hg_bulk_op_pool) {
+        ret = hg_bulk_op_pool_get(hg_bulk_op_pool, hg_bulk_op_id_p);
+        HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+    } else {
+        ret = hg_bulk_op_create(core_context, hg_bulk_op_id_p);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not create bulk op ID");
+    }
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
@@ -1919,17 +2994,7 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
     hg_op_id_t *op_id)
 {
-    const struct hg_bulk_segment *origin_segments =
-        HG_BULK_SEGMENTS(hg_bulk_origin);
-    const struct hg_bulk_segment *local_segments =
-        HG_BULK_SEGMENTS(hg_bulk_local);
-    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
-                local_count = hg_bulk_local->desc.info.segment_count;
-    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
-    uint8_t local_flags = hg_bulk_local->desc.info.flags;
     struct hg_bulk_op_id *hg_bulk_op_id = NULL;
-    struct hg_bulk_op_pool *hg_bulk_op_pool =
-        hg_core_context_get_bulk_op_pool(core_context);
     hg_return_t ret;
 
     HG_CHECK_SUBSYS_ERROR(bulk,
@@ -1945,22 +3010,137 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
         HG_INVALID_ARG,
         "Context and local handle passed belong to different classes");
 
-    /* Get a new OP ID from context */
-    if (hg_bulk_op_pool) {
-        ret = hg_bulk_op_pool_get(hg_bulk_op_pool, &hg_bulk_op_id);
-        HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
-    } else {
-        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
-        HG_CHECK_SUBSYS_HG_ERROR(
-            bulk, error, ret, "Could not create bulk op ID");
+    ret = hg_bulk_op_get(core_context, &hg_bulk_op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+
+    /* Single transfers use the entry embedded into the op ID */
+    hg_bulk_op_id->xfer_single =
+        (struct hg_bulk_xfer_entry){.origin = hg_bulk_origin,
+            .local = hg_bulk_local,
+            .origin_offset = origin_offset,
+            .local_offset = local_offset,
+            .size = size};
+    hg_atomic_incr32(&hg_bulk_origin->ref_count);
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_id->xfer_entries = &hg_bulk_op_id->xfer_single;
+    hg_bulk_op_id->xfer_count = 1;
+
+    ret = hg_bulk_transfer_start(
+        hg_bulk_op_id, callback, arg, op, origin_addr, origin_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not start transfer");
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    return HG_SUCCESS;
+
+error:
+    if (hg_bulk_op_id) {
+        (void) hg_bulk_xfer_entries_release(hg_bulk_op_id);
+        hg_bulk_op_destroy(hg_bulk_op_id);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_list(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_xfer_entry *entries = NULL;
+    hg_return_t ret;
+    hg_uint32_t i;
+
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        origin_addr->core_class != core_context->core_class, error, ret,
+        HG_INVALID_ARG,
+        "Context and address passed belong to different classes");
+    for (i = 0; i < count; i++) {
+        const struct hg_bulk *hg_bulk_origin =
+            (const struct hg_bulk *) descs[i].origin_handle;
+        const struct hg_bulk *hg_bulk_local =
+            (const struct hg_bulk *) descs[i].local_handle;
+
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            hg_bulk_origin->core_class != core_context->core_class, error, ret,
+            HG_INVALID_ARG,
+            "Context and origin handle passed belong to different classes");
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            hg_bulk_local->core_class != core_context->core_class, error, ret,
+            HG_INVALID_ARG,
+            "Context and local handle passed belong to different classes");
+    }
+
+    ret = hg_bulk_op_get(core_context, &hg_bulk_op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+
+    if (count > 1) {
+        entries = (struct hg_bulk_xfer_entry *) malloc(
+            count * sizeof(struct hg_bulk_xfer_entry));
+        HG_CHECK_SUBSYS_ERROR(bulk, entries == NULL, error, ret, HG_NOMEM,
+            "Could not allocate transfer entries");
+    } else
+        entries = &hg_bulk_op_id->xfer_single;
+
+    for (i = 0; i < count; i++) {
+        entries[i] = (struct hg_bulk_xfer_entry){
+            .origin = (struct hg_bulk *) descs[i].origin_handle,
+            .local = (struct hg_bulk *) descs[i].local_handle,
+            .origin_offset = descs[i].origin_offset,
+            .local_offset = descs[i].local_offset,
+            .size = descs[i].size};
+        hg_atomic_incr32(&entries[i].origin->ref_count);
+        hg_atomic_incr32(&entries[i].local->ref_count);
+    }
+    hg_bulk_op_id->xfer_entries = entries;
+    hg_bulk_op_id->xfer_count = count;
+
+    ret = hg_bulk_transfer_start(
+        hg_bulk_op_id, callback, arg, op, origin_addr, origin_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not start transfer");
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    return HG_SUCCESS;
+
+error:
+    if (hg_bulk_op_id) {
+        (void) hg_bulk_xfer_entries_release(hg_bulk_op_id);
+        hg_bulk_op_destroy(hg_bulk_op_id);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_start(struct hg_bulk_op_id *hg_bulk_op_id, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id)
+{
+    struct hg_bulk_xfer_entry *entries = hg_bulk_op_id->xfer_entries;
+    hg_bool_t self = HG_Core_addr_is_self(origin_addr);
+    hg_size_t size = 0, na_size = 0;
+    hg_return_t ret;
+    hg_uint32_t i;
+
+    for (i = 0; i < hg_bulk_op_id->xfer_count; i++) {
+        entries[i].position = size;
+        size += entries[i].size;
     }
 
+    /* Handles of the first entry are reported to the callback */
     hg_bulk_op_id->callback = callback;
     hg_bulk_op_id->callback_info.arg = arg;
-    hg_bulk_op_id->callback_info.info.bulk.origin_handle = hg_bulk_origin;
-    hg_atomic_incr32(&hg_bulk_origin->ref_count);
-    hg_bulk_op_id->callback_info.info.bulk.local_handle = hg_bulk_local;
-    hg_atomic_incr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.origin_handle = entries[0].origin;
+    hg_bulk_op_id->callback_info.info.bulk.local_handle = entries[0].local;
     hg_bulk_op_id->callback_info.info.bulk.op = op;
     hg_bulk_op_id->callback_info.info.bulk.size = size;
 
@@ -1968,95 +3148,147 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     hg_atomic_set32(&hg_bulk_op_id->status, 0);
     hg_atomic_set32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS);
 
-    /* Expected op count */
-    hg_bulk_op_id->op_count = (size > 0) ? 1 : 0; /* Default */
-    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
+    /* Only data in host memory can be checksummed */
+    hg_bulk_op_id->checksum =
+        hg_core_bulk_checksum(hg_bulk_op_id->core_context->core_class);
+    for (i = 0; i < hg_bulk_op_id->xfer_count && hg_bulk_op_id->checksum; i++)
+        if (entries[i].local->attrs.mem_type != HG_MEM_TYPE_HOST)
+            hg_bulk_op_id->checksum = HG_FALSE;
+    hg_atomic_set32(&hg_bulk_op_id->crc, 0);
+
+    /* No NA operation used yet */
+    hg_bulk_op_id->op_count = 0;
+    hg_bulk_op_id->na_class = NULL;
+    hg_bulk_op_id->na_context = NULL;
+
+    /* Large transfers that only copy data locally are split between the
+     * calling thread and the bulk copy threads */
+    if (size >= HG_BULK_COPY_SPLIT_MIN) {
+        hg_uint32_t copy_threads;
+        hg_thread_pool_t *copy_pool = hg_core_bulk_copy_pool(
+            hg_bulk_op_id->core_context->core_class, &copy_threads);
+
+        for (i = 0; i < hg_bulk_op_id->xfer_count; i++)
+            if (entries[i].size > 0 &&
+                !hg_bulk_xfer_entry_local(&entries[i], op, self))
+                break;
+
+        if (copy_pool != NULL && i == hg_bulk_op_id->xfer_count) {
+            hg_bulk_transfer_self_split(
+                hg_bulk_op_id, size, copy_pool, copy_threads);
+            return HG_SUCCESS;
+        }
+    }
+
+    /* When doing eager transfers, use self code path to copy data locally,
+     * entries that are copied no longer need to go through NA */
+    for (i = 0; i < hg_bulk_op_id->xfer_count; i++) {
+        if (entries[i].size == 0)
+            continue;
+
+        if (hg_bulk_xfer_entry_local(&entries[i], op, self)) {
+            ret = hg_bulk_transfer_self(hg_bulk_op_id, &entries[i]);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error, ret, "Could not transfer data through self");
+            entries[i].size = 0;
+        } else
+            na_size += entries[i].size;
+    }
 
-    if (size == 0) {
+    if (na_size == 0) {
         /* Complete immediately */
         hg_bulk_complete(hg_bulk_op_id, HG_SUCCESS, HG_TRUE);
-    } else if (HG_Core_addr_is_self(origin_addr) ||
-               ((origin_flags & HG_BULK_EAGER) && (op != HG_BULK_PUSH))) {
-        hg_bulk_op_id->na_class = NULL;
-        hg_bulk_op_id->na_context = NULL;
-
-        /* When doing eager transfers, use self code path to copy data locally
-         */
-        ret = hg_bulk_transfer_self(op, origin_segments, origin_count,
-            origin_offset, local_segments, local_count, local_offset, size,
-            hg_bulk_op_id);
     } else {
-        struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
-        na_mem_handle_t **origin_mem_handles, **local_mem_handles;
-        na_addr_t *na_origin_addr = NULL;
+        HG_LOG_SUBSYS_DEBUG(bulk,
+            "Transferring %" PRIu64 " bytes through NA", (uint64_t) na_size);
 
-#ifdef NA_HAS_SM
-        /* Use SM if we can */
-        if (hg_bulk_origin->desc.info.flags & HG_BULK_SM) {
-            HG_LOG_SUBSYS_DEBUG(bulk, "Using NA SM class for this transfer");
-
-            hg_bulk_op_id->na_class = hg_bulk_origin->na_sm_class;
-            hg_bulk_op_id->na_context = HG_Core_context_get_na_sm(core_context);
-            na_origin_addr = HG_Core_addr_get_na_sm(origin_addr);
-            origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
-            local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
-        } else {
-#endif
-            HG_LOG_SUBSYS_DEBUG(
-                bulk, "Using default NA class for this transfer");
-
-            hg_bulk_op_id->na_class = hg_bulk_origin->na_class;
-            hg_bulk_op_id->na_context = HG_Core_context_get_na(core_context);
-            na_origin_addr = HG_Core_addr_get_na(origin_addr);
-            origin_mem_descs = &hg_bulk_origin->na_mem_descs;
-            local_mem_descs = &hg_bulk_local->na_mem_descs;
-#ifdef NA_HAS_SM
-        }
-#endif
+        ret = hg_bulk_transfer_na(op, origin_addr, origin_id, hg_bulk_op_id);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not transfer data through NA");
+    }
 
-        origin_mem_handles =
-            HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
-        local_mem_handles =
-            HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
+    return HG_SUCCESS;
 
-        ret = hg_bulk_transfer_na(op, na_origin_addr, origin_id,
-            origin_segments, origin_count, origin_mem_handles, origin_flags,
-            origin_offset, local_segments, local_count, local_mem_handles,
-            local_flags, local_offset, size, hg_bulk_op_id);
-    }
+error:
+    return ret;
+}
 
-    /* Assign op_id */
-    if (op_id && op_id != HG_OP_ID_IGNORE)
-        *op_id = (hg_op_id_t) hg_bulk_op_id;
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_xfer_entries_release(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
 
-    return HG_SUCCESS;
+    for (i = 0; i < hg_bulk_op_id->xfer_count; i++) {
+        hg_return_t free_ret;
+
+        free_ret = hg_bulk_free(hg_bulk_op_id->xfer_entries[i].origin);
+        HG_CHECK_SUBSYS_ERROR_DONE(bulk, free_ret != HG_SUCCESS,
+            "Could not free origin handle");
+        if (free_ret != HG_SUCCESS)
+            ret = free_ret;
+
+        free_ret = hg_bulk_free(hg_bulk_op_id->xfer_entries[i].local);
+        HG_CHECK_SUBSYS_ERROR_DONE(
+            bulk, free_ret != HG_SUCCESS, "Could not free local handle");
+        if (free_ret != HG_SUCCESS)
+            ret = free_ret;
+    }
 
-error:
-    if (hg_bulk_op_id)
-        hg_bulk_op_destroy(hg_bulk_op_id);
+    if (hg_bulk_op_id->xfer_entries != &hg_bulk_op_id->xfer_single)
+        free(hg_bulk_op_id->xfer_entries);
+    hg_bulk_op_id->xfer_entries = NULL;
+    hg_bulk_op_id->xfer_count = 0;
 
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_bulk_xfer_entry_crc(const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry,
+    hg_size_t offset, hg_size_t size)
+{
+    struct hg_bulk_cursor local_cursor;
+    hg_uint32_t crc = 0;
+
+    hg_bulk_cursor_init(&local_cursor, hg_bulk_xfer_entry->local,
+        hg_bulk_xfer_entry->local_offset + offset, HG_FALSE);
+
+    while (size > 0 && local_cursor.index < local_cursor.count) {
+        hg_size_t len = HG_BULK_MIN(
+            (hg_bulk_cursor_len(&local_cursor) - local_cursor.offset), size);
+
+        crc = hg_crc32c_update(crc,
+            (const void *) (hg_bulk_cursor_base(&local_cursor) +
+                            local_cursor.offset),
+            (size_t) len);
+        size -= len;
+        hg_bulk_cursor_advance(&local_cursor, len);
+    }
+
+    return crc;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_transfer_self(hg_bulk_op_t op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
-    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size,
-    struct hg_bulk_op_id *hg_bulk_op_id)
-{
-    hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
-    hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
+hg_bulk_transfer_self(struct hg_bulk_op_id *hg_bulk_op_id,
+    const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry)
+{
+    struct hg_bulk_cursor origin_cursor, local_cursor;
     hg_bulk_copy_op_t copy_op;
+    hg_uint32_t crc;
     hg_return_t ret;
 
-    switch (op) {
+    /* Data is checksummed while it is copied */
+    switch (hg_bulk_op_id->callback_info.info.bulk.op) {
         case HG_BULK_PUSH:
-            copy_op = hg_bulk_memcpy_put;
+            copy_op = (hg_bulk_op_id->checksum) ? hg_bulk_memcpy_put_crc
+                                                : hg_bulk_memcpy_put;
             break;
         case HG_BULK_PULL:
-            copy_op = hg_bulk_memcpy_get;
+            copy_op = (hg_bulk_op_id->checksum) ? hg_bulk_memcpy_get_crc
+                                                : hg_bulk_memcpy_get;
             break;
         default:
             HG_GOTO_SUBSYS_ERROR(
@@ -2065,24 +3297,18 @@ hg_bulk_transfer_self(hg_bulk_op_t op,
 
     HG_LOG_SUBSYS_DEBUG(bulk, "Transferring data through self");
 
-    /* Translate origin offset */
-    if (origin_offset > 0)
-        hg_bulk_offset_translate(origin_segments, origin_count, origin_offset,
-            &origin_segment_start_index, &origin_segment_start_offset);
-
-    /* Translate local offset */
-    if (local_offset > 0)
-        hg_bulk_offset_translate(local_segments, local_count, local_offset,
-            &local_segment_start_index, &local_segment_start_offset);
+    /* Translate origin and local offsets */
+    hg_bulk_cursor_init(&origin_cursor, hg_bulk_xfer_entry->origin,
+        hg_bulk_xfer_entry->origin_offset, HG_FALSE);
+    hg_bulk_cursor_init(&local_cursor, hg_bulk_xfer_entry->local,
+        hg_bulk_xfer_entry->local_offset, HG_FALSE);
 
     /* Do actual transfer */
-    hg_bulk_transfer_segments_self(copy_op, origin_segments, origin_count,
-        origin_segment_start_index, origin_segment_start_offset, local_segments,
-        local_count, local_segment_start_index, local_segment_start_offset,
-        size);
-
-    /* Complete immediately */
-    hg_bulk_complete(hg_bulk_op_id, HG_SUCCESS, HG_TRUE);
+    crc = hg_bulk_transfer_segments_self(
+        copy_op, &origin_cursor, &local_cursor, hg_bulk_xfer_entry->size, 0);
+    if (hg_bulk_op_id->checksum)
+        hg_bulk_crc_add(hg_bulk_op_id, crc, hg_bulk_xfer_entry->position,
+            hg_bulk_xfer_entry->size);
 
     return HG_SUCCESS;
 
@@ -2092,78 +3318,167 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static void
+hg_bulk_transfer_self_split(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_size_t size, hg_thread_pool_t *copy_pool, hg_uint32_t copy_threads)
+{
+    const struct hg_bulk_xfer_entry *entries = hg_bulk_op_id->xfer_entries;
+    hg_size_t part_size, offset = 0;
+    hg_uint32_t part_count, entry_index = 0, i;
+
+    /* One part per thread including the calling thread, parts are
+     * cache-line aligned and only the last one may be smaller */
+    part_count = HG_BULK_MIN(copy_threads + 1, HG_BULK_OP_WINDOW);
+    part_size = (size / part_count + 63) & ~((hg_size_t) 63);
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Splitting copy of %" PRIu64 " bytes into %" PRIu32 " parts",
+        (uint64_t) size, part_count);
+
+    for (i = 0; i < part_count; i++) {
+        struct hg_bulk_copy_part *copy_part = &hg_bulk_op_id->copy_parts[i];
+        hg_size_t left;
+
+        copy_part->entry_index = entry_index;
+        copy_part->offset = offset;
+        copy_part->size = HG_BULK_MIN(part_size, size);
+        size -= copy_part->size;
+
+        /* Move to the entry where the next part starts */
+        for (left = copy_part->size; left > 0;) {
+            hg_size_t entry_left = entries[entry_index].size - offset;
+
+            if (left < entry_left) {
+                offset += left;
+                left = 0;
+            } else {
+                left -= entry_left;
+                offset = 0;
+                entry_index++;
+            }
+        }
+    }
+
+    /* Each part releases one window slot */
+    hg_atomic_set32(&hg_bulk_op_id->op_active_count, (int32_t) part_count);
+
+    for (i = 1; i < part_count; i++) {
+        struct hg_bulk_copy_part *copy_part = &hg_bulk_op_id->copy_parts[i];
+
+        if (hg_thread_pool_post(copy_pool, &copy_part->thread_work) !=
+            HG_UTIL_SUCCESS) {
+            HG_LOG_SUBSYS_WARNING(
+                bulk, "Could not post copy part, copying from calling thread");
+            hg_bulk_copy_part_run(copy_part);
+        }
+    }
+
+    /* Calling thread copies first part, op ID must not be accessed after */
+    hg_bulk_copy_part_run(&hg_bulk_op_id->copy_parts[0]);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_copy_part_run(struct hg_bulk_copy_part *hg_bulk_copy_part)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_copy_part->hg_bulk_op_id;
+    hg_size_t offset = hg_bulk_copy_part->offset,
+              remaining_size = hg_bulk_copy_part->size;
+    hg_uint32_t i = hg_bulk_copy_part->entry_index;
+    hg_return_t ret;
+
+    while (remaining_size > 0) {
+        struct hg_bulk_xfer_entry entry = hg_bulk_op_id->xfer_entries[i++];
+
+        /* Sub-range of entry covered by this part */
+        entry.origin_offset += offset;
+        entry.local_offset += offset;
+        entry.position += offset;
+        entry.size = HG_BULK_MIN(entry.size - offset, remaining_size);
+        offset = 0;
+
+        ret = hg_bulk_transfer_self(hg_bulk_op_id, &entry);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not transfer data through self");
+
+        remaining_size -= entry.size;
+    }
+
+    hg_bulk_na_op_release(hg_bulk_op_id, HG_TRUE);
+
+    return;
+
+error:
+    /* Mark handle as errored and keep first non-success ret status */
+    hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+    hg_atomic_cas32(
+        &hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS, (int32_t) ret);
+
+    hg_bulk_na_op_release(hg_bulk_op_id, HG_TRUE);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_bulk_copy_part_thread(void *arg)
+{
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+
+    hg_bulk_copy_part_run((struct hg_bulk_copy_part *) arg);
+
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
 hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size)
-{
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
+    struct hg_bulk_cursor *origin_cursor, struct hg_bulk_cursor *local_cursor,
+    hg_size_t size, hg_uint32_t crc)
+{
     hg_size_t remaining_size = size;
 
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
+    while (remaining_size > 0 && origin_cursor->index < origin_cursor->count &&
+           local_cursor->index < local_cursor->count) {
         /* Can only transfer smallest size */
         hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
+            (hg_bulk_cursor_len(origin_cursor) - origin_cursor->offset),
+            (hg_bulk_cursor_len(local_cursor) - local_cursor->offset));
 
         /* Remaining size may be smaller */
         transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
         /* Copy segment */
-        copy_op(local_segments[local_segment_index].base, local_segment_offset,
-            origin_segments[origin_segment_index].base, origin_segment_offset,
-            transfer_size);
+        crc = copy_op(hg_bulk_cursor_base(local_cursor), local_cursor->offset,
+            hg_bulk_cursor_base(origin_cursor), origin_cursor->offset,
+            transfer_size, crc);
 
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
+        /* Decrease remaining size from the size of data we transferred */
         remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
 
         /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
-
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
-        }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
-        }
+        hg_bulk_cursor_advance(origin_cursor, transfer_size);
+        hg_bulk_cursor_advance(local_cursor, transfer_size);
     }
+
+    return crc;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
-    hg_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
-    hg_uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, hg_uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id)
-{
-    hg_bulk_na_op_id_t *hg_bulk_na_op_ids;
-    na_bulk_op_t na_bulk_op;
+hg_bulk_transfer_na(hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_na_xfer *na_xfer = &hg_bulk_op_id->na_xfer;
+    const struct hg_bulk_xfer_entry *entries = hg_bulk_op_id->xfer_entries;
+    na_op_id_t **na_op_ids;
     hg_return_t ret;
+    unsigned int i;
 
     /* Map op to NA op */
     switch (op) {
         case HG_BULK_PUSH:
-            na_bulk_op = hg_bulk_na_put;
+            na_xfer->na_bulk_op = hg_bulk_na_put;
             break;
         case HG_BULK_PULL:
-            na_bulk_op = hg_bulk_na_get;
+            na_xfer->na_bulk_op = hg_bulk_na_get;
             break;
         default:
             HG_GOTO_SUBSYS_ERROR(
@@ -2171,92 +3486,66 @@ hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
     }
 
 #ifdef NA_HAS_SM
-    /* Use NA SM op IDs if needed */
-    if (origin_flags & HG_BULK_SM)
-        hg_bulk_na_op_ids = &hg_bulk_op_id->na_sm_op_ids;
-    else
+    /* Use SM if we can (all origin handles come from the same origin) */
+    if (entries[0].origin->desc.info.flags & HG_BULK_SM) {
+        HG_LOG_SUBSYS_DEBUG(bulk, "Using NA SM class for this transfer");
+
+        hg_bulk_op_id->na_class = entries[0].origin->na_sm_class;
+        hg_bulk_op_id->na_context =
+            HG_Core_context_get_na_sm(hg_bulk_op_id->core_context);
+        na_xfer->origin_addr = HG_Core_addr_get_na_sm(origin_addr);
+        na_xfer->sm = HG_TRUE;
+        na_op_ids = hg_bulk_op_id->na_sm_op_ids;
+    } else {
+#endif
+        HG_LOG_SUBSYS_DEBUG(bulk, "Using default NA class for this transfer");
+
+        hg_bulk_op_id->na_class = entries[0].origin->na_class;
+        hg_bulk_op_id->na_context =
+            HG_Core_context_get_na(hg_bulk_op_id->core_context);
+        na_xfer->origin_addr = HG_Core_addr_get_na(origin_addr);
+        na_xfer->sm = HG_FALSE;
+        na_op_ids = hg_bulk_op_id->na_op_ids;
+#ifdef NA_HAS_SM
+    }
 #endif
-        hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
-
-    if (((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
-        ((local_flags & HG_BULK_REGV) || local_count == 1)) {
-        na_return_t na_ret;
 
-        HG_LOG_SUBSYS_DEBUG(
-            bulk, "Transferring data through NA in single operation");
+    na_xfer->origin_id = origin_id;
+    na_xfer->chunk_size =
+        hg_core_bulk_chunk_size(hg_bulk_op_id->core_context->core_class);
 
-        na_ret = na_bulk_op(hg_bulk_op_id->na_class, hg_bulk_op_id->na_context,
-            hg_bulk_transfer_cb, hg_bulk_op_id, local_mem_handles[0],
-            local_offset, origin_mem_handles[0], origin_offset, size,
-            na_origin_addr, origin_id, hg_bulk_na_op_ids->s[0]);
-        HG_CHECK_SUBSYS_ERROR(bulk, na_ret != NA_SUCCESS, error, ret,
-            (hg_return_t) na_ret, "Could not transfer data (%s)",
-            NA_Error_to_string(na_ret));
-    } else {
-        hg_uint32_t origin_segment_start_index = 0,
-                    local_segment_start_index = 0;
-        hg_size_t origin_segment_start_offset = 0,
-                  local_segment_start_offset = 0;
-        na_op_id_t **na_op_ids;
-
-        /* Translate bulk_offset */
-        if (origin_offset > 0)
-            hg_bulk_offset_translate(origin_segments, origin_count,
-                origin_offset, &origin_segment_start_index,
-                &origin_segment_start_offset);
-
-        /* Translate block offset */
-        if (local_offset > 0)
-            hg_bulk_offset_translate(local_segments, local_count, local_offset,
-                &local_segment_start_index, &local_segment_start_offset);
-
-        /* Determine number of NA operations that will be needed */
-        hg_bulk_op_id->op_count = hg_bulk_transfer_get_op_count(origin_segments,
-            origin_count, origin_segment_start_index,
-            origin_segment_start_offset, local_segments, local_count,
-            local_segment_start_index, local_segment_start_offset, size);
-        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->op_count == 0, error, ret,
-            HG_INVALID_ARG, "Could not get bulk op_count");
+    /* First entry is loaded when the first chunk is requested */
+    na_xfer->entries = entries;
+    na_xfer->entry_count = hg_bulk_op_id->xfer_count;
+    na_xfer->entry_index = 0;
+    na_xfer->remaining_size = 0;
 
-        HG_LOG_SUBSYS_DEBUG(bulk,
-            "Transferring data through NA in %u operation(s)",
-            hg_bulk_op_id->op_count);
-
-        /* Create extra operation IDs if the number of operations exceeds
-         * the number of pre-allocated op IDs */
-        if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
-            unsigned int i;
-
-            /* Allocate memory for NA operation IDs */
-            hg_bulk_na_op_ids->d =
-                malloc(sizeof(na_op_id_t *) * hg_bulk_op_id->op_count);
-            HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_ids->d == NULL, error,
-                ret, HG_NOMEM, "Could not allocate memory for op_ids");
-
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                hg_bulk_na_op_ids->d[i] =
-                    NA_Op_create(hg_bulk_op_id->na_class, 0);
-                HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_ids->d[i] == NULL,
-                    error, ret, HG_NA_ERROR, "Could not create NA op ID");
-            }
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring %u entries through NA (up to %d operations in flight, "
+        "chunk size %" PRIu64 ")",
+        hg_bulk_op_id->xfer_count, HG_BULK_OP_WINDOW, na_xfer->chunk_size);
+
+    /* Fill window, the extra slot reference prevents the operation from
+     * completing before all slots have been started */
+    hg_atomic_set32(&hg_bulk_op_id->op_active_count, 1);
+    for (i = 0; i < HG_BULK_OP_WINDOW; i++) {
+        hg_bulk_op_id->na_ops[i].na_op_id = na_op_ids[i];
+        hg_bulk_op_id->op_count++;
+        hg_atomic_incr32(&hg_bulk_op_id->op_active_count);
+        if (!hg_bulk_na_op_post(&hg_bulk_op_id->na_ops[i]))
+            break;
+    }
 
-            na_op_ids = hg_bulk_na_op_ids->d;
-        } else
-            na_op_ids = hg_bulk_na_op_ids->s;
-
-        /* Do actual transfer */
-        ret = hg_bulk_transfer_segments_na(hg_bulk_op_id->na_class,
-            hg_bulk_op_id->na_context, na_bulk_op, hg_bulk_transfer_cb,
-            hg_bulk_op_id, na_origin_addr, origin_id, origin_segments,
-            origin_count, origin_mem_handles, origin_segment_start_index,
-            origin_segment_start_offset, local_segments, local_count,
-            local_mem_handles, local_segment_start_index,
-            local_segment_start_offset, size, na_op_ids,
-            hg_bulk_op_id->op_count);
-        HG_CHECK_SUBSYS_HG_ERROR(
-            bulk, error, ret, "Could not transfer data segments");
+    /* Nothing was issued, report error directly */
+    if (i == 0 && (hg_atomic_get32(&hg_bulk_op_id->status) &
+                      HG_BULK_OP_ERRORED)) {
+        ret = (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status);
+        goto error;
     }
 
+    /* Completion is now driven by NA callbacks */
+    hg_bulk_na_op_release(hg_bulk_op_id, HG_TRUE);
+
     return HG_SUCCESS;
 
 error:
@@ -2264,142 +3553,184 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_uint32_t
-hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, hg_size_t origin_segment_start_index,
-    hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size)
-{
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
-    hg_size_t remaining_size = size;
-    hg_uint32_t count = 0;
+static void
+hg_bulk_na_xfer_load(struct hg_bulk_na_xfer *na_xfer,
+    const struct hg_bulk_xfer_entry *hg_bulk_xfer_entry)
+{
+    struct hg_bulk *hg_bulk_origin = hg_bulk_xfer_entry->origin,
+                   *hg_bulk_local = hg_bulk_xfer_entry->local;
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
+    uint8_t local_flags = hg_bulk_local->desc.info.flags;
+    struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
+    hg_bool_t contig;
 
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
-        /* Can only transfer smallest size */
-        hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
+#ifdef NA_HAS_SM
+    if (na_xfer->sm) {
+        origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
+    } else {
+#endif
+        origin_mem_descs = &hg_bulk_origin->na_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_mem_descs;
+#ifdef NA_HAS_SM
+    }
+#endif
 
-        /* Remaining size may be smaller */
-        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
+    na_xfer->origin_mem_handles =
+        HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
+    na_xfer->local_mem_handles =
+        HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
+    na_xfer->remaining_size = hg_bulk_xfer_entry->size;
 
-        /* Increment op count */
-        count++;
+    /* Single handle on each side, only split if chunk size is set */
+    contig = ((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
+             ((local_flags & HG_BULK_REGV) || local_count == 1);
 
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
-        remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
+    hg_bulk_cursor_init(&na_xfer->origin, hg_bulk_origin,
+        hg_bulk_xfer_entry->origin_offset, contig);
+    hg_bulk_cursor_init(&na_xfer->local, hg_bulk_local,
+        hg_bulk_xfer_entry->local_offset, contig);
+}
 
-        /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
-
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
-        }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_na_xfer_next(
+    struct hg_bulk_na_xfer *na_xfer, struct hg_bulk_na_chunk *chunk)
+{
+    struct hg_bulk_cursor *origin = &na_xfer->origin, *local = &na_xfer->local;
+    hg_size_t transfer_size;
+
+    hg_thread_spin_lock(&na_xfer->lock);
+
+    /* Move to next entry once current one has been fully issued, entries
+     * that were copied locally have no size left */
+    while (na_xfer->remaining_size == 0 || origin->index >= origin->count ||
+           local->index >= local->count) {
+        const struct hg_bulk_xfer_entry *entry;
+
+        if (na_xfer->entry_index >= na_xfer->entry_count) {
+            hg_thread_spin_unlock(&na_xfer->lock);
+            return HG_FALSE;
         }
+        entry = &na_xfer->entries[na_xfer->entry_index++];
+        if (entry->size > 0)
+            hg_bulk_na_xfer_load(na_xfer, entry);
     }
 
-    return count;
+    /* Can only transfer smallest size */
+    transfer_size = HG_BULK_MIN((hg_bulk_cursor_len(origin) - origin->offset),
+        (hg_bulk_cursor_len(local) - local->offset));
+
+    /* Remaining size may be smaller */
+    transfer_size = HG_BULK_MIN(na_xfer->remaining_size, transfer_size);
+
+    /* Split large segments */
+    if (na_xfer->chunk_size > 0)
+        transfer_size = HG_BULK_MIN(na_xfer->chunk_size, transfer_size);
+
+    /* Position within current entry is needed to checksum data */
+    chunk->entry = &na_xfer->entries[na_xfer->entry_index - 1];
+    chunk->entry_offset = chunk->entry->size - na_xfer->remaining_size;
+
+    /* Strided blocks all belong to the first mem handle */
+    chunk->origin_mem_handle =
+        na_xfer->origin_mem_handles[(origin->stride > 0) ? 0 : origin->index];
+    chunk->origin_offset = origin->index * origin->stride + origin->offset;
+    chunk->local_mem_handle =
+        na_xfer->local_mem_handles[(local->stride > 0) ? 0 : local->index];
+    chunk->local_offset = local->index * local->stride + local->offset;
+    chunk->size = transfer_size;
+
+    /* Decrease remaining size and increment offsets from the size of data
+     * we transferred */
+    na_xfer->remaining_size -= transfer_size;
+    hg_bulk_cursor_advance(origin, transfer_size);
+    hg_bulk_cursor_advance(local, transfer_size);
+    hg_thread_spin_unlock(&na_xfer->lock);
+
+    return HG_TRUE;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
-    na_bulk_op_t na_bulk_op, na_cb_t callback, void *arg,
-    na_addr_t *origin_addr, uint8_t origin_id,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    na_mem_handle_t **origin_mem_handles, hg_size_t origin_segment_start_index,
-    hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, hg_size_t local_segment_start_index,
-    hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count)
-{
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
-    hg_size_t remaining_size = size;
-    hg_uint32_t count = 0;
-    hg_return_t ret;
-
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
-        /* Can only transfer smallest size */
-        hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
-        na_return_t na_ret;
-
-        /* Remaining size may be smaller */
-        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
+static hg_bool_t
+hg_bulk_na_op_post(struct hg_bulk_na_op *hg_bulk_na_op)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_na_op->hg_bulk_op_id;
+    struct hg_bulk_na_xfer *na_xfer = &hg_bulk_op_id->na_xfer;
+    struct hg_bulk_na_chunk *chunk = &hg_bulk_na_op->chunk;
+    int32_t status = hg_atomic_get32(&hg_bulk_op_id->status);
+    na_return_t na_ret;
 
-        na_ret = na_bulk_op(na_class, na_context, callback, arg,
-            local_mem_handles[local_segment_index], local_segment_offset,
-            origin_mem_handles[origin_segment_index], origin_segment_offset,
-            transfer_size, origin_addr, origin_id, na_op_ids[count]);
-        HG_CHECK_SUBSYS_ERROR(bulk, na_ret != NA_SUCCESS, error, ret,
-            (hg_return_t) na_ret, "Could not transfer data (%s)",
-            NA_Error_to_string(na_ret));
+    /* Stop issuing operations once an error has occurred */
+    if ((status & HG_BULK_OP_ERRORED) ||
+        !hg_bulk_na_xfer_next(na_xfer, chunk))
+        goto release;
 
-        count++;
+    /* Data that is left will not be transferred */
+    if (status & HG_BULK_OP_CANCELED) {
+        hg_atomic_cas32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS,
+            (int32_t) HG_CANCELED);
+        goto release;
+    }
 
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
-        remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
+    na_ret = na_xfer->na_bulk_op(hg_bulk_op_id->na_class,
+        hg_bulk_op_id->na_context, hg_bulk_transfer_cb, hg_bulk_na_op,
+        chunk->local_mem_handle, chunk->local_offset, chunk->origin_mem_handle,
+        chunk->origin_offset, chunk->size, na_xfer->origin_addr,
+        na_xfer->origin_id, hg_bulk_na_op->na_op_id);
+    if (na_ret != NA_SUCCESS) {
+        HG_LOG_SUBSYS_ERROR(
+            bulk, "Could not transfer data (%s)", NA_Error_to_string(na_ret));
 
-        /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
-
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
-        }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
-        }
+        /* Mark handle as errored and keep first non-success ret status */
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+        hg_atomic_cas32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS,
+            (int32_t) na_ret);
+        goto release;
     }
 
-    HG_CHECK_SUBSYS_ERROR(bulk, count != na_op_count, error, ret,
-        HG_PROTOCOL_ERROR, "Expected %u operations, issued %u", na_op_count,
-        count);
+    return HG_TRUE;
 
-    return HG_SUCCESS;
+release:
+    hg_bulk_na_op_release(hg_bulk_op_id, HG_FALSE);
 
-error:
-    return ret;
+    return HG_FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_na_op_release(
+    struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify)
+{
+    /* When all slots of the window are released, complete the bulk
+     * operation */
+    if (hg_atomic_decr32(&hg_bulk_op_id->op_active_count) == 0)
+        hg_bulk_complete(hg_bulk_op_id,
+            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status),
+            self_notify);
 }
 
 /*---------------------------------------------------------------------------*/
 static void
 hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
 {
-    struct hg_bulk_op_id *hg_bulk_op_id =
-        (struct hg_bulk_op_id *) callback_info->arg;
+    struct hg_bulk_na_op *hg_bulk_na_op =
+        (struct hg_bulk_na_op *) callback_info->arg;
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_na_op->hg_bulk_op_id;
 
     if (callback_info->ret == NA_SUCCESS) {
-        /* Nothing */
+        /* Checksum chunk while the other chunks are in flight, this must be
+         * done before the slot can be released */
+        if (hg_bulk_op_id->checksum) {
+            const struct hg_bulk_na_chunk *chunk = &hg_bulk_na_op->chunk;
+
+            hg_bulk_crc_add(hg_bulk_op_id,
+                hg_bulk_xfer_entry_crc(
+                    chunk->entry, chunk->entry_offset, chunk->size),
+                chunk->entry->position + chunk->entry_offset, chunk->size);
+        }
     } else if (callback_info->ret == NA_CANCELED) {
         HG_CHECK_SUBSYS_WARNING(bulk,
             hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_COMPLETED,
@@ -2420,14 +3751,9 @@ hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
             NA_Error_to_string(callback_info->ret));
     }
 
-    /* When all NA transfers that correspond to the bulk operation complete,
-     * complete the bulk operation. */
-    if ((hg_uint32_t) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count) ==
-        hg_bulk_op_id->op_count) {
-        hg_bulk_complete(hg_bulk_op_id,
-            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status),
-            HG_FALSE);
-    }
+    /* Re-use NA op ID for next chunk, slot is released once all the data has
+     * been issued */
+    (void) hg_bulk_na_op_post(hg_bulk_na_op);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2438,21 +3764,25 @@ hg_bulk_complete(
     /* Mark op id as completed */
     hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
 
-    /* Forward status to callback */
+    /* Forward status and checksum to callback */
     hg_bulk_op_id->callback_info.ret = ret;
+    hg_bulk_op_id->callback_info.info.bulk.checksum =
+        (hg_uint32_t) hg_atomic_get32(&hg_bulk_op_id->crc);
 
     hg_bulk_op_id->hg_completion_entry.op_type = HG_BULK;
     hg_bulk_op_id->hg_completion_entry.op_id.hg_bulk_op_id = hg_bulk_op_id;
 
-    hg_core_completion_add(hg_bulk_op_id->core_context,
+    ret = hg_core_completion_add(hg_bulk_op_id->core_context,
         &hg_bulk_op_id->hg_completion_entry, self_notify);
+    HG_CHECK_SUBSYS_ERROR_DONE(bulk, ret != HG_SUCCESS,
+        "Could not add bulk op ID (%p) to completion queue",
+        (void *) hg_bulk_op_id);
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
 {
-    na_op_id_t **na_op_ids;
     hg_return_t ret;
     int32_t status;
     unsigned int i;
@@ -2468,18 +3798,10 @@ hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
         HG_BULK_OP_CANCELED)
         return HG_SUCCESS;
 
-#ifdef NA_HAS_SM
-    if (hg_bulk_op_id->na_class ==
-        hg_bulk_op_id->core_context->core_class->na_sm_class)
-        na_op_ids = HG_BULK_NA_SM_OP_IDS(hg_bulk_op_id);
-    else
-#endif
-        na_op_ids = HG_BULK_NA_OP_IDS(hg_bulk_op_id);
-
-    /* Cancel all NA operations issued */
+    /* Cancel all NA operations in flight, no further operation is issued */
     for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-        na_return_t na_ret = NA_Cancel(
-            hg_bulk_op_id->na_class, hg_bulk_op_id->na_context, na_op_ids[i]);
+        na_return_t na_ret = NA_Cancel(hg_bulk_op_id->na_class,
+            hg_bulk_op_id->na_context, hg_bulk_op_id->na_ops[i].na_op_id);
         HG_CHECK_SUBSYS_ERROR(bulk, na_ret != NA_SUCCESS, error, ret,
             (hg_return_t) na_ret, "Could not cancel NA op ID (%s)",
             NA_Error_to_string(na_ret));
@@ -2501,12 +3823,9 @@ hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
     if (hg_bulk_op_id->callback)
         hg_bulk_op_id->callback(&hg_bulk_op_id->callback_info);
 
-    /* Decrement ref_count */
-    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.origin_handle);
-    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not free origin handle");
-
-    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.local_handle);
-    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not free local handle");
+    /* Decrement ref_count of handles used by transfer entries */
+    ret = hg_bulk_xfer_entries_release(hg_bulk_op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not release handles");
 
     /* Release bulk op ID (can be released after callback execution since
      * op IDs are managed internally) */
@@ -2602,6 +3921,55 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_create_strided(hg_class_t *hg_class, void *base, hg_size_t block_len,
+    hg_size_t stride, hg_uint32_t count, hg_uint8_t flags, hg_bulk_t *handle)
+{
+    struct hg_bulk_attr attrs = {.mem_type = HG_MEM_TYPE_HOST, .device = 0};
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, hg_class == NULL, error, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, base == NULL, error, ret, HG_INVALID_ARG, "NULL base pointer");
+    HG_CHECK_SUBSYS_ERROR(bulk, count == 0, error, ret, HG_INVALID_ARG,
+        "Invalid number of blocks");
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, block_len == 0, error, ret, HG_INVALID_ARG, "Invalid block size");
+    HG_CHECK_SUBSYS_ERROR(bulk, stride < block_len, error, ret,
+        HG_INVALID_ARG,
+        "Stride (%" PRIu64 ") cannot be smaller than block size (%" PRIu64 ")",
+        stride, block_len);
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        count > 1 && stride > (UINT64_MAX - block_len) / (count - 1), error,
+        ret, HG_OVERFLOW, "Strided layout exceeds address space");
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
+        case HG_BULK_READ_ONLY:
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_GOTO_SUBSYS_ERROR(
+                bulk, error, ret, HG_INVALID_ARG, "Unrecognized handle flag");
+    }
+
+    HG_LOG_SUBSYS_DEBUG(
+        bulk, "Creating new strided bulk handle with %u block(s)", count);
+
+    ret = hg_bulk_create_strided(hg_class->core_class, base, block_len, stride,
+        count, flags, &attrs, (struct hg_bulk **) handle);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not create bulk handle");
+
+    HG_LOG_SUBSYS_DEBUG(bulk, "Created new bulk handle (%p)", (void *) *handle);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Bulk_free(hg_bulk_t handle)
@@ -2971,6 +4339,85 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_list(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
+    const struct hg_bulk_transfer_desc *descs, hg_uint32_t count,
+    hg_op_id_t *op_id)
+{
+    hg_return_t ret;
+    hg_uint32_t i;
+
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, context == NULL, error, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_SUBSYS_ERROR(bulk, origin_addr == HG_ADDR_NULL, error, ret,
+        HG_INVALID_ARG, "NULL origin addr");
+    HG_CHECK_SUBSYS_ERROR(bulk, descs == NULL || count == 0, error, ret,
+        HG_INVALID_ARG, "NULL or empty transfer descriptor list");
+
+    for (i = 0; i < count; i++) {
+        const struct hg_bulk *hg_bulk_origin =
+            (const struct hg_bulk *) descs[i].origin_handle;
+        const struct hg_bulk *hg_bulk_local =
+            (const struct hg_bulk *) descs[i].local_handle;
+
+        /* Origin handle sanity checks */
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin == NULL, error, ret,
+            HG_INVALID_ARG, "NULL origin handle passed (descriptor %u)", i);
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            (descs[i].origin_offset + descs[i].size) >
+                hg_bulk_origin->desc.info.len,
+            error, ret, HG_INVALID_ARG,
+            "Exceeding size of memory exposed by origin handle (%" PRIu64
+            " + %" PRIu64 " > %" PRIu64 ", descriptor %u)",
+            descs[i].origin_offset, descs[i].size,
+            hg_bulk_origin->desc.info.len, i);
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin->addr != HG_CORE_ADDR_NULL,
+            error, ret, HG_INVALID_ARG,
+            "Address information embedded into origin_handle (descriptor %u)",
+            i);
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            (hg_bulk_origin->desc.info.flags & HG_BULK_SM) !=
+                (((struct hg_bulk *) descs[0].origin_handle)->desc.info.flags &
+                    HG_BULK_SM),
+            error, ret, HG_INVALID_ARG,
+            "Origin handles do not originate from the same origin "
+            "(descriptor %u)",
+            i);
+
+        /* Local handle sanity checks */
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_local == NULL, error, ret,
+            HG_INVALID_ARG, "NULL local handle passed (descriptor %u)", i);
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            (descs[i].local_offset + descs[i].size) >
+                hg_bulk_local->desc.info.len,
+            error, ret, HG_INVALID_ARG,
+            "Exceeding size of memory exposed by local handle (%" PRIu64
+            " + %" PRIu64 " > %" PRIu64 ", descriptor %u)",
+            descs[i].local_offset, descs[i].size,
+            hg_bulk_local->desc.info.len, i);
+
+        /* Check permission flags */
+        HG_BULK_CHECK_FLAGS(op, hg_bulk_origin->desc.info.flags,
+            hg_bulk_local->desc.info.flags, error, ret);
+    }
+
+    HG_LOG_SUBSYS_DEBUG(bulk, "Transferring data from list of %u descriptors",
+        count);
+
+    /* Do bulk transfer */
+    ret = hg_bulk_transfer_list(context->core_context, callback, arg, op,
+        (hg_core_addr_t) origin_addr, origin_id, descs, count, op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not start transfer of bulk data");
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Bulk_cancel(hg_op_id_t op_id)
@@ -2991,3 +4438,72 @@ HG_Bulk_cancel(hg_op_id_t op_id)
 error:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_reg_cache_invalidate(
+    hg_class_t *hg_class, const void *buf, hg_size_t buf_size)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache;
+    struct hg_bulk_reg_entry *overlap_list = NULL, *release_list = NULL;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_class == NULL, error, ret, HG_INVALID_ARG,
+        "NULL HG class");
+
+    hg_bulk_reg_cache = hg_core_bulk_reg_cache(hg_class->core_class);
+    if (hg_bulk_reg_cache == NULL || buf_size == 0)
+        return HG_SUCCESS;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Invalidating cached registrations in range [%p, %p)", buf,
+        (const void *) ((const char *) buf + buf_size));
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->mutex);
+    hg_bulk_reg_tree_overlap(hg_bulk_reg_cache->root, (hg_ptr_t) buf,
+        (hg_ptr_t) buf + buf_size, &overlap_list);
+    while (overlap_list != NULL) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry = overlap_list;
+
+        overlap_list = hg_bulk_reg_entry->next;
+        hg_bulk_reg_cache_evict(
+            hg_bulk_reg_cache, hg_bulk_reg_entry, &release_list);
+    }
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+    hg_bulk_reg_entries_release(release_list);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_reg_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_reg_cache_stats *stats_p)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_class == NULL, error, ret, HG_INVALID_ARG,
+        "NULL HG class");
+    HG_CHECK_SUBSYS_ERROR(bulk, stats_p == NULL, error, ret, HG_INVALID_ARG,
+        "NULL stats pointer");
+
+    hg_bulk_reg_cache = hg_core_bulk_reg_cache(hg_class->core_class);
+    if (hg_bulk_reg_cache == NULL) {
+        memset(stats_p, 0, sizeof(*stats_p));
+        return HG_SUCCESS;
+    }
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->mutex);
+    *stats_p = hg_bulk_reg_cache->stats;
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->mutex);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
@@ -80,6 +80,34 @@ HG_Bulk_create_attr(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
     const hg_size_t *buf_sizes, hg_uint8_t flags,
     const struct hg_bulk_attr *attrs, hg_bulk_t *handle);
 
+/**
+ * Create an abstract bulk handle from a strided memory layout, i.e., count
+ * blocks of block_len bytes, the start of each block being stride bytes
+ * apart from the previous one (e.g., a column of a row-major matrix).
+ * The region spanned by the blocks is registered once and the handle is
+ * serialized in constant size regardless of the number of blocks.
+ * \remark Offsets and sizes passed to transfer and access routines only
+ * account for the data contained in the blocks, segments returned by
+ * HG_Bulk_access() correspond to individual blocks.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param base [IN]             pointer to first block
+ * \param block_len [IN]        size of each block
+ * \param stride [IN]           distance in bytes between start of blocks
+ *                              (must not be smaller than block_len)
+ * \param count [IN]            number of blocks
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_create_strided(hg_class_t *hg_class, void *base, hg_size_t block_len,
+    hg_size_t stride, hg_uint32_t count, hg_uint8_t flags, hg_bulk_t *handle);
+
 /**
  * Free bulk handle.
  *
@@ -185,6 +213,8 @@ HG_Bulk_get_size(hg_bulk_t handle);
 
 /**
  * Get total number of segments abstracted by bulk handle.
+ * \remark Handles created with HG_Bulk_create_strided() report the region
+ * spanned by their blocks as one single segment.
  *
  * \param handle [IN]           abstract bulk handle
  *
@@ -326,6 +356,40 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
     hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
     hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
 
+/**
+ * Transfer a list of independent data regions to/from origin using abstract
+ * bulk handles and explicit origin address information. All transfers target
+ * the same origin and are issued as a single operation: user callback is
+ * placed into the completion queue only once, after all transfers have
+ * completed, and can be triggered using HG_Trigger(). The size reported in
+ * the callback info is the total size of all transfers and the handles
+ * reported are those of the first descriptor. A single operation ID is
+ * returned and can be used to cancel all the transfers. Descriptors are
+ * copied and may be released once this call returns.
+ *
+ * \remark Origin handles must not have address information embedded (see
+ * HG_Bulk_bind()) and must all originate from the same origin.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_id [IN]        context ID of origin
+ * \param descs [IN]            array of transfer descriptors
+ * \param count [IN]            number of descriptors
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_transfer_list(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
+    const struct hg_bulk_transfer_desc *descs, hg_uint32_t count,
+    hg_op_id_t *op_id);
+
 /**
  * Cancel an ongoing operation.
  *
@@ -336,6 +400,37 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
 HG_PUBLIC hg_return_t
 HG_Bulk_cancel(hg_op_id_t op_id);
 
+/**
+ * Invalidate registrations kept by the bulk registration cache (see
+ * bulk_reg_cache_size in hg_init_info) that overlap the memory range
+ * [buf, buf + buf_size). This must be called before memory that was used to
+ * create bulk handles is unmapped or freed. Registrations that are still used
+ * by existing bulk handles are no longer re-used and are released when these
+ * handles are freed. This call has no effect if the cache is not enabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param buf [IN]              start of memory range
+ * \param buf_size [IN]         size of memory range
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_reg_cache_invalidate(
+    hg_class_t *hg_class, const void *buf, hg_size_t buf_size);
+
+/**
+ * Retrieve stats of the bulk registration cache. Stats are all zero if the
+ * cache is not enabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param stats_p [OUT]         pointer to stats struct
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_reg_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_reg_cache_stats *stats_p);
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -345,6 +440,7 @@ struct hg_bulk_desc_info {
     hg_size_t len;             /* Size of region */
     hg_uint32_t segment_count; /* Segment count */
     hg_uint8_t flags;          /* Flags of operation access */
+    hg_uint8_t layout;         /* Layout of segments */
 };
 
 /*---------------------------------------------------------------------------*/
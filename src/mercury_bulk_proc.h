@@ -42,6 +42,13 @@ hg_bulk_get_serialize_cached_ptr(hg_bulk_t handle);
 HG_PRIVATE hg_size_t
 hg_bulk_get_serialize_cached_size(hg_bulk_t handle);
 
+/**
+ * Get max size of data that can be embedded along with handle descriptor
+ * (0 if only limited by the space left in the eager buffer).
+ */
+HG_PRIVATE hg_size_t
+hg_bulk_get_eager_size_max(hg_bulk_t handle);
+
 /**
  * Set cached pointer to serialization buffer.
  */
@@ -11,16 +11,13 @@
 #include "mercury_atomic_queue.h"
 #include "mercury_error.h"
 #include "mercury_event.h"
-#include "mercury_hash_table.h"
 #include "mercury_list.h"
 #include "mercury_mem.h"
 #include "mercury_param.h"
 #include "mercury_poll.h"
-#include "mercury_queue.h"
 #include "mercury_thread_condition.h"
 #include "mercury_thread_mutex.h"
 #include "mercury_thread_pool.h"
-#include "mercury_thread_rwlock.h"
 #include "mercury_thread_spin.h"
 #include "mercury_time.h"
 
@@ -38,14 +35,45 @@
 /* Private flags */
 #define HG_CORE_SELF_FORWARD (1 << 3) /* Forward to self */
 
+/* Initial number of RPC map buckets and average number of entries per bucket
+ * before the map is grown */
+#define HG_CORE_MAP_BUCKETS_INIT (64)
+#define HG_CORE_MAP_LOAD         (2)
+
 /* Size of comletion queue used for holding completed requests */
 #define HG_CORE_ATOMIC_QUEUE_SIZE (1024)
 
+/* Max size of completion queue that can be requested */
+#define HG_CORE_COMPLETION_QUEUE_SIZE_MAX (1 << 24)
+
+/* Size of the local completion queue of each engine worker */
+#define HG_CORE_ENGINE_QUEUE_SIZE (1024)
+
+/* Timeout (ms) after which engine threads check whether they must stop */
+#define HG_CORE_ENGINE_TIMEOUT (100)
+
+/* Default and max busy-poll window (us) of adaptive progress */
+#define HG_CORE_PROGRESS_SPIN_TIME_DEFAULT (100)
+#define HG_CORE_PROGRESS_SPIN_TIME_MAX     (1000000)
+
+/* Number of consecutive short blocking waits after which adaptive progress
+ * attempts to busy-poll again */
+#define HG_CORE_PROGRESS_SPIN_PROBE (64)
+
+/* Max number of backfill segments, each segment being twice the size of the
+ * previous one, starting from HG_CORE_ATOMIC_QUEUE_SIZE */
+#define HG_CORE_BACKFILL_SEGMENT_MAX (16)
+
 /* Pre-posted requests and op IDs */
 #define HG_CORE_POST_INIT          (512)
 #define HG_CORE_POST_INCR          (512)
 #define HG_CORE_BULK_OP_INIT_COUNT (256)
 
+/* Free handles kept in lock-free caches (must be a power of 2) and number of
+ * handles moved at once between a cache and its shared spill list */
+#define HG_CORE_HANDLE_CACHE_SIZE  (256)
+#define HG_CORE_HANDLE_CACHE_BATCH (32)
+
 /* Number of multi-recv buffer pre-posted */
 #define HG_CORE_MULTI_RECV_OP_MAX (4)
 
@@ -56,6 +84,9 @@
 #define HG_CORE_MAX_EVENTS        (1)
 #define HG_CORE_MAX_TRIGGER_COUNT (1)
 
+/* Max number of completion entries claimed at once by batched trigger */
+#define HG_CORE_TRIGGER_BATCH_MAX (64)
+
 #ifdef NA_HAS_SM
 /* Addr string format */
 #    define HG_CORE_ADDR_MAX_SIZE      (256)
@@ -131,20 +162,55 @@
 
 /* Saved init info */
 struct hg_core_init_info {
+    hg_size_t bulk_chunk_size;          /* Max size of bulk NA operations */
+    hg_size_t bulk_eager_size_max;      /* Max size of eager bulk data */
     hg_uint32_t request_post_init;      /* Init request count */
     hg_uint32_t request_post_incr;      /* Increment request count */
+    hg_uint32_t completion_queue_size;  /* Completion queue size */
+    hg_uint32_t trigger_workers;        /* Number of engine workers */
+    hg_uint32_t bulk_copy_threads;      /* Number of bulk copy threads */
+    hg_uint32_t progress_spin_time;     /* Max busy-poll window (us) */
     hg_checksum_level_t checksum_level; /* Checksum level */
     uint8_t progress_mode;              /* Progress mode */
     hg_bool_t loopback;                 /* Use loopback capability */
     hg_bool_t na_ext_init;              /* NA externally initialized */
     hg_bool_t multi_recv;               /* Use multi-recv capability */
     hg_bool_t listen;                   /* Listening on incoming RPC requests */
+    hg_bool_t numa_local;               /* Allocate on local NUMA node */
+    hg_bool_t progress_spin_adaptive;   /* Self-tune busy-poll window */
+    hg_bool_t bulk_checksum;            /* Checksum bulk data */
+};
+
+/* RPC map entry */
+struct hg_core_map_entry {
+    hg_id_t id;                        /* RPC ID */
+    struct hg_core_rpc_info *rpc_info; /* RPC info */
+};
+
+/* RPC map bucket (immutable once published) */
+struct hg_core_map_bucket {
+    struct hg_core_map_bucket *retired; /* Next retired bucket */
+    unsigned int count;                 /* Number of entries */
+    struct hg_core_map_entry entries[]; /* Entries */
+};
+
+/* RPC map table of buckets (replaced when resized) */
+struct hg_core_map_table {
+    struct hg_core_map_table *retired; /* Next retired table */
+    unsigned int mask;                 /* Number of buckets - 1 */
+    hg_atomic_int64_t buckets[];       /* Published buckets */
 };
 
-/* RPC map */
+/* RPC map (lookups are lock-free and do not write to shared memory, updates
+ * are serialized and copy buckets that are then published, replaced buckets
+ * and tables are retired until the map is freed since lookups may run from
+ * any thread, outside of progress, and still hold references to them) */
 struct hg_core_map {
-    hg_thread_rwlock_t lock; /* Map RW lock */
-    hg_hash_table_t *map;    /* Map */
+    hg_thread_mutex_t lock;                     /* Update lock */
+    hg_atomic_int64_t table;                    /* Published table */
+    struct hg_core_map_table *retired_tables;   /* Retired tables */
+    struct hg_core_map_bucket *retired_buckets; /* Retired buckets */
+    unsigned int count;                         /* Number of entries */
 };
 
 /* More data callbacks */
@@ -165,6 +231,26 @@ struct hg_core_counters {
     hg_atomic_int64_t *bulk_count;           /* Bulk count */
 };
 
+/* Progress engine trigger worker */
+struct hg_core_engine_worker {
+    struct hg_thread_work thread_work; /* Thread pool work */
+    struct hg_core_engine *engine;     /* Parent engine */
+    struct hg_atomic_queue *queue;     /* Local queue of completion entries */
+    unsigned int id;                   /* Worker index */
+};
+
+/* Progress engine */
+struct hg_core_engine {
+    struct hg_core_engine_worker *workers; /* Trigger workers */
+    hg_thread_pool_t *thread_pool;         /* Pool running trigger workers */
+    hg_thread_cond_t cond;                 /* Idle cond */
+    hg_thread_mutex_t mutex;               /* Idle mutex */
+    hg_atomic_int32_t sleepers;            /* Number of idle workers */
+    hg_atomic_int32_t next;                /* Next worker to dispatch to */
+    hg_atomic_int32_t shutdown;            /* Workers must exit */
+    unsigned int worker_count;             /* Number of workers */
+};
+
 /* HG class */
 struct hg_core_private_class {
     struct hg_core_class core_class;    /* Must remain as first field */
@@ -174,6 +260,9 @@ struct hg_core_private_class {
 #endif
     struct hg_core_map rpc_map;               /* RPC Map */
     struct hg_core_more_data_cb more_data_cb; /* More data callbacks */
+    struct hg_core_engine *engine;            /* Progress engine */
+    struct hg_bulk_reg_cache *bulk_reg_cache; /* Bulk registration cache */
+    hg_thread_pool_t *bulk_copy_pool;         /* Bulk copy helper threads */
     na_tag_t request_max_tag;                 /* Max value for tag */
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
     struct hg_core_counters counters; /* Diag counters */
@@ -193,12 +282,28 @@ typedef enum hg_core_poll_type {
     HG_CORE_POLL_NA
 } hg_core_poll_type_t;
 
-/* Completion queue */
-struct hg_core_completion_queue {
-    HG_QUEUE_HEAD(hg_completion_entry) queue; /* Completion queue */
-    hg_thread_cond_t cond;                    /* Completion queue cond */
-    hg_thread_mutex_t mutex;                  /* Completion queue mutex */
-    hg_atomic_int32_t count;                  /* Number of entries */
+/* Backfill queue (growable set of lock-free ring segments) */
+struct hg_core_backfill_queue {
+    hg_atomic_int64_t segments[HG_CORE_BACKFILL_SEGMENT_MAX]; /* Segments */
+    hg_atomic_int32_t count; /* Number of entries */
+    hg_atomic_int32_t tail;  /* Segment entries are pushed to */
+    int numa_node;           /* NUMA node of segments (-1 if none) */
+};
+
+/* Completion notifications */
+struct hg_core_completion_notify {
+    hg_thread_cond_t cond;     /* Notify cond */
+    hg_thread_mutex_t mutex;   /* Notify mutex */
+    hg_atomic_int32_t waiters; /* Number of threads waiting in trigger */
+};
+
+/* Busy-polling state and stats */
+struct hg_core_progress_spin {
+    hg_atomic_int64_t spin_count;  /* Busy-poll phases */
+    hg_atomic_int64_t spin_hits;   /* Busy-poll phases that progressed */
+    hg_atomic_int64_t sleep_count; /* Blocking waits */
+    hg_atomic_int32_t time;        /* Current busy-poll window (us) */
+    hg_atomic_int32_t probe_count; /* Consecutive short blocking waits */
 };
 
 /* List of handles */
@@ -240,22 +345,31 @@ struct hg_core_handle_pool {
     unsigned long flags;                     /* Handle create flags */
     na_class_t *na_class;                    /* NA class */
     na_context_t *na_context;                /* NA context */
-    struct hg_core_handle_list pending_list; /* Pending handle list */
-    unsigned int count;                      /* Number of handles */
-    unsigned int incr_count;                 /* Incremement count */
-    hg_bool_t extending;                     /* When extending the pool */
+    struct hg_atomic_queue *cache;           /* Free handles (multi-recv) */
+    struct hg_core_handle_list pending_list; /* Handles owned by pool */
+    HG_LIST_HEAD(hg_core_private_handle) spill_list; /* Cache overflow */
+    hg_atomic_int32_t posted_count;                  /* Posted handles */
+    unsigned int count;                              /* Number of handles */
+    unsigned int incr_count;                         /* Incremement count */
+    hg_bool_t extending; /* When extending the pool */
 };
 
 /* HG context */
 struct hg_core_private_context {
     struct hg_core_context core_context; /* Must remain as first field */
-    struct hg_core_completion_queue backfill_queue; /* Backfill queue */
+    struct hg_core_backfill_queue backfill_queue;   /* Backfill queue */
     struct hg_atomic_queue *completion_queue;       /* Default queue */
+    struct hg_core_completion_notify completion_notify; /* Trigger notify */
     struct hg_core_loopback_notify loopback_notify; /* Loopback notification */
+    struct hg_core_progress_spin progress_spin;     /* Busy-polling state */
     struct hg_core_handle_list created_list;        /* Created handle list */
     struct hg_core_handle_pool *handle_pool;        /* Pool of handles */
 #ifdef NA_HAS_SM
     struct hg_core_handle_pool *sm_handle_pool; /* Pool of SM handles */
+#endif
+    struct hg_atomic_queue *handle_cache; /* Free handles for re-use */
+#ifdef NA_HAS_SM
+    struct hg_atomic_queue *sm_handle_cache; /* Free SM handles for re-use */
 #endif
     struct hg_core_multi_recv_op multi_recv_ops[HG_CORE_MULTI_RECV_OP_MAX];
     struct hg_core_handle_create_cb handle_create_cb;     /* Handle create cb */
@@ -268,6 +382,12 @@ struct hg_core_private_context {
 #endif
     hg_atomic_int32_t multi_recv_op_count; /* Number of multi-recv posted */
     hg_atomic_int32_t n_handles;           /* Number of handles */
+    hg_atomic_int32_t engine_pending;      /* Entries dispatched to workers */
+    hg_atomic_int32_t engine_triggered;    /* Entries triggered by workers */
+    hg_atomic_int32_t engine_stop;         /* Stop engine progress thread */
+    hg_thread_t engine_thread;             /* Engine progress thread */
+    int numa_node;                         /* NUMA node (-1 if none) */
+    hg_bool_t engine_running;              /* Engine progress thread runs */
     hg_bool_t finalizing;                  /* Prevent re-using handles */
 };
 
@@ -316,6 +436,8 @@ struct hg_core_private_handle {
     struct hg_completion_entry hg_completion_entry; /* Completion queue entry */
     HG_LIST_ENTRY(hg_core_private_handle) created;  /* Created list entry */
     HG_LIST_ENTRY(hg_core_private_handle) pending;  /* Pending list entry */
+    HG_LIST_ENTRY(hg_core_private_handle) spill;    /* Spill list entry */
+    struct hg_core_handle_pool *handle_pool;        /* Pool owning handle */
     struct hg_core_header in_header;                /* Input header */
     struct hg_core_header out_header;               /* Output header */
     na_class_t *na_class;                           /* NA class */
@@ -341,6 +463,7 @@ struct hg_core_private_handle {
     hg_atomic_int32_t no_response_done; /* Reference count to reach for done */
     hg_atomic_int32_t status;           /* Handle status */
     hg_atomic_int32_t ret_status;       /* Handle return status */
+    hg_atomic_int32_t recv_posted;      /* Pool handle waiting for request */
     unsigned int op_completed_count;    /* Completed operation count */
     unsigned int
         op_expected_count;     /* Expected operation count for completion */
@@ -419,7 +542,23 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class);
  */
 static hg_return_t
 hg_core_context_create(struct hg_core_private_class *hg_core_class,
-    hg_uint8_t id, struct hg_core_private_context **context_p);
+    hg_uint8_t id, const struct hg_context_init_info *hg_context_init_info,
+    struct hg_core_private_context **context_p);
+
+/**
+ * Prefer allocating memory on NUMA node from the calling thread, previous
+ * memory policy of the thread is saved to policy. Node is reset to -1 if the
+ * policy cannot be applied.
+ */
+static void
+hg_core_context_numa_enter(int *numa_node_p, struct hg_mem_numa_policy *policy);
+
+/**
+ * Restore memory allocation policy of the calling thread.
+ */
+static void
+hg_core_context_numa_leave(
+    int numa_node, const struct hg_mem_numa_policy *policy);
 
 /**
  * Destroy context.
@@ -474,11 +613,30 @@ static hg_return_t
 hg_core_context_check_handles(struct hg_core_private_context *context);
 
 /**
- * Wail until handle lists are empty.
+ * Wait until count of handles drops to zero.
  */
 static hg_return_t
-hg_core_context_list_wait(struct hg_core_private_context *context,
-    struct hg_core_handle_list *handle_list);
+hg_core_context_wait(
+    struct hg_core_private_context *context, hg_atomic_int32_t *count);
+
+/**
+ * Take handle from context cache of free handles.
+ */
+static HG_INLINE struct hg_core_private_handle *
+hg_core_context_cache_get(
+    struct hg_core_private_context *context, na_class_t *na_class);
+
+/**
+ * Reset handle and place it into context cache of free handles.
+ */
+static hg_bool_t
+hg_core_context_cache_put(struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Free all handles from context cache of free handles.
+ */
+static void
+hg_core_context_cache_drain(struct hg_core_private_context *context);
 
 /**
  * Create pool of handles.
@@ -495,12 +653,6 @@ hg_core_handle_pool_create(struct hg_core_private_context *context,
 static void
 hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool);
 
-/**
- * Pool is empty.
- */
-static HG_INLINE hg_bool_t
-hg_core_handle_pool_empty(struct hg_core_handle_pool *hg_core_handle_pool);
-
 /**
  * Get handle from pool and extend pool if needed.
  */
@@ -508,6 +660,25 @@ static hg_return_t
 hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
     struct hg_core_private_handle **hg_core_handle_p);
 
+/**
+ * Refill cache of free handles from spill list.
+ */
+static struct hg_core_private_handle *
+hg_core_handle_pool_refill(struct hg_core_handle_pool *hg_core_handle_pool);
+
+/**
+ * Return free handle to pool.
+ */
+static void
+hg_core_handle_pool_release(struct hg_core_handle_pool *hg_core_handle_pool,
+    struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Remove handle from pool.
+ */
+static void
+hg_core_handle_pool_remove(struct hg_core_private_handle *hg_core_handle);
+
 /**
  * Extend pool of handles with incr_count handles.
  */
@@ -523,28 +694,59 @@ hg_core_handle_pool_insert(struct hg_core_private_context *context,
     struct hg_core_handle_pool *hg_core_handle_pool);
 
 /**
- * Cancel pending operations on pool until pending list is empty.
+ * Post handle from pool.
+ */
+static hg_return_t
+hg_core_handle_pool_post(struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Cancel posted handles of pool until none remains posted.
  */
 static hg_return_t
 hg_core_handle_pool_unpost(struct hg_core_handle_pool *hg_core_handle_pool);
 
 /**
- * Hash map keys based on RPC ID.
+ * Initialize RPC map.
+ */
+static hg_return_t
+hg_core_map_init(struct hg_core_map *hg_core_map);
+
+/**
+ * Free RPC map and all its entries.
+ */
+static void
+hg_core_map_free(struct hg_core_map *hg_core_map);
+
+/**
+ * Allocate table of buckets.
+ */
+static struct hg_core_map_table *
+hg_core_map_table_alloc(unsigned int bucket_count);
+
+/**
+ * Grow table and publish it.
+ */
+static hg_return_t
+hg_core_map_table_grow(struct hg_core_map *hg_core_map);
+
+/**
+ * Hash RPC ID.
  */
 static HG_INLINE unsigned int
-hg_core_map_hash(hg_hash_table_key_t key);
+hg_core_map_hash(hg_id_t id);
 
 /**
- * Determine if map keys are equal using RPC ID.
+ * Publish new bucket and retire old one.
  */
-static HG_INLINE int
-hg_core_map_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2);
+static void
+hg_core_map_bucket_publish(struct hg_core_map *hg_core_map,
+    hg_atomic_int64_t *slot, struct hg_core_map_bucket *bucket);
 
 /**
- * Free value in map.
+ * Free RPC info.
  */
 static void
-hg_core_map_value_free(hg_hash_table_value_t value);
+hg_core_map_value_free(struct hg_core_rpc_info *hg_core_rpc_info);
 
 /**
  * Lookup entry for RPC ID.
@@ -883,6 +1085,20 @@ static hg_return_t
 hg_core_progress(
     struct hg_core_private_context *context, unsigned int timeout_ms);
 
+/**
+ * Busy-poll context for up to spin_time us and adjust window if adaptive.
+ */
+static hg_return_t
+hg_core_progress_spin(struct hg_core_private_context *context,
+    unsigned int spin_time, hg_bool_t *progressed_p);
+
+/**
+ * Re-enable busy-polling after enough short blocking waits.
+ */
+static void
+hg_core_progress_spin_probe(struct hg_core_private_context *context,
+    hg_time_t wait_start, hg_bool_t progressed);
+
 /**
  * Determines when it is safe to block.
  */
@@ -925,6 +1141,125 @@ hg_core_trigger(struct hg_core_private_context *context,
     unsigned int timeout_ms, unsigned int max_count,
     unsigned int *actual_count_p);
 
+/**
+ * Trigger callbacks by claiming batches of completion entries.
+ */
+static hg_return_t
+hg_core_trigger_batch(struct hg_core_private_context *context,
+    unsigned int timeout_ms, unsigned int max_count,
+    unsigned int *actual_count_p);
+
+/**
+ * Push entry to backfill queue, allocate new segments as needed.
+ */
+static hg_return_t
+hg_core_backfill_push(struct hg_core_backfill_queue *backfill_queue,
+    struct hg_completion_entry *hg_completion_entry);
+
+/**
+ * Pop at most max_count entries from backfill queue.
+ */
+static unsigned int
+hg_core_backfill_pop_batch(struct hg_core_private_context *context,
+    void **entries, unsigned int max_count);
+
+/**
+ * Free backfill segments.
+ */
+static void
+hg_core_backfill_free(struct hg_core_backfill_queue *backfill_queue);
+
+/**
+ * Determine whether completion queues are empty.
+ */
+static HG_INLINE hg_bool_t
+hg_core_completion_queue_empty(struct hg_core_private_context *context);
+
+/**
+ * Wait until completion queues are no longer empty or deadline is reached.
+ */
+static hg_return_t
+hg_core_completion_wait(
+    struct hg_core_private_context *context, hg_time_t deadline, hg_time_t now);
+
+/**
+ * Trigger array of completion entries, grouped by type.
+ */
+static hg_return_t
+hg_core_trigger_entries(void **entries, unsigned int count);
+
+/**
+ * Create progress engine and start trigger workers.
+ */
+static hg_return_t
+hg_core_engine_create(
+    unsigned int worker_count, struct hg_core_engine **engine_p);
+
+/**
+ * Stop trigger workers and destroy progress engine.
+ */
+static void
+hg_core_engine_destroy(struct hg_core_engine *engine);
+
+/**
+ * Start engine progress thread of context.
+ */
+static hg_return_t
+hg_core_engine_context_start(struct hg_core_private_context *context);
+
+/**
+ * Stop engine progress thread of context and wait for pending entries.
+ */
+static void
+hg_core_engine_context_stop(struct hg_core_private_context *context);
+
+/**
+ * Wait for workers to trigger entries of a context progressed by the engine.
+ */
+static hg_return_t
+hg_core_engine_context_wait(struct hg_core_private_context *context,
+    unsigned int timeout_ms, unsigned int *count_p);
+
+/**
+ * Engine progress thread.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_core_engine_progress(void *arg);
+
+/**
+ * Dispatch completion entries to engine workers.
+ */
+static void
+hg_core_engine_dispatch(struct hg_core_engine *engine,
+    struct hg_core_private_context *context, void **entries,
+    unsigned int count);
+
+/**
+ * Engine trigger worker.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_core_engine_worker(void *arg);
+
+/**
+ * Steal entries from other workers.
+ */
+static unsigned int
+hg_core_engine_steal(struct hg_core_engine *engine,
+    struct hg_core_engine_worker *worker, void **entries,
+    unsigned int max_count);
+
+/**
+ * Determine whether all worker queues are empty.
+ */
+static hg_bool_t
+hg_core_engine_is_empty(struct hg_core_engine *engine);
+
+/**
+ * Trigger entries and release them from their context.
+ */
+static void
+hg_core_engine_trigger(void **entries, unsigned int count);
+
 /**
  * Trigger callback from HG lookup op ID.
  */
@@ -1120,20 +1455,9 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     hg_atomic_init32(&hg_core_class->n_addrs, 0);
     hg_atomic_init32(&hg_core_class->n_bulks, 0);
 
-    /* Initialize mutex */
-    rc = hg_thread_rwlock_init(&hg_core_class->rpc_map.lock);
-    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error_free, ret, HG_NOMEM,
-        "hg_thread_rwlock_init() failed");
-
     /* Create new function map */
-    hg_core_class->rpc_map.map =
-        hg_hash_table_new(hg_core_map_hash, hg_core_map_equal);
-    HG_CHECK_SUBSYS_ERROR(cls, hg_core_class->rpc_map.map == NULL, error, ret,
-        HG_NOMEM, "Could not create RPC map");
-
-    /* Automatically free all the values with the hash map */
-    hg_hash_table_register_free_functions(
-        hg_core_class->rpc_map.map, NULL, hg_core_map_value_free);
+    ret = hg_core_map_init(&hg_core_class->rpc_map);
+    HG_CHECK_SUBSYS_HG_ERROR(cls, error_free, ret, "Could not create RPC map");
 
     /* Get init info and overwrite defaults */
     if (hg_init_info_p)
@@ -1168,6 +1492,43 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     /* Loopback capability */
     hg_core_class->init_info.loopback = !hg_init_info.no_loopback;
 
+    /* Default completion queue size of contexts */
+    hg_core_class->init_info.completion_queue_size =
+        (hg_init_info.completion_queue_size == 0)
+            ? HG_CORE_ATOMIC_QUEUE_SIZE
+            : hg_init_info.completion_queue_size;
+
+    /* NUMA-local context allocations */
+    hg_core_class->init_info.numa_local = hg_init_info.numa_local;
+
+    /* Progress engine */
+    hg_core_class->init_info.trigger_workers = hg_init_info.trigger_workers;
+
+    /* Bulk pipelining */
+    hg_core_class->init_info.bulk_chunk_size = hg_init_info.bulk_chunk_size;
+
+    /* Bulk copy helper threads */
+    hg_core_class->init_info.bulk_copy_threads = hg_init_info.bulk_copy_threads;
+
+    /* Eager bulk data */
+    hg_core_class->init_info.bulk_eager_size_max =
+        hg_init_info.bulk_eager_size_max;
+
+    /* Bulk data checksums */
+    hg_core_class->init_info.bulk_checksum = hg_init_info.bulk_checksum;
+
+    /* Busy-polling is only relevant when progress can block */
+    if (!(hg_init_info.na_init_info.progress_mode & NA_NO_BLOCK)) {
+        hg_core_class->init_info.progress_spin_adaptive =
+            hg_init_info.progress_spin_adaptive;
+        hg_core_class->init_info.progress_spin_time =
+            (hg_init_info.progress_spin_adaptive &&
+                hg_init_info.progress_spin_time == 0)
+                ? HG_CORE_PROGRESS_SPIN_TIME_DEFAULT
+                : MIN(hg_init_info.progress_spin_time,
+                      HG_CORE_PROGRESS_SPIN_TIME_MAX);
+    }
+
     /* Listening */
     hg_core_class->init_info.listen = na_listen;
 
@@ -1265,11 +1626,40 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
         "please turn ON NA_USE_SM in CMake options");
 #endif
 
+    /* Start trigger workers */
+    if (hg_core_class->init_info.trigger_workers > 0) {
+        ret = hg_core_engine_create(
+            hg_core_class->init_info.trigger_workers, &hg_core_class->engine);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            cls, error, ret, "Could not create progress engine");
+    }
+
+    /* Bulk registration cache */
+    if (hg_init_info.bulk_reg_cache_size > 0) {
+        ret = hg_bulk_reg_cache_create(
+            hg_init_info.bulk_reg_cache_size, &hg_core_class->bulk_reg_cache);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            cls, error, ret, "Could not create bulk registration cache");
+    }
+
+    /* Start bulk copy helper threads */
+    if (hg_core_class->init_info.bulk_copy_threads > 0) {
+        rc = hg_thread_pool_init(hg_core_class->init_info.bulk_copy_threads,
+            &hg_core_class->bulk_copy_pool);
+        HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+            "Could not create thread pool of %u bulk copy threads",
+            hg_core_class->init_info.bulk_copy_threads);
+    }
+
     *class_p = hg_core_class;
 
     return HG_SUCCESS;
 
 error:
+    if (hg_core_class->bulk_reg_cache != NULL)
+        hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_cache);
+    if (hg_core_class->engine != NULL)
+        hg_core_engine_destroy(hg_core_class->engine);
     if (hg_core_class->core_class.na_class != NULL &&
         !hg_core_class->init_info.na_ext_init) {
         na_return_t na_ret = NA_Finalize(hg_core_class->core_class.na_class);
@@ -1283,9 +1673,7 @@ error:
             "Could not finalize NA SM class (%s)", NA_Error_to_string(na_ret));
     }
 #endif
-    if (hg_core_class->rpc_map.map)
-        hg_hash_table_free(hg_core_class->rpc_map.map);
-    (void) hg_thread_rwlock_destroy(&hg_core_class->rpc_map.lock);
+    hg_core_map_free(&hg_core_class->rpc_map);
 
 error_free:
     free(hg_core_class);
@@ -1318,6 +1706,24 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
     HG_CHECK_SUBSYS_ERROR(cls, n_addrs != 0, error, ret, HG_BUSY,
         "HG addrs must be freed before finalizing HG (%d remaining)", n_addrs);
 
+    /* Stop trigger workers */
+    if (hg_core_class->engine != NULL) {
+        hg_core_engine_destroy(hg_core_class->engine);
+        hg_core_class->engine = NULL;
+    }
+
+    /* Stop bulk copy helper threads */
+    if (hg_core_class->bulk_copy_pool != NULL) {
+        (void) hg_thread_pool_destroy(hg_core_class->bulk_copy_pool);
+        hg_core_class->bulk_copy_pool = NULL;
+    }
+
+    /* Release cached registrations while NA classes are still valid */
+    if (hg_core_class->bulk_reg_cache != NULL) {
+        hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_cache);
+        hg_core_class->bulk_reg_cache = NULL;
+    }
+
     /* Finalize NA class */
     if (hg_core_class->core_class.na_class != NULL &&
         !hg_core_class->init_info.na_ext_init) {
@@ -1345,11 +1751,7 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
             hg_core_class->core_class.data);
 
     /* Delete RPC map */
-    if (hg_core_class->rpc_map.map != NULL) {
-        hg_hash_table_free(hg_core_class->rpc_map.map);
-        hg_core_class->rpc_map.map = NULL;
-    }
-    (void) hg_thread_rwlock_destroy(&hg_core_class->rpc_map.lock);
+    hg_core_map_free(&hg_core_class->rpc_map);
     free(hg_core_class);
 
     return HG_SUCCESS;
@@ -1374,43 +1776,139 @@ hg_core_bulk_decr(hg_core_class_t *hg_core_class)
         &((struct hg_core_private_class *) hg_core_class)->n_bulks);
 }
 
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_core_bulk_chunk_size(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)
+        ->init_info.bulk_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_core_bulk_eager_size_max(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)
+        ->init_info.bulk_eager_size_max;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_core_bulk_checksum(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)
+        ->init_info.bulk_checksum;
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_bulk_reg_cache *
+hg_core_bulk_reg_cache(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)->bulk_reg_cache;
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_thread_pool *
+hg_core_bulk_copy_pool(
+    hg_core_class_t *hg_core_class, hg_uint32_t *thread_count_p)
+{
+    struct hg_core_private_class *private_class =
+        (struct hg_core_private_class *) hg_core_class;
+
+    *thread_count_p = private_class->init_info.bulk_copy_threads;
+
+    return private_class->bulk_copy_pool;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_context_create(struct hg_core_private_class *hg_core_class,
-    hg_uint8_t id, struct hg_core_private_context **context_p)
+    hg_uint8_t id, const struct hg_context_init_info *hg_context_init_info,
+    struct hg_core_private_context **context_p)
 {
+    struct hg_context_init_info context_init_info =
+        HG_CONTEXT_INIT_INFO_INITIALIZER;
     struct hg_core_private_context *context = NULL;
-    struct hg_core_completion_queue *backfill_queue = NULL;
+    struct hg_mem_numa_policy numa_policy;
+    hg_uint32_t completion_queue_size, requested_size;
     hg_return_t ret;
-    int na_poll_fd, loopback_event = 0, rc;
-    hg_bool_t backfill_queue_mutex_init = HG_FALSE,
-              backfill_queue_cond_init = HG_FALSE,
+    unsigned int i;
+    int na_poll_fd, loopback_event = 0, numa_node, rc;
+    hg_bool_t completion_notify_mutex_init = HG_FALSE,
+              completion_notify_cond_init = HG_FALSE,
               loopback_notify_mutex_init = HG_FALSE,
               created_list_lock_init = HG_FALSE;
 
-    context = (struct hg_core_private_context *) calloc(1, sizeof(*context));
+    /* Get init info and overwrite defaults */
+    if (hg_context_init_info)
+        context_init_info = *hg_context_init_info;
+
+    /* Completion queue size must be a power of 2 */
+    requested_size = (context_init_info.completion_queue_size == 0)
+                         ? hg_core_class->init_info.completion_queue_size
+                         : context_init_info.completion_queue_size;
+    completion_queue_size = 2;
+    while (completion_queue_size < requested_size &&
+           completion_queue_size < HG_CORE_COMPLETION_QUEUE_SIZE_MAX)
+        completion_queue_size <<= 1;
+
+    /* Select NUMA node, all context resources are allocated from that node
+     * when one is set */
+    if (context_init_info.numa_node >= 0)
+        numa_node = context_init_info.numa_node;
+    else if (hg_core_class->init_info.numa_local)
+        numa_node = hg_mem_numa_node_get();
+    else
+        numa_node = -1;
+    hg_core_context_numa_enter(&numa_node, &numa_policy);
+
+    /* Heap memory may come from pages that were already touched on another
+     * node, structures accessed on every progress call are therefore
+     * allocated from pages bound to the context node */
+    context = (struct hg_core_private_context *) hg_mem_numa_alloc(
+        sizeof(*context), numa_node);
     HG_CHECK_SUBSYS_ERROR(ctx, context == NULL, error, ret, HG_NOMEM,
         "Could not allocate HG context");
     hg_atomic_init32(&context->n_handles, 0);
+    context->numa_node = numa_node;
 
     context->core_context.core_class = (struct hg_core_class *) hg_core_class;
-    backfill_queue = &context->backfill_queue;
 
-    HG_QUEUE_INIT(&backfill_queue->queue);
-    hg_atomic_init32(&backfill_queue->count, 0);
-    rc = hg_thread_mutex_init(&backfill_queue->mutex);
+    /* Backfill segments are only allocated when needed */
+    for (i = 0; i < HG_CORE_BACKFILL_SEGMENT_MAX; i++)
+        hg_atomic_init64(&context->backfill_queue.segments[i], 0);
+    context->backfill_queue.numa_node = numa_node;
+    hg_atomic_init32(&context->backfill_queue.count, 0);
+    hg_atomic_init32(&context->backfill_queue.tail, 0);
+
+    hg_atomic_init32(&context->completion_notify.waiters, 0);
+    rc = hg_thread_mutex_init(&context->completion_notify.mutex);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
         "hg_thread_mutex_init() failed");
-    backfill_queue_mutex_init = HG_TRUE;
-    rc = hg_thread_cond_init(&backfill_queue->cond);
+    completion_notify_mutex_init = HG_TRUE;
+    rc = hg_thread_cond_init(&context->completion_notify.cond);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
         "hg_thread_cond_init() failed");
-    backfill_queue_cond_init = HG_TRUE;
+    completion_notify_cond_init = HG_TRUE;
 
     context->completion_queue =
-        hg_atomic_queue_alloc(HG_CORE_ATOMIC_QUEUE_SIZE);
+        hg_atomic_queue_alloc_numa(completion_queue_size, numa_node);
     HG_CHECK_SUBSYS_ERROR(ctx, context->completion_queue == NULL, error, ret,
-        HG_NOMEM, "Could not allocate queue");
+        HG_NOMEM, "Could not allocate queue of size %u", completion_queue_size);
+
+    /* Handles released by clients are kept for re-use */
+    context->handle_cache =
+        hg_atomic_queue_alloc_numa(HG_CORE_HANDLE_CACHE_SIZE, numa_node);
+    HG_CHECK_SUBSYS_ERROR(ctx, context->handle_cache == NULL, error, ret,
+        HG_NOMEM, "Could not allocate cache of handles");
+
+    /* Busy-polling starts with the full window */
+    hg_atomic_init64(&context->progress_spin.spin_count, 0);
+    hg_atomic_init64(&context->progress_spin.spin_hits, 0);
+    hg_atomic_init64(&context->progress_spin.sleep_count, 0);
+    hg_atomic_init32(&context->progress_spin.time,
+        (int32_t) hg_core_class->init_info.progress_spin_time);
+    hg_atomic_init32(&context->progress_spin.probe_count, 0);
 
     /* Notifications of completion queue events */
     hg_atomic_init32(&context->loopback_notify.must_notify, 0);
@@ -1437,6 +1935,11 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class,
             NA_Context_create(hg_core_class->core_class.na_sm_class);
         HG_CHECK_SUBSYS_ERROR(ctx, context->core_context.na_sm_context == NULL,
             error, ret, HG_NOMEM, "Could not create NA SM context");
+
+        context->sm_handle_cache =
+            hg_atomic_queue_alloc_numa(HG_CORE_HANDLE_CACHE_SIZE, numa_node);
+        HG_CHECK_SUBSYS_ERROR(ctx, context->sm_handle_cache == NULL, error,
+            ret, HG_NOMEM, "Could not allocate cache of SM handles");
     }
 #endif
 
@@ -1500,15 +2003,29 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class,
         HG_CORE_BULK_OP_INIT_COUNT, &context->hg_bulk_op_pool);
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not create bulk op pool");
 
+    /* Contexts that do not post requests can be progressed right away */
+    hg_atomic_init32(&context->engine_pending, 0);
+    hg_atomic_init32(&context->engine_triggered, 0);
+    hg_atomic_init32(&context->engine_stop, 0);
+    if (hg_core_class->engine != NULL && !hg_core_class->init_info.listen) {
+        ret = hg_core_engine_context_start(context);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not start engine progress");
+    }
+
     /* Increment context count of parent class */
     hg_atomic_incr32(&HG_CORE_CONTEXT_CLASS(context)->n_contexts);
 
+    hg_core_context_numa_leave(numa_node, &numa_policy);
+
     *context_p = context;
 
     return HG_SUCCESS;
 
 error:
+    hg_core_context_numa_leave(numa_node, &numa_policy);
     if (context != NULL) {
+
         if (context->poll_set != NULL) {
             if (context->na_event > 0) {
                 rc = hg_poll_remove(context->poll_set, context->na_event);
@@ -1558,28 +2075,63 @@ error:
         }
 #endif
 
-        if (backfill_queue_mutex_init)
-            (void) hg_thread_mutex_destroy(&backfill_queue->mutex);
-        if (backfill_queue_cond_init)
-            (void) hg_thread_cond_destroy(&backfill_queue->cond);
+        if (completion_notify_mutex_init)
+            (void) hg_thread_mutex_destroy(&context->completion_notify.mutex);
+        if (completion_notify_cond_init)
+            (void) hg_thread_cond_destroy(&context->completion_notify.cond);
         if (loopback_notify_mutex_init)
             (void) hg_thread_mutex_destroy(&context->loopback_notify.mutex);
         if (created_list_lock_init)
             (void) hg_thread_spin_destroy(&context->created_list.lock);
-        hg_atomic_queue_free(context->completion_queue);
-        free(context);
+        hg_atomic_queue_free_numa(context->completion_queue);
+        hg_atomic_queue_free_numa(context->handle_cache);
+#ifdef NA_HAS_SM
+        hg_atomic_queue_free_numa(context->sm_handle_cache);
+#endif
+        hg_mem_numa_free(context, sizeof(*context));
     }
 
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_context_numa_enter(int *numa_node_p, struct hg_mem_numa_policy *policy)
+{
+    int rc;
+
+    if (*numa_node_p < 0)
+        return;
+
+    rc = hg_mem_numa_node_prefer(*numa_node_p, policy);
+    if (rc != HG_UTIL_SUCCESS) {
+        HG_LOG_SUBSYS_WARNING(ctx,
+            "Could not set preferred NUMA node %d, context will use default "
+            "memory policy",
+            *numa_node_p);
+        *numa_node_p = -1;
+    } else
+        HG_LOG_SUBSYS_DEBUG(ctx, "Allocating context resources on NUMA node %d",
+            *numa_node_p);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_context_numa_leave(
+    int numa_node, const struct hg_mem_numa_policy *policy)
+{
+    if (numa_node < 0)
+        return;
+
+    (void) hg_mem_numa_policy_restore(policy);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_context_destroy(struct hg_core_private_context *context)
 {
     struct hg_core_private_class *hg_core_class = NULL;
-    struct hg_core_completion_queue *backfill_queue = NULL;
-    hg_bool_t empty;
+    hg_bool_t engine_running;
     hg_return_t ret;
     int rc;
 
@@ -1589,9 +2141,17 @@ hg_core_context_destroy(struct hg_core_private_context *context)
     /* Keep reference to class */
     hg_core_class = HG_CORE_CONTEXT_CLASS(context);
 
+    /* Remaining progress is made from this thread */
+    engine_running = context->engine_running;
+    if (engine_running)
+        hg_core_engine_context_stop(context);
+
     /* Context is now finalizing */
     context->finalizing = HG_TRUE;
 
+    /* Free cached handles */
+    hg_core_context_cache_drain(context);
+
     /* Unpost requests */
     ret = hg_core_context_unpost(context);
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not unpost requests");
@@ -1601,18 +2161,9 @@ hg_core_context_destroy(struct hg_core_private_context *context)
     HG_CHECK_SUBSYS_HG_ERROR(
         ctx, error, ret, "Handles for that context are still in use");
 
-    /* Check that backfill completion queue is empty now */
-    backfill_queue = &context->backfill_queue;
-    hg_thread_mutex_lock(&backfill_queue->mutex);
-    empty = HG_QUEUE_IS_EMPTY(&backfill_queue->queue);
-    hg_thread_mutex_unlock(&backfill_queue->mutex);
-    HG_CHECK_SUBSYS_ERROR(ctx, empty == HG_FALSE, error, ret, HG_BUSY,
-        "Completion queue should be empty");
-
-    /* Check that atomic completion queue is empty now */
-    empty = hg_atomic_queue_is_empty(context->completion_queue);
-    HG_CHECK_SUBSYS_ERROR(ctx, empty == HG_FALSE, error, ret, HG_BUSY,
-        "Completion queue should be empty");
+    /* Check that completion queues are empty now */
+    HG_CHECK_SUBSYS_ERROR(ctx, !hg_core_completion_queue_empty(context), error,
+        ret, HG_BUSY, "Completion queue should be empty");
 
     /* Destroy pool of bulk op IDs */
     if (context->hg_bulk_op_pool != NULL) {
@@ -1685,13 +2236,18 @@ hg_core_context_destroy(struct hg_core_private_context *context)
         context->core_context.data_free_callback(context->core_context.data);
 
     /* Destroy completion queue mutex/cond */
-    (void) hg_thread_mutex_destroy(&backfill_queue->mutex);
-    (void) hg_thread_cond_destroy(&backfill_queue->cond);
+    (void) hg_thread_mutex_destroy(&context->completion_notify.mutex);
+    (void) hg_thread_cond_destroy(&context->completion_notify.cond);
     (void) hg_thread_mutex_destroy(&context->loopback_notify.mutex);
     (void) hg_thread_spin_destroy(&context->created_list.lock);
 
-    hg_atomic_queue_free(context->completion_queue);
-    free(context);
+    hg_core_backfill_free(&context->backfill_queue);
+    hg_atomic_queue_free_numa(context->completion_queue);
+    hg_atomic_queue_free_numa(context->handle_cache);
+#ifdef NA_HAS_SM
+    hg_atomic_queue_free_numa(context->sm_handle_cache);
+#endif
+    hg_mem_numa_free(context, sizeof(*context));
 
     /* Decrement context count of parent class */
     hg_atomic_decr32(&hg_core_class->n_contexts);
@@ -1700,6 +2256,8 @@ hg_core_context_destroy(struct hg_core_private_context *context)
 
 error:
     context->finalizing = HG_FALSE;
+    if (engine_running)
+        (void) hg_core_engine_context_start(context);
 
     return ret;
 }
@@ -1817,8 +2375,8 @@ hg_core_context_unpost(struct hg_core_private_context *context)
     }
 #endif
 
-    /* Wait on created list */
-    ret = hg_core_context_list_wait(context, &context->created_list);
+    /* Wait on created handles */
+    ret = hg_core_context_wait(context, &context->n_handles);
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not wait on handle list");
 
     if (hg_core_class->init_info.multi_recv)
@@ -2016,10 +2574,10 @@ hg_core_context_check_handles(struct hg_core_private_context *context)
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_core_context_list_wait(struct hg_core_private_context *context,
-    struct hg_core_handle_list *handle_list)
+hg_core_context_wait(
+    struct hg_core_private_context *context, hg_atomic_int32_t *count)
 {
-    bool list_empty = false;
+    bool done = false;
     hg_time_t deadline, now;
     hg_return_t ret;
 
@@ -2041,11 +2599,9 @@ hg_core_context_list_wait(struct hg_core_private_context *context,
         HG_CHECK_SUBSYS_ERROR_NORET(ctx, ret != HG_SUCCESS && ret != HG_TIMEOUT,
             error, "Could not trigger entry");
 
-        /* Make progress until list is empty */
-        hg_thread_spin_lock(&handle_list->lock);
-        list_empty = HG_LIST_IS_EMPTY(&handle_list->list);
-        hg_thread_spin_unlock(&handle_list->lock);
-        if (list_empty)
+        /* Make progress until count drops to zero */
+        done = (hg_atomic_get32(count) == 0);
+        if (done)
             break;
 
         /* Gives a chance to always call trigger after progress */
@@ -2059,7 +2615,7 @@ hg_core_context_list_wait(struct hg_core_private_context *context,
             error, "Could not make progress");
     }
 
-    HG_LOG_SUBSYS_DEBUG(ctx, "List empty: %d (timeout=%u ms)", list_empty,
+    HG_LOG_SUBSYS_DEBUG(ctx, "Count reached zero: %d (timeout=%u ms)", done,
         hg_time_to_ms(hg_time_subtract(deadline, now)));
 
     return HG_SUCCESS;
@@ -2069,22 +2625,121 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-struct hg_bulk_op_pool *
-hg_core_context_get_bulk_op_pool(struct hg_core_context *core_context)
+static HG_INLINE struct hg_core_private_handle *
+hg_core_context_cache_get(
+    struct hg_core_private_context *context, na_class_t *na_class)
 {
-    return ((struct hg_core_private_context *) core_context)->hg_bulk_op_pool;
+    struct hg_atomic_queue *handle_cache = context->handle_cache;
+
+#ifdef NA_HAS_SM
+    if (na_class == context->core_context.core_class->na_sm_class)
+        handle_cache = context->sm_handle_cache;
+#else
+    (void) na_class;
+#endif
+
+    return (handle_cache != NULL) ? (struct hg_core_private_handle *)
+                                        hg_atomic_queue_pop_mc(handle_cache)
+                                  : NULL;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_core_handle_pool_create(struct hg_core_private_context *context,
-    na_class_t *na_class, na_context_t *na_context, unsigned long flags,
-    unsigned int init_count, unsigned int incr_count,
-    struct hg_core_handle_pool **hg_core_handle_pool_p)
+static hg_bool_t
+hg_core_context_cache_put(struct hg_core_private_handle *hg_core_handle)
 {
-    struct hg_core_handle_pool *hg_core_handle_pool = NULL;
-    hg_bool_t pending_list_lock_init = HG_FALSE, extend_mutex_init = HG_FALSE,
-              extend_cond_init = HG_FALSE;
+    struct hg_core_private_context *context =
+        HG_CORE_HANDLE_CONTEXT(hg_core_handle);
+    struct hg_atomic_queue *handle_cache = context->handle_cache;
+    int32_t status = hg_atomic_get32(&hg_core_handle->status);
+
+    /* Only keep client handles whose last operation completed normally */
+    if (hg_core_handle->reuse || context->finalizing ||
+        hg_core_handle->na_class == NULL ||
+        hg_core_handle->core_handle.in_buf == NULL ||
+        (status & (HG_CORE_OP_ERRORED | HG_CORE_OP_CANCELED |
+                      HG_CORE_OP_QUEUED)) ||
+        !(status & HG_CORE_OP_COMPLETED))
+        return HG_FALSE;
+
+#ifdef NA_HAS_SM
+    if (hg_core_handle->na_class ==
+        context->core_context.core_class->na_sm_class)
+        handle_cache = context->sm_handle_cache;
+#endif
+    if (handle_cache == NULL)
+        return HG_FALSE;
+
+    /* Reset the handle (releases extra data through upper layer) */
+    hg_core_reset(hg_core_handle);
+
+    /* Upper layer data is created again when the handle is re-used */
+    if (hg_core_handle->core_handle.data_free_callback)
+        hg_core_handle->core_handle.data_free_callback(
+            hg_core_handle->core_handle.data);
+    hg_core_handle->core_handle.data = NULL;
+    hg_core_handle->core_handle.data_free_callback = NULL;
+
+    /* Drop target addr and RPC info */
+    hg_core_addr_free(
+        (struct hg_core_private_addr *) hg_core_handle->core_handle.info.addr);
+    hg_core_handle->core_handle.info.addr = HG_CORE_ADDR_NULL;
+    hg_core_handle->core_handle.info.id = 0;
+    hg_core_handle->core_handle.rpc_info = NULL;
+    hg_core_handle->na_addr = NULL;
+    hg_core_handle->is_self = HG_FALSE;
+    hg_core_handle->ops = hg_core_ops_na_g;
+
+    hg_atomic_set32(&hg_core_handle->status, HG_CORE_OP_COMPLETED);
+    hg_atomic_set32(&hg_core_handle->ret_status, (int32_t) HG_SUCCESS);
+    hg_atomic_set32(&hg_core_handle->no_response_done, 0);
+    hg_atomic_set32(&hg_core_handle->ref_count, 1);
+
+    /* Handle is freed by caller if cache is full */
+    return hg_atomic_queue_push(handle_cache, hg_core_handle) ==
+           HG_UTIL_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_context_cache_drain(struct hg_core_private_context *context)
+{
+    struct hg_atomic_queue *handle_caches[] = {context->handle_cache,
+#ifdef NA_HAS_SM
+        context->sm_handle_cache
+#endif
+    };
+    size_t i;
+
+    /* Context must be finalizing so that handles are not cached again */
+    for (i = 0; i < sizeof(handle_caches) / sizeof(handle_caches[0]); i++) {
+        struct hg_core_private_handle *hg_core_handle;
+
+        if (handle_caches[i] == NULL)
+            continue;
+
+        while ((hg_core_handle = (struct hg_core_private_handle *)
+                    hg_atomic_queue_pop_mc(handle_caches[i])) != NULL)
+            (void) hg_core_destroy(hg_core_handle);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_bulk_op_pool *
+hg_core_context_get_bulk_op_pool(struct hg_core_context *core_context)
+{
+    return ((struct hg_core_private_context *) core_context)->hg_bulk_op_pool;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_handle_pool_create(struct hg_core_private_context *context,
+    na_class_t *na_class, na_context_t *na_context, unsigned long flags,
+    unsigned int init_count, unsigned int incr_count,
+    struct hg_core_handle_pool **hg_core_handle_pool_p)
+{
+    struct hg_core_handle_pool *hg_core_handle_pool = NULL;
+    hg_bool_t pending_list_lock_init = HG_FALSE, extend_mutex_init = HG_FALSE,
+              extend_cond_init = HG_FALSE;
     hg_return_t ret;
     unsigned int i;
     int rc;
@@ -2093,11 +2748,22 @@ hg_core_handle_pool_create(struct hg_core_private_context *context,
         "Creating pool of handles (init_count=%u, incr_count=%u)", init_count,
         init_count);
 
-    hg_core_handle_pool =
-        (struct hg_core_handle_pool *) calloc(1, sizeof(*hg_core_handle_pool));
+    hg_core_handle_pool = (struct hg_core_handle_pool *) hg_mem_numa_alloc(
+        sizeof(*hg_core_handle_pool), context->numa_node);
     HG_CHECK_SUBSYS_ERROR(ctx, hg_core_handle_pool == NULL, error, ret,
         HG_NOMEM, "Could not allocate handle pool");
 
+    /* Free handles are only kept in the pool when using multi-recv, single
+     * recv handles otherwise remain posted */
+    if (flags & HG_CORE_HANDLE_MULTI_RECV) {
+        hg_core_handle_pool->cache = hg_atomic_queue_alloc_numa(
+            HG_CORE_HANDLE_CACHE_SIZE, context->numa_node);
+        HG_CHECK_SUBSYS_ERROR(ctx, hg_core_handle_pool->cache == NULL, error,
+            ret, HG_NOMEM, "Could not allocate cache of handles");
+    }
+    HG_LIST_INIT(&hg_core_handle_pool->spill_list);
+    hg_atomic_init32(&hg_core_handle_pool->posted_count, 0);
+
     HG_LIST_INIT(&hg_core_handle_pool->pending_list.list);
     rc = hg_thread_spin_init(&hg_core_handle_pool->pending_list.lock);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
@@ -2108,7 +2774,7 @@ hg_core_handle_pool_create(struct hg_core_private_context *context,
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
         "hg_thread_mutex_init() failed");
     extend_mutex_init = HG_TRUE;
-    hg_thread_cond_init(&hg_core_handle_pool->extend_cond);
+    rc = hg_thread_cond_init(&hg_core_handle_pool->extend_cond);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
         "hg_thread_cond_init() failed");
     extend_cond_init = HG_TRUE;
@@ -2137,31 +2803,19 @@ hg_core_handle_pool_create(struct hg_core_private_context *context,
 
 error:
     if (hg_core_handle_pool != NULL) {
-        struct hg_core_private_handle *hg_core_handle;
-
-        hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->pending_list.list);
-        while (hg_core_handle) {
-            struct hg_core_private_handle *hg_core_handle_next =
-                HG_LIST_NEXT(hg_core_handle, pending);
-            HG_LIST_REMOVE(hg_core_handle, pending);
-
-            /* Prevent re-initialization */
-            hg_core_handle->reuse = HG_FALSE;
-
-            /* Destroy handle */
-            (void) hg_core_destroy(hg_core_handle);
-            hg_core_handle = hg_core_handle_next;
+        /* Handles may only have been inserted once fully initialized */
+        if (extend_cond_init) {
+            hg_core_handle_pool_destroy(hg_core_handle_pool);
+            return ret;
         }
-
         if (pending_list_lock_init)
             (void) hg_thread_spin_destroy(
                 &hg_core_handle_pool->pending_list.lock);
         if (extend_mutex_init)
             (void) hg_thread_mutex_destroy(&hg_core_handle_pool->extend_mutex);
-        if (extend_cond_init)
-            (void) hg_thread_cond_destroy(&hg_core_handle_pool->extend_cond);
+        hg_atomic_queue_free_numa(hg_core_handle_pool->cache);
 
-        free(hg_core_handle_pool);
+        hg_mem_numa_free(hg_core_handle_pool, sizeof(*hg_core_handle_pool));
     }
     return ret;
 }
@@ -2174,40 +2828,51 @@ hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool)
 
     HG_LOG_DEBUG("Free handle pool (%p)", (void *) hg_core_handle_pool);
 
+    /* Collect free handles on spill list */
+    if (hg_core_handle_pool->cache != NULL) {
+        while ((hg_core_handle = (struct hg_core_private_handle *)
+                    hg_atomic_queue_pop_mc(hg_core_handle_pool->cache)) !=
+               NULL)
+            HG_LIST_INSERT_HEAD(
+                &hg_core_handle_pool->spill_list, hg_core_handle, spill);
+    }
+
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-    hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->pending_list.list);
-    while (hg_core_handle) {
-        struct hg_core_private_handle *hg_core_handle_next =
-            HG_LIST_NEXT(hg_core_handle, pending);
+
+    /* Handles that are still posted are not in use either */
+    HG_LIST_FOREACH (
+        hg_core_handle, &hg_core_handle_pool->pending_list.list, pending) {
+        if (hg_atomic_get32(&hg_core_handle->recv_posted))
+            HG_LIST_INSERT_HEAD(
+                &hg_core_handle_pool->spill_list, hg_core_handle, spill);
+    }
+
+    /* Detach all handles, handles in use are freed on their last release */
+    while (!HG_LIST_IS_EMPTY(&hg_core_handle_pool->pending_list.list)) {
+        hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->pending_list.list);
         HG_LIST_REMOVE(hg_core_handle, pending);
+        hg_core_handle->handle_pool = NULL;
 
         /* Prevent re-initialization */
         hg_core_handle->reuse = HG_FALSE;
+    }
+
+    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+
+    while (!HG_LIST_IS_EMPTY(&hg_core_handle_pool->spill_list)) {
+        hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->spill_list);
+        HG_LIST_REMOVE(hg_core_handle, spill);
 
         /* Destroy handle */
         (void) hg_core_destroy(hg_core_handle);
-        hg_core_handle = hg_core_handle_next;
     }
-    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
     (void) hg_thread_mutex_destroy(&hg_core_handle_pool->extend_mutex);
     (void) hg_thread_cond_destroy(&hg_core_handle_pool->extend_cond);
     (void) hg_thread_spin_destroy(&hg_core_handle_pool->pending_list.lock);
+    hg_atomic_queue_free_numa(hg_core_handle_pool->cache);
 
-    free(hg_core_handle_pool);
-}
-
-/*---------------------------------------------------------------------------*/
-static HG_INLINE hg_bool_t
-hg_core_handle_pool_empty(struct hg_core_handle_pool *hg_core_handle_pool)
-{
-    hg_bool_t ret;
-
-    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-    ret = HG_LIST_IS_EMPTY(&hg_core_handle_pool->pending_list.list);
-    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
-
-    return ret;
+    hg_mem_numa_free(hg_core_handle_pool, sizeof(*hg_core_handle_pool));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2219,14 +2884,15 @@ hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
     hg_return_t ret;
 
     do {
-        hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-        hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->pending_list.list);
-        if (hg_core_handle != NULL) {
-            HG_LIST_REMOVE(hg_core_handle, pending);
-            hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+        /* Fast path does not take any lock */
+        hg_core_handle = (struct hg_core_private_handle *)
+            hg_atomic_queue_pop_mc(hg_core_handle_pool->cache);
+        if (hg_core_handle != NULL)
+            break;
+
+        hg_core_handle = hg_core_handle_pool_refill(hg_core_handle_pool);
+        if (hg_core_handle != NULL)
             break;
-        }
-        hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
         /* Grow pool when needed */
         ret = hg_core_handle_pool_extend(hg_core_handle_pool);
@@ -2243,6 +2909,81 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static struct hg_core_private_handle *
+hg_core_handle_pool_refill(struct hg_core_handle_pool *hg_core_handle_pool)
+{
+    struct hg_core_private_handle *hg_core_handle;
+    unsigned int i;
+
+    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
+
+    hg_core_handle = HG_LIST_FIRST(&hg_core_handle_pool->spill_list);
+    if (hg_core_handle != NULL) {
+        HG_LIST_REMOVE(hg_core_handle, spill);
+
+        /* Move a batch of spilled handles back into the cache */
+        for (i = 1; i < HG_CORE_HANDLE_CACHE_BATCH; i++) {
+            struct hg_core_private_handle *hg_core_handle_next =
+                HG_LIST_FIRST(&hg_core_handle_pool->spill_list);
+
+            if (hg_core_handle_next == NULL)
+                break;
+            HG_LIST_REMOVE(hg_core_handle_next, spill);
+            if (hg_atomic_queue_push(hg_core_handle_pool->cache,
+                    hg_core_handle_next) != HG_UTIL_SUCCESS) {
+                HG_LIST_INSERT_HEAD(&hg_core_handle_pool->spill_list,
+                    hg_core_handle_next, spill);
+                break;
+            }
+        }
+    }
+
+    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+
+    return hg_core_handle;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_handle_pool_release(struct hg_core_handle_pool *hg_core_handle_pool,
+    struct hg_core_private_handle *hg_core_handle)
+{
+    void *entries[HG_CORE_HANDLE_CACHE_BATCH];
+    unsigned int count, i;
+
+    /* Fast path does not take any lock */
+    if (hg_atomic_queue_push(hg_core_handle_pool->cache, hg_core_handle) ==
+        HG_UTIL_SUCCESS)
+        return;
+
+    /* Cache is full, spill a batch of handles along with this one so that
+     * subsequent releases can go through the cache again */
+    count = hg_atomic_queue_pop_mc_batch(
+        hg_core_handle_pool->cache, entries, HG_CORE_HANDLE_CACHE_BATCH);
+
+    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
+    HG_LIST_INSERT_HEAD(
+        &hg_core_handle_pool->spill_list, hg_core_handle, spill);
+    for (i = 0; i < count; i++)
+        HG_LIST_INSERT_HEAD(&hg_core_handle_pool->spill_list,
+            (struct hg_core_private_handle *) entries[i], spill);
+    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_handle_pool_remove(struct hg_core_private_handle *hg_core_handle)
+{
+    struct hg_core_handle_pool *hg_core_handle_pool =
+        hg_core_handle->handle_pool;
+
+    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
+    HG_LIST_REMOVE(hg_core_handle, pending);
+    hg_core_handle->handle_pool = NULL;
+    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_handle_pool_extend(struct hg_core_handle_pool *hg_core_handle_pool)
@@ -2289,7 +3030,6 @@ hg_core_handle_pool_insert(struct hg_core_private_context *context,
     struct hg_core_private_handle *hg_core_handle = NULL;
     struct hg_core_private_addr *hg_core_addr = NULL;
     hg_return_t ret;
-    hg_bool_t post = HG_FALSE;
 
     /* Create new handle */
     ret = hg_core_create(context, na_class, na_context, flags, &hg_core_handle);
@@ -2308,18 +3048,18 @@ hg_core_handle_pool_insert(struct hg_core_private_context *context,
     /* Re-use handle on completion */
     hg_core_handle->reuse = HG_TRUE;
 
-    /* Add handle to pending list */
+    /* Pool keeps track of all the handles it owns */
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
     HG_LIST_INSERT_HEAD(
         &hg_core_handle_pool->pending_list.list, hg_core_handle, pending);
+    hg_core_handle->handle_pool = hg_core_handle_pool;
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
     /* Handle is pre-posted only when muti-recv is off */
-    if (!(flags & HG_CORE_HANDLE_MULTI_RECV)) {
-        /* Handle will need to be posted */
-        post = HG_TRUE;
-
-        ret = hg_core_post(hg_core_handle);
+    if (flags & HG_CORE_HANDLE_MULTI_RECV)
+        hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
+    else {
+        ret = hg_core_handle_pool_post(hg_core_handle);
         HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not post handle (%p)",
             (void *) hg_core_handle);
     }
@@ -2328,11 +3068,6 @@ hg_core_handle_pool_insert(struct hg_core_private_context *context,
 
 error:
     if (hg_core_handle != NULL) {
-        if (post) {
-            hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-            HG_LIST_REMOVE(hg_core_handle, pending);
-            hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
-        }
         hg_core_handle->reuse = HG_FALSE;
         (void) hg_core_destroy(hg_core_handle);
     }
@@ -2340,6 +3075,30 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_handle_pool_post(struct hg_core_private_handle *hg_core_handle)
+{
+    struct hg_core_handle_pool *hg_core_handle_pool =
+        hg_core_handle->handle_pool;
+    hg_return_t ret;
+
+    /* Mark handle as posted before it can complete */
+    hg_atomic_set32(&hg_core_handle->recv_posted, 1);
+    hg_atomic_incr32(&hg_core_handle_pool->posted_count);
+
+    ret = hg_core_post(hg_core_handle);
+    HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not post handle");
+
+    return HG_SUCCESS;
+
+error:
+    hg_atomic_set32(&hg_core_handle->recv_posted, 0);
+    hg_atomic_decr32(&hg_core_handle_pool->posted_count);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_handle_pool_unpost(struct hg_core_handle_pool *hg_core_handle_pool)
@@ -2350,11 +3109,15 @@ hg_core_handle_pool_unpost(struct hg_core_handle_pool *hg_core_handle_pool)
     if (hg_core_handle_pool->flags & HG_CORE_HANDLE_MULTI_RECV)
         return HG_SUCCESS; /* Nothing to do */
 
-    /* Check pending list and cancel posted handles */
+    /* Cancel posted handles, handles being processed are no longer re-posted
+     * once the context is finalizing */
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
 
     HG_LIST_FOREACH (
         hg_core_handle, &hg_core_handle_pool->pending_list.list, pending) {
+        if (!hg_atomic_get32(&hg_core_handle->recv_posted))
+            continue;
+
         /* Cancel handle */
         ret = hg_core_cancel(hg_core_handle);
         HG_CHECK_SUBSYS_HG_ERROR(ctx, unlock, ret,
@@ -2364,10 +3127,10 @@ hg_core_handle_pool_unpost(struct hg_core_handle_pool *hg_core_handle_pool)
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
     /* Check that operations have completed */
-    ret = hg_core_context_list_wait(
-        hg_core_handle_pool->context, &hg_core_handle_pool->pending_list);
+    ret = hg_core_context_wait(
+        hg_core_handle_pool->context, &hg_core_handle_pool->posted_count);
     HG_CHECK_SUBSYS_HG_ERROR(
-        ctx, error, ret, "Could not wait on pool handle list");
+        ctx, error, ret, "Could not wait on pool posted handles");
 
     return HG_SUCCESS;
 
@@ -2379,26 +3142,215 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE unsigned int
-hg_core_map_hash(hg_hash_table_key_t key)
+static hg_return_t
+hg_core_map_init(struct hg_core_map *hg_core_map)
+{
+    struct hg_core_map_table *table;
+    hg_return_t ret;
+    int rc;
+
+    table = hg_core_map_table_alloc(HG_CORE_MAP_BUCKETS_INIT);
+    HG_CHECK_SUBSYS_ERROR(cls, table == NULL, error, ret, HG_NOMEM,
+        "Could not allocate RPC map table");
+
+    rc = hg_thread_mutex_init(&hg_core_map->lock);
+    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "hg_thread_mutex_init() failed");
+
+    hg_atomic_init64(&hg_core_map->table, (int64_t) (intptr_t) table);
+    hg_core_map->retired_tables = NULL;
+    hg_core_map->retired_buckets = NULL;
+    hg_core_map->count = 0;
+
+    return HG_SUCCESS;
+
+error:
+    free(table);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_free(struct hg_core_map *hg_core_map)
+{
+    struct hg_core_map_table *table =
+        (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+            &hg_core_map->table);
+    unsigned int i;
+
+    if (table == NULL)
+        return;
+
+    /* Free all entries along with published buckets */
+    for (i = 0; i <= table->mask; i++) {
+        struct hg_core_map_bucket *bucket =
+            (struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+                &table->buckets[i]);
+        unsigned int j;
+
+        if (bucket == NULL)
+            continue;
+        for (j = 0; j < bucket->count; j++)
+            hg_core_map_value_free(bucket->entries[j].rpc_info);
+        free(bucket);
+    }
+    free(table);
+    hg_atomic_set64(&hg_core_map->table, 0);
+
+    /* No reader is left, retired buckets and tables can be released */
+    while (hg_core_map->retired_buckets) {
+        struct hg_core_map_bucket *bucket = hg_core_map->retired_buckets;
+        hg_core_map->retired_buckets = bucket->retired;
+        free(bucket);
+    }
+    while (hg_core_map->retired_tables) {
+        table = hg_core_map->retired_tables;
+        hg_core_map->retired_tables = table->retired;
+        free(table);
+    }
+
+    (void) hg_thread_mutex_destroy(&hg_core_map->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_core_map_table *
+hg_core_map_table_alloc(unsigned int bucket_count)
+{
+    struct hg_core_map_table *table;
+    unsigned int i;
+
+    table = (struct hg_core_map_table *) malloc(
+        sizeof(*table) + bucket_count * sizeof(hg_atomic_int64_t));
+    if (table == NULL)
+        return NULL;
+
+    table->retired = NULL;
+    table->mask = bucket_count - 1;
+    for (i = 0; i < bucket_count; i++)
+        hg_atomic_init64(&table->buckets[i], 0);
+
+    return table;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_map_table_grow(struct hg_core_map *hg_core_map)
 {
-    return *((hg_id_t *) key) & 0xffffffff;
+    struct hg_core_map_table *old_table, *new_table;
+    unsigned int bucket_count, i;
+    unsigned int *counts = NULL;
+    hg_return_t ret;
+
+    old_table = (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+        &hg_core_map->table);
+    bucket_count = 2 * (old_table->mask + 1);
+
+    new_table = hg_core_map_table_alloc(bucket_count);
+    HG_CHECK_SUBSYS_ERROR(cls, new_table == NULL, error, ret, HG_NOMEM,
+        "Could not allocate RPC map table of %u buckets", bucket_count);
+
+    counts = (unsigned int *) calloc(bucket_count, sizeof(*counts));
+    HG_CHECK_SUBSYS_ERROR(cls, counts == NULL, error, ret, HG_NOMEM,
+        "Could not allocate bucket counts");
+
+    /* Size new buckets */
+    for (i = 0; i <= old_table->mask; i++) {
+        const struct hg_core_map_bucket *bucket =
+            (const struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+                &old_table->buckets[i]);
+        unsigned int j;
+
+        if (bucket == NULL)
+            continue;
+        for (j = 0; j < bucket->count; j++)
+            counts[hg_core_map_hash(bucket->entries[j].id) & new_table->mask]++;
+    }
+
+    for (i = 0; i < bucket_count; i++) {
+        struct hg_core_map_bucket *bucket;
+
+        if (counts[i] == 0)
+            continue;
+
+        bucket = (struct hg_core_map_bucket *) malloc(
+            sizeof(*bucket) + counts[i] * sizeof(struct hg_core_map_entry));
+        HG_CHECK_SUBSYS_ERROR(cls, bucket == NULL, error, ret, HG_NOMEM,
+            "Could not allocate RPC map bucket");
+        bucket->retired = NULL;
+        bucket->count = 0;
+        hg_atomic_init64(&new_table->buckets[i], (int64_t) (intptr_t) bucket);
+    }
+
+    /* Fill new buckets, old buckets remain valid for current readers */
+    for (i = 0; i <= old_table->mask; i++) {
+        struct hg_core_map_bucket *bucket =
+            (struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+                &old_table->buckets[i]);
+        unsigned int j;
+
+        if (bucket == NULL)
+            continue;
+        for (j = 0; j < bucket->count; j++) {
+            unsigned int k =
+                hg_core_map_hash(bucket->entries[j].id) & new_table->mask;
+            struct hg_core_map_bucket *new_bucket =
+                (struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+                    &new_table->buckets[k]);
+
+            new_bucket->entries[new_bucket->count++] = bucket->entries[j];
+        }
+        bucket->retired = hg_core_map->retired_buckets;
+        hg_core_map->retired_buckets = bucket;
+    }
+    free(counts);
+
+    /* Publish */
+    hg_atomic_set64(&hg_core_map->table, (int64_t) (intptr_t) new_table);
+    old_table->retired = hg_core_map->retired_tables;
+    hg_core_map->retired_tables = old_table;
+
+    return HG_SUCCESS;
+
+error:
+    if (new_table) {
+        for (i = 0; i < bucket_count; i++)
+            free((void *) (intptr_t) hg_atomic_get64(&new_table->buckets[i]));
+        free(new_table);
+    }
+    free(counts);
+
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE int
-hg_core_map_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
+static HG_INLINE unsigned int
+hg_core_map_hash(hg_id_t id)
 {
-    return *((hg_id_t *) key1) == *((hg_id_t *) key2);
+    /* Fibonacci hashing, IDs may be sequential or already hashed */
+    return (unsigned int) ((id * UINT64_C(0x9e3779b97f4a7c15)) >> 32);
 }
 
 /*---------------------------------------------------------------------------*/
 static void
-hg_core_map_value_free(hg_hash_table_value_t value)
+hg_core_map_bucket_publish(struct hg_core_map *hg_core_map,
+    hg_atomic_int64_t *slot, struct hg_core_map_bucket *bucket)
 {
-    struct hg_core_rpc_info *hg_core_rpc_info =
-        (struct hg_core_rpc_info *) value;
+    struct hg_core_map_bucket *old_bucket =
+        (struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(slot);
+
+    hg_atomic_set64(slot, (int64_t) (intptr_t) bucket);
+
+    if (old_bucket != NULL) {
+        old_bucket->retired = hg_core_map->retired_buckets;
+        hg_core_map->retired_buckets = old_bucket;
+    }
+}
 
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_value_free(struct hg_core_rpc_info *hg_core_rpc_info)
+{
     if (hg_core_rpc_info->free_callback)
         hg_core_rpc_info->free_callback(hg_core_rpc_info->data);
     free(hg_core_rpc_info);
@@ -2408,15 +3360,22 @@ hg_core_map_value_free(hg_hash_table_value_t value)
 static HG_INLINE struct hg_core_rpc_info *
 hg_core_map_lookup(struct hg_core_map *hg_core_map, hg_id_t *id)
 {
-    hg_hash_table_value_t value = NULL;
+    struct hg_core_map_table *table =
+        (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+            &hg_core_map->table);
+    const struct hg_core_map_bucket *bucket =
+        (const struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+            &table->buckets[hg_core_map_hash(*id) & table->mask]);
+    unsigned int i;
 
-    /* Lookup key */
-    hg_thread_rwlock_rdlock(&hg_core_map->lock);
-    value = hg_hash_table_lookup(hg_core_map->map, (hg_hash_table_key_t) id);
-    hg_thread_rwlock_release_rdlock(&hg_core_map->lock);
+    if (bucket == NULL)
+        return NULL;
 
-    return (value == HG_HASH_TABLE_NULL) ? NULL
-                                         : (struct hg_core_rpc_info *) value;
+    for (i = 0; i < bucket->count; i++)
+        if (bucket->entries[i].id == *id)
+            return bucket->entries[i].rpc_info;
+
+    return NULL;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2425,8 +3384,12 @@ hg_core_map_insert(struct hg_core_map *hg_core_map, hg_id_t *id,
     struct hg_core_rpc_info **hg_core_rpc_info_p)
 {
     struct hg_core_rpc_info *hg_core_rpc_info;
+    struct hg_core_map_table *table;
+    const struct hg_core_map_bucket *old_bucket;
+    struct hg_core_map_bucket *new_bucket;
+    hg_atomic_int64_t *slot;
+    unsigned int count;
     hg_return_t ret;
-    int rc;
 
     /* Allocate new RPC info */
     hg_core_rpc_info =
@@ -2435,18 +3398,47 @@ hg_core_map_insert(struct hg_core_map *hg_core_map, hg_id_t *id,
         "Could not allocate HG core RPC info");
     hg_core_rpc_info->id = *id;
 
-    hg_thread_rwlock_wrlock(&hg_core_map->lock);
-    rc = hg_hash_table_insert(hg_core_map->map,
-        (hg_hash_table_key_t) &hg_core_rpc_info->id,
-        (hg_hash_table_value_t) hg_core_rpc_info);
-    hg_thread_rwlock_release_wrlock(&hg_core_map->lock);
-    HG_CHECK_SUBSYS_ERROR(
-        cls, rc == 0, error, ret, HG_NOMEM, "hg_hash_table_insert() failed");
+    hg_thread_mutex_lock(&hg_core_map->lock);
+
+    /* Keep an average of HG_CORE_MAP_LOAD entries per bucket */
+    table = (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+        &hg_core_map->table);
+    if (hg_core_map->count >= HG_CORE_MAP_LOAD * (table->mask + 1)) {
+        ret = hg_core_map_table_grow(hg_core_map);
+        HG_CHECK_SUBSYS_HG_ERROR(cls, unlock, ret, "Could not grow RPC map");
+        table = (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+            &hg_core_map->table);
+    }
+
+    /* Copy bucket and append entry */
+    slot = &table->buckets[hg_core_map_hash(*id) & table->mask];
+    old_bucket = (const struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+        slot);
+    count = (old_bucket != NULL) ? old_bucket->count : 0;
+
+    new_bucket = (struct hg_core_map_bucket *) malloc(
+        sizeof(*new_bucket) + (count + 1) * sizeof(struct hg_core_map_entry));
+    HG_CHECK_SUBSYS_ERROR(cls, new_bucket == NULL, unlock, ret, HG_NOMEM,
+        "Could not allocate RPC map bucket");
+    new_bucket->retired = NULL;
+    if (count > 0)
+        memcpy(new_bucket->entries, old_bucket->entries,
+            count * sizeof(struct hg_core_map_entry));
+    new_bucket->entries[count] = (struct hg_core_map_entry){
+        .id = *id, .rpc_info = hg_core_rpc_info};
+    new_bucket->count = count + 1;
+
+    hg_core_map_bucket_publish(hg_core_map, slot, new_bucket);
+    hg_core_map->count++;
+
+    hg_thread_mutex_unlock(&hg_core_map->lock);
 
     *hg_core_rpc_info_p = hg_core_rpc_info;
 
     return HG_SUCCESS;
 
+unlock:
+    hg_thread_mutex_unlock(&hg_core_map->lock);
 error:
     free(hg_core_rpc_info);
 
@@ -2457,19 +3449,56 @@ error:
 static hg_return_t
 hg_core_map_remove(struct hg_core_map *hg_core_map, hg_id_t *id)
 {
+    struct hg_core_rpc_info *hg_core_rpc_info = NULL;
+    struct hg_core_map_table *table;
+    const struct hg_core_map_bucket *old_bucket;
+    struct hg_core_map_bucket *new_bucket = NULL;
+    hg_atomic_int64_t *slot;
+    unsigned int i, j;
     hg_return_t ret;
-    int rc;
 
-    /* Remove key */
-    hg_thread_rwlock_wrlock(&hg_core_map->lock);
-    rc = hg_hash_table_remove(hg_core_map->map, (hg_hash_table_key_t) id);
-    hg_thread_rwlock_release_wrlock(&hg_core_map->lock);
-    HG_CHECK_SUBSYS_ERROR(
-        cls, rc != 1, error, ret, HG_NOENTRY, "hg_hash_table_remove() failed");
+    hg_thread_mutex_lock(&hg_core_map->lock);
+
+    table = (struct hg_core_map_table *) (intptr_t) hg_atomic_get64(
+        &hg_core_map->table);
+    slot = &table->buckets[hg_core_map_hash(*id) & table->mask];
+    old_bucket = (const struct hg_core_map_bucket *) (intptr_t) hg_atomic_get64(
+        slot);
+
+    for (i = 0; old_bucket != NULL && i < old_bucket->count; i++)
+        if (old_bucket->entries[i].id == *id)
+            break;
+    HG_CHECK_SUBSYS_ERROR(cls, old_bucket == NULL || i == old_bucket->count,
+        unlock, ret, HG_NOENTRY, "Could not find RPC ID (%" PRIu64 ")", *id);
+    hg_core_rpc_info = old_bucket->entries[i].rpc_info;
+
+    /* Copy remaining entries, if any */
+    if (old_bucket->count > 1) {
+        new_bucket = (struct hg_core_map_bucket *) malloc(sizeof(*new_bucket) +
+            (old_bucket->count - 1) * sizeof(struct hg_core_map_entry));
+        HG_CHECK_SUBSYS_ERROR(cls, new_bucket == NULL, unlock, ret, HG_NOMEM,
+            "Could not allocate RPC map bucket");
+        new_bucket->retired = NULL;
+        new_bucket->count = 0;
+        for (j = 0; j < old_bucket->count; j++)
+            if (j != i)
+                new_bucket->entries[new_bucket->count++] =
+                    old_bucket->entries[j];
+    }
+
+    hg_core_map_bucket_publish(hg_core_map, slot, new_bucket);
+    hg_core_map->count--;
+
+    hg_thread_mutex_unlock(&hg_core_map->lock);
+
+    /* Free value */
+    hg_core_map_value_free(hg_core_rpc_info);
 
     return HG_SUCCESS;
 
-error:
+unlock:
+    hg_thread_mutex_unlock(&hg_core_map->lock);
+
     return ret;
 }
 
@@ -3114,14 +4143,20 @@ hg_core_create(struct hg_core_private_context *context, na_class_t *na_class,
     struct hg_core_private_handle *hg_core_handle = NULL;
     hg_return_t ret;
 
-    /* Allocate new handle */
-    ret = hg_core_alloc(context, &hg_core_handle);
-    HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not allocate handle");
+    /* Client handles are re-used from context cache when possible */
+    if (flags == 0)
+        hg_core_handle = hg_core_context_cache_get(context, na_class);
 
-    /* Alloc/init NA resources */
-    ret = hg_core_alloc_na(hg_core_handle, na_class, na_context, flags);
-    HG_CHECK_SUBSYS_HG_ERROR(
-        rpc, error, ret, "Could not allocate NA handle resources");
+    if (hg_core_handle == NULL) {
+        /* Allocate new handle */
+        ret = hg_core_alloc(context, &hg_core_handle);
+        HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not allocate handle");
+
+        /* Alloc/init NA resources */
+        ret = hg_core_alloc_na(hg_core_handle, na_class, na_context, flags);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            rpc, error, ret, "Could not allocate NA handle resources");
+    }
 
     /* Execute class callback on handle, this allows upper layers to
      * allocate private data on handle creation */
@@ -3194,6 +4229,9 @@ hg_core_destroy(struct hg_core_private_handle *hg_core_handle)
             (void *) hg_core_handle);
 
         /* TODO handle error */
+    } else if (hg_core_context_cache_put(hg_core_handle)) {
+        HG_LOG_SUBSYS_DEBUG(
+            rpc, "Cached handle (%p) for re-use", (void *) hg_core_handle);
     } else {
         struct hg_core_private_class *hg_core_class =
             HG_CORE_HANDLE_CLASS(hg_core_handle);
@@ -3290,6 +4328,10 @@ hg_core_free(struct hg_core_private_handle *hg_core_handle)
 {
     struct hg_core_private_context *context;
 
+    /* Remove handle from pool that owns it */
+    if (hg_core_handle->handle_pool != NULL)
+        hg_core_handle_pool_remove(hg_core_handle);
+
     /* Remove reference to HG addr */
     hg_core_addr_free(
         (struct hg_core_private_addr *) hg_core_handle->core_handle.info.addr);
@@ -3475,7 +4517,8 @@ hg_core_reset_post(struct hg_core_private_handle *hg_core_handle)
 {
     struct hg_core_private_context *context =
         HG_CORE_HANDLE_CONTEXT(hg_core_handle);
-    struct hg_core_handle_pool *hg_core_handle_pool;
+    struct hg_core_handle_pool *hg_core_handle_pool =
+        hg_core_handle->handle_pool;
     bool use_multi_recv =
         hg_atomic_get32(&hg_core_handle->status) & HG_CORE_OP_MULTI_RECV;
     struct hg_core_multi_recv_op *multi_recv_op = hg_core_handle->multi_recv_op;
@@ -3508,22 +4551,10 @@ hg_core_reset_post(struct hg_core_private_handle *hg_core_handle)
         hg_core_handle->multi_recv_op = NULL;
     }
 
-#ifdef NA_HAS_SM
-    hg_core_handle_pool = (hg_core_handle->na_class ==
-                              context->core_context.core_class->na_sm_class)
-                              ? context->sm_handle_pool
-                              : context->handle_pool;
-#else
-    hg_core_handle_pool = context->handle_pool;
-#endif
+    if (use_multi_recv) {
+        /* Return handle to pool */
+        hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
 
-    /* Add handle back to pending list */
-    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-    HG_LIST_INSERT_HEAD(
-        &hg_core_handle_pool->pending_list.list, hg_core_handle, pending);
-    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
-
-    if (use_multi_recv) {
         if (multi_recv_op != NULL &&
             hg_atomic_decr32(&multi_recv_op->ref_count) == 0 &&
             hg_atomic_get32(&multi_recv_op->last)) {
@@ -3539,7 +4570,7 @@ hg_core_reset_post(struct hg_core_private_handle *hg_core_handle)
         }
     } else {
         /* Repost single recv */
-        ret = hg_core_post(hg_core_handle);
+        ret = hg_core_handle_pool_post(hg_core_handle);
         HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Cannot post handle");
     }
 
@@ -4154,28 +5185,21 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
         (struct hg_core_private_handle *) callback_info->arg;
     struct hg_core_private_context *context =
         HG_CORE_HANDLE_CONTEXT(hg_core_handle);
-    struct hg_core_handle_pool *hg_core_handle_pool;
+    struct hg_core_handle_pool *hg_core_handle_pool =
+        hg_core_handle->handle_pool;
     const struct na_cb_info_recv_unexpected *na_cb_info_recv_unexpected =
         &callback_info->info.recv_unexpected;
+    int32_t posted_count;
     hg_return_t ret;
 
-/* Remove handle from pending list */
-#ifdef NA_HAS_SM
-    hg_core_handle_pool = (hg_core_handle->na_class ==
-                              context->core_context.core_class->na_sm_class)
-                              ? context->sm_handle_pool
-                              : context->handle_pool;
-#else
-    hg_core_handle_pool = context->handle_pool;
-#endif
-    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-    HG_LIST_REMOVE(hg_core_handle, pending);
-    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+    /* Handle is no longer posted */
+    hg_atomic_set32(&hg_core_handle->recv_posted, 0);
+    posted_count = hg_atomic_decr32(&hg_core_handle_pool->posted_count);
 
     if (callback_info->ret == NA_SUCCESS) {
         /* Extend pool if all handles are being utilized */
         if (hg_core_handle_pool->incr_count > 0 && !context->finalizing &&
-            hg_core_handle_pool_empty(hg_core_handle_pool)) {
+            posted_count == 0) {
             HG_LOG_SUBSYS_WARNING(perf,
                 "Pre-posted handles have all been consumed / are being "
                 "utilized, posting %u more",
@@ -4815,18 +5839,21 @@ hg_core_complete(struct hg_core_private_handle *hg_core_handle, hg_return_t ret)
     hg_core_handle->hg_completion_entry.op_id.hg_core_handle =
         (hg_core_handle_t) hg_core_handle;
 
-    hg_core_completion_add(hg_core_handle->core_handle.info.context,
+    ret = hg_core_completion_add(hg_core_handle->core_handle.info.context,
         &hg_core_handle->hg_completion_entry, hg_core_handle->is_self);
+    HG_CHECK_SUBSYS_ERROR_DONE(rpc, ret != HG_SUCCESS,
+        "Could not add handle (%p) to completion queue",
+        (void *) hg_core_handle);
 }
 
 /*---------------------------------------------------------------------------*/
-void
+hg_return_t
 hg_core_completion_add(struct hg_core_context *core_context,
     struct hg_completion_entry *hg_completion_entry, hg_bool_t loopback_notify)
 {
     struct hg_core_private_context *context =
         (struct hg_core_private_context *) core_context;
-    struct hg_core_completion_queue *backfill_queue = &context->backfill_queue;
+    hg_return_t ret = HG_SUCCESS;
     int rc;
 
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
@@ -4835,23 +5862,30 @@ hg_core_completion_add(struct hg_core_context *core_context,
         hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(context)->counters.bulk_count);
 #endif
 
+    hg_completion_entry->context = core_context;
+
     rc = hg_atomic_queue_push(context->completion_queue, hg_completion_entry);
     if (rc != HG_UTIL_SUCCESS) {
         HG_LOG_SUBSYS_WARNING(perf, "Atomic completion queue is full, pushing "
                                     "completion data to backfill queue");
 
         /* Queue is full */
-        hg_thread_mutex_lock(&backfill_queue->mutex);
-        HG_QUEUE_PUSH_TAIL(&backfill_queue->queue, hg_completion_entry, entry);
-        hg_atomic_incr32(&backfill_queue->count);
-        hg_thread_mutex_unlock(&backfill_queue->mutex);
+        ret = hg_core_backfill_push(
+            &context->backfill_queue, hg_completion_entry);
+        HG_CHECK_SUBSYS_HG_ERROR(poll, done, ret,
+            "Could not push completion entry to backfill queue");
     }
 
     /* Callback is pushed to the completion queue when something completes
-     * so wake up anyone waiting in trigger */
-    hg_thread_mutex_lock(&backfill_queue->mutex);
-    hg_thread_cond_signal(&backfill_queue->cond);
-    hg_thread_mutex_unlock(&backfill_queue->mutex);
+     * so wake up anyone waiting in trigger. Waiters are counted before they
+     * check the queues, the fence guarantees that either the entry is seen
+     * or the waiter is. */
+    hg_atomic_fence();
+    if (hg_atomic_get32(&context->completion_notify.waiters) > 0) {
+        hg_thread_mutex_lock(&context->completion_notify.mutex);
+        hg_thread_cond_signal(&context->completion_notify.cond);
+        hg_thread_mutex_unlock(&context->completion_notify.mutex);
+    }
 
     if (loopback_notify && context->loopback_notify.event > 0) {
         hg_thread_mutex_lock(&context->loopback_notify.mutex);
@@ -4865,6 +5899,9 @@ hg_core_completion_add(struct hg_core_context *core_context,
 unlock:
         hg_thread_mutex_unlock(&context->loopback_notify.mutex);
     }
+
+done:
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4872,11 +5909,35 @@ static hg_return_t
 hg_core_progress(
     struct hg_core_private_context *context, unsigned int timeout_ms)
 {
-    hg_time_t deadline, now = hg_time_from_ms(0);
+    hg_time_t deadline, now = hg_time_from_ms(0), wait_start;
+    hg_bool_t spin_probe = HG_FALSE;
     hg_return_t ret;
 
-    if (timeout_ms != 0)
+    if (timeout_ms != 0) {
+        unsigned int spin_time =
+            (unsigned int) hg_atomic_get32(&context->progress_spin.time);
+
+        /* Busy-poll for a while before arming notifications and blocking */
+        if (spin_time > 0) {
+            hg_bool_t progressed = HG_FALSE;
+
+            if (spin_time / 1000 >= timeout_ms)
+                spin_time = timeout_ms * 1000;
+            ret = hg_core_progress_spin(context, spin_time, &progressed);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                poll, error, ret, "Could not busy-poll context");
+
+            if (progressed)
+                return HG_SUCCESS;
+        } else if (HG_CORE_CONTEXT_CLASS(context)
+                       ->init_info.progress_spin_adaptive) {
+            /* Window was shrunk, keep track of how long we end up waiting */
+            spin_probe = HG_TRUE;
+            hg_time_get_current(&wait_start);
+        }
+
         hg_time_get_current_ms(&now);
+    }
     deadline = hg_time_add(now, hg_time_from_ms(timeout_ms));
 
     do {
@@ -4904,6 +5965,9 @@ hg_core_progress(
             poll_timeout = hg_time_to_ms(hg_time_subtract(deadline, now));
         }
 
+        if (safe_wait || poll_timeout > 0)
+            hg_atomic_incr64(&context->progress_spin.sleep_count);
+
         /* Only enter blocking wait if it is safe to */
         if (safe_wait) {
             ret = hg_core_poll_wait(context, poll_timeout, &progressed);
@@ -4916,28 +5980,111 @@ hg_core_progress(
         }
 
         /* We progressed or we have something to trigger */
-        if (progressed ||
-            !hg_atomic_queue_is_empty(context->completion_queue) ||
-            hg_atomic_get32(&context->backfill_queue.count) > 0)
+        if (progressed || !hg_core_completion_queue_empty(context)) {
+            if (spin_probe)
+                hg_core_progress_spin_probe(context, wait_start, HG_TRUE);
             return HG_SUCCESS;
+        }
 
         if (timeout_ms != 0)
             hg_time_get_current_ms(&now);
     } while (hg_time_less(now, deadline));
 
+    if (spin_probe)
+        hg_core_progress_spin_probe(context, wait_start, HG_FALSE);
+
     return HG_TIMEOUT;
 
 error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_progress_spin(struct hg_core_private_context *context,
+    unsigned int spin_time, hg_bool_t *progressed_p)
+{
+    const struct hg_core_init_info *init_info =
+        &HG_CORE_CONTEXT_CLASS(context)->init_info;
+    hg_time_t start, deadline, now;
+    hg_bool_t progressed = HG_FALSE;
+    hg_return_t ret;
+
+    hg_atomic_incr64(&context->progress_spin.spin_count);
+
+    hg_time_get_current(&start);
+    deadline =
+        hg_time_add(start, hg_time_from_double((double) spin_time / 1e6));
+
+    do {
+        ret = hg_core_poll(context, 0, &progressed);
+        HG_CHECK_SUBSYS_HG_ERROR(poll, error, ret,
+            "Could not make non-blocking progress on context");
+
+        progressed |= !hg_core_completion_queue_empty(context);
+        hg_time_get_current(&now);
+    } while (!progressed && hg_time_less(now, deadline));
+
+    if (progressed)
+        hg_atomic_incr64(&context->progress_spin.spin_hits);
+
+    if (init_info->progress_spin_adaptive) {
+        if (progressed) {
+            /* Make sure the window covers that wait next time with some
+             * margin, since spinning stops as soon as there is progress, a
+             * wider window costs nothing as long as events keep coming */
+            unsigned int spin_time_needed =
+                (unsigned int) (2. * hg_time_diff(now, start) * 1e6) + 1;
+
+            spin_time = MAX(spin_time,
+                MIN(spin_time_needed, init_info->progress_spin_time));
+        } else
+            spin_time /= 2; /* Spinning was wasted, shrink window */
+
+        hg_atomic_set32(&context->progress_spin.time, (int32_t) spin_time);
+    }
+
+    *progressed_p = progressed;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_progress_spin_probe(struct hg_core_private_context *context,
+    hg_time_t wait_start, hg_bool_t progressed)
+{
+    unsigned int spin_time_max =
+        HG_CORE_CONTEXT_CLASS(context)->init_info.progress_spin_time;
+    hg_time_t now;
+    double wait_time;
+
+    hg_time_get_current(&now);
+    wait_time = hg_time_diff(now, wait_start) * 1e6;
+
+    /* Only consecutive short waits are worth spinning for again */
+    if (!progressed || wait_time > (double) spin_time_max) {
+        hg_atomic_set32(&context->progress_spin.probe_count, 0);
+        return;
+    }
+
+    if (hg_atomic_incr32(&context->progress_spin.probe_count) >=
+        HG_CORE_PROGRESS_SPIN_PROBE) {
+        hg_atomic_set32(&context->progress_spin.probe_count, 0);
+        hg_atomic_set32(&context->progress_spin.time,
+            (int32_t) MIN((unsigned int) (2. * wait_time) + 1, spin_time_max));
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_bool_t
 hg_core_poll_try_wait(struct hg_core_private_context *context)
 {
     /* Something is in one of the completion queues */
-    if (!hg_atomic_queue_is_empty(context->completion_queue) ||
-        (hg_atomic_get32(&context->backfill_queue.count) > 0))
+    if (!hg_core_completion_queue_empty(context))
         return HG_FALSE;
 
 #ifdef NA_HAS_SM
@@ -5174,18 +6321,13 @@ hg_core_trigger(struct hg_core_private_context *context,
 
         hg_completion_entry = hg_atomic_queue_pop_mc(context->completion_queue);
         if (!hg_completion_entry) {
-            struct hg_core_completion_queue *backfill_queue =
-                &context->backfill_queue;
-
             /* Check backfill queue */
-            if (hg_atomic_get32(&backfill_queue->count) > 0) {
-                hg_thread_mutex_lock(&backfill_queue->mutex);
-                hg_completion_entry = HG_QUEUE_FIRST(&backfill_queue->queue);
-                HG_QUEUE_POP_HEAD(&backfill_queue->queue, entry);
-                hg_atomic_decr32(&backfill_queue->count);
-                hg_thread_mutex_unlock(&backfill_queue->mutex);
-                if (hg_completion_entry == NULL)
+            if (hg_atomic_get32(&context->backfill_queue.count) > 0) {
+                void *entry = NULL;
+
+                if (hg_core_backfill_pop_batch(context, &entry, 1) == 0)
                     continue; /* Give another change to grab it */
+                hg_completion_entry = (struct hg_completion_entry *) entry;
             } else {
                 /* If something was already processed leave */
                 if (count > 0)
@@ -5197,17 +6339,8 @@ hg_core_trigger(struct hg_core_private_context *context,
                     break;
                 }
 
-                hg_thread_mutex_lock(&backfill_queue->mutex);
                 /* Otherwise wait remaining ms */
-                if (hg_atomic_queue_is_empty(context->completion_queue) &&
-                    hg_atomic_get32(&backfill_queue->count) == 0) {
-                    if (hg_thread_cond_timedwait(&backfill_queue->cond,
-                            &backfill_queue->mutex,
-                            hg_time_to_ms(hg_time_subtract(deadline, now))) !=
-                        HG_UTIL_SUCCESS)
-                        ret = HG_TIMEOUT; /* Timeout occurred so leave */
-                }
-                hg_thread_mutex_unlock(&backfill_queue->mutex);
+                ret = hg_core_completion_wait(context, deadline, now);
                 if (ret == HG_TIMEOUT)
                     break;
 
@@ -5258,6 +6391,659 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_trigger_batch(struct hg_core_private_context *context,
+    unsigned int timeout_ms, unsigned int max_count,
+    unsigned int *actual_count_p)
+{
+    hg_time_t deadline, now = hg_time_from_ms(0);
+    unsigned int count = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (timeout_ms != 0)
+        hg_time_get_current_ms(&now);
+    deadline = hg_time_add(now, hg_time_from_ms(timeout_ms));
+
+    while (count < max_count) {
+        void *entries[HG_CORE_TRIGGER_BATCH_MAX];
+        unsigned int batch_count =
+            MIN(max_count - count, HG_CORE_TRIGGER_BATCH_MAX);
+        unsigned int entry_count;
+
+        /* Claim as many entries as possible with a single reservation */
+        entry_count = hg_atomic_queue_pop_mc_batch(
+            context->completion_queue, entries, batch_count);
+        if (entry_count == 0 &&
+            hg_atomic_get32(&context->backfill_queue.count) > 0)
+            entry_count =
+                hg_core_backfill_pop_batch(context, entries, batch_count);
+
+        if (entry_count == 0) {
+            /* If something was already processed leave */
+            if (count > 0)
+                break;
+
+            /* Timeout is 0 so leave */
+            if (!hg_time_less(now, deadline)) {
+                ret = HG_TIMEOUT;
+                break;
+            }
+
+            /* Otherwise wait remaining ms */
+            ret = hg_core_completion_wait(context, deadline, now);
+            if (ret == HG_TIMEOUT)
+                break;
+
+            if (timeout_ms != 0)
+                hg_time_get_current_ms(&now);
+            continue; /* Give another change to grab it */
+        }
+
+        /* Entries have been claimed, they are all triggered even if one of
+         * them fails */
+        count += entry_count;
+        ret = hg_core_trigger_entries(entries, entry_count);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            poll, done, ret, "Could not trigger completion entries");
+    }
+
+    if (actual_count_p)
+        *actual_count_p = count;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_backfill_push(struct hg_core_backfill_queue *backfill_queue,
+    struct hg_completion_entry *hg_completion_entry)
+{
+    hg_return_t ret;
+
+    for (;;) {
+        int32_t tail = hg_atomic_get32(&backfill_queue->tail), next = tail;
+        struct hg_atomic_queue *segment = (struct hg_atomic_queue *)
+            hg_atomic_get64(&backfill_queue->segments[tail]);
+
+        /* Only append to the tail segment so that entries are popped in the
+         * order they were pushed */
+        if (segment != NULL) {
+            if (hg_atomic_queue_push(segment, hg_completion_entry) ==
+                HG_UTIL_SUCCESS) {
+                hg_atomic_incr32(&backfill_queue->count);
+                return HG_SUCCESS;
+            }
+
+            /* Tail segment is full, move on to next one */
+            next = tail + 1;
+            HG_CHECK_SUBSYS_ERROR(poll, next >= HG_CORE_BACKFILL_SEGMENT_MAX,
+                error, ret, HG_NOMEM, "Backfill queue is full");
+        }
+
+        if (hg_atomic_get64(&backfill_queue->segments[next]) == 0) {
+            struct hg_atomic_queue *new_segment = hg_atomic_queue_alloc_numa(
+                (unsigned int) HG_CORE_ATOMIC_QUEUE_SIZE << next,
+                backfill_queue->numa_node);
+            HG_CHECK_SUBSYS_ERROR(poll, new_segment == NULL, error, ret,
+                HG_NOMEM, "Could not allocate backfill segment %d", next);
+
+            /* Another thread may have installed a segment already */
+            if (hg_atomic_cas64(
+                    &backfill_queue->segments[next], 0, (int64_t) new_segment))
+                HG_LOG_SUBSYS_DEBUG(poll,
+                    "Allocated backfill segment %d (%u entries)", next,
+                    (unsigned int) HG_CORE_ATOMIC_QUEUE_SIZE << next);
+            else
+                hg_atomic_queue_free_numa(new_segment);
+        }
+
+        /* Another thread may have moved the tail already */
+        if (next != tail)
+            (void) hg_atomic_cas32(&backfill_queue->tail, tail, next);
+    }
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_core_backfill_pop_batch(struct hg_core_private_context *context,
+    void **entries, unsigned int max_count)
+{
+    struct hg_core_backfill_queue *backfill_queue = &context->backfill_queue;
+    unsigned int count = 0, i;
+
+    for (i = 0; i < HG_CORE_BACKFILL_SEGMENT_MAX && count < max_count; i++) {
+        struct hg_atomic_queue *segment = (struct hg_atomic_queue *)
+            hg_atomic_get64(&backfill_queue->segments[i]);
+        unsigned int segment_count;
+
+        /* Segments are allocated in order */
+        if (segment == NULL)
+            break;
+
+        segment_count = hg_atomic_queue_pop_mc_batch(
+            segment, &entries[count], max_count - count);
+        count += segment_count;
+        while (segment_count-- > 0)
+            hg_atomic_decr32(&backfill_queue->count);
+    }
+
+    return count;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_backfill_free(struct hg_core_backfill_queue *backfill_queue)
+{
+    unsigned int i;
+
+    for (i = 0; i < HG_CORE_BACKFILL_SEGMENT_MAX; i++) {
+        struct hg_atomic_queue *segment = (struct hg_atomic_queue *)
+            hg_atomic_get64(&backfill_queue->segments[i]);
+
+        if (segment == NULL)
+            break;
+        hg_atomic_queue_free_numa(segment);
+        hg_atomic_set64(&backfill_queue->segments[i], 0);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_bool_t
+hg_core_completion_queue_empty(struct hg_core_private_context *context)
+{
+    return hg_atomic_queue_is_empty(context->completion_queue) &&
+           hg_atomic_get32(&context->backfill_queue.count) <= 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_completion_wait(
+    struct hg_core_private_context *context, hg_time_t deadline, hg_time_t now)
+{
+    struct hg_core_completion_notify *completion_notify =
+        &context->completion_notify;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_mutex_lock(&completion_notify->mutex);
+
+    /* Register as waiter before checking queues so that producers that do not
+     * see the waiter are guaranteed to have their entry seen */
+    hg_atomic_incr32(&completion_notify->waiters);
+    hg_atomic_fence();
+
+    if (hg_core_completion_queue_empty(context)) {
+        if (hg_thread_cond_timedwait(&completion_notify->cond,
+                &completion_notify->mutex,
+                hg_time_to_ms(hg_time_subtract(deadline, now))) !=
+            HG_UTIL_SUCCESS)
+            ret = HG_TIMEOUT; /* Timeout occurred so leave */
+    }
+
+    hg_atomic_decr32(&completion_notify->waiters);
+    hg_thread_mutex_unlock(&completion_notify->mutex);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_trigger_entries(void **entries, unsigned int count)
+{
+    struct hg_core_private_handle *rpc_entries[HG_CORE_TRIGGER_BATCH_MAX];
+    struct hg_bulk_op_id *bulk_entries[HG_CORE_TRIGGER_BATCH_MAX];
+    struct hg_core_op_id *addr_entries[HG_CORE_TRIGGER_BATCH_MAX];
+    unsigned int rpc_count = 0, bulk_count = 0, addr_count = 0, i;
+    hg_return_t ret = HG_SUCCESS, rc;
+
+    /* Group entries by type */
+    for (i = 0; i < count; i++) {
+        struct hg_completion_entry *hg_completion_entry =
+            (struct hg_completion_entry *) entries[i];
+
+        switch (hg_completion_entry->op_type) {
+            case HG_RPC:
+                rpc_entries[rpc_count++] =
+                    (struct hg_core_private_handle *)
+                        hg_completion_entry->op_id.hg_core_handle;
+                break;
+            case HG_BULK:
+                bulk_entries[bulk_count++] =
+                    hg_completion_entry->op_id.hg_bulk_op_id;
+                break;
+            case HG_ADDR:
+                addr_entries[addr_count++] =
+                    hg_completion_entry->op_id.hg_core_op_id;
+                break;
+            default:
+                HG_LOG_SUBSYS_ERROR(poll,
+                    "Invalid type of completion entry (%d)",
+                    (int) hg_completion_entry->op_type);
+                ret = HG_INVALID_ARG;
+        }
+    }
+
+    /* Dispatch each group, keep first error */
+    for (i = 0; i < rpc_count; i++) {
+        rc = hg_core_trigger_entry(rpc_entries[i]);
+        HG_CHECK_SUBSYS_ERROR_DONE(poll, rc != HG_SUCCESS,
+            "Could not trigger RPC completion entry");
+        if (ret == HG_SUCCESS)
+            ret = rc;
+    }
+
+    for (i = 0; i < bulk_count; i++) {
+        rc = hg_bulk_trigger_entry(bulk_entries[i]);
+        HG_CHECK_SUBSYS_ERROR_DONE(poll, rc != HG_SUCCESS,
+            "Could not trigger bulk completion entry");
+        if (ret == HG_SUCCESS)
+            ret = rc;
+    }
+
+    for (i = 0; i < addr_count; i++) {
+        rc = hg_core_trigger_lookup_entry(addr_entries[i]);
+        HG_CHECK_SUBSYS_ERROR_DONE(poll, rc != HG_SUCCESS,
+            "Could not trigger addr completion entry");
+        if (ret == HG_SUCCESS)
+            ret = rc;
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_engine_create(
+    unsigned int worker_count, struct hg_core_engine **engine_p)
+{
+    struct hg_core_engine *engine = NULL;
+    hg_bool_t mutex_init = HG_FALSE, cond_init = HG_FALSE;
+    hg_return_t ret;
+    unsigned int i;
+    int rc;
+
+    HG_LOG_SUBSYS_DEBUG(
+        cls, "Creating progress engine with %u trigger workers", worker_count);
+
+    engine = (struct hg_core_engine *) calloc(1, sizeof(*engine));
+    HG_CHECK_SUBSYS_ERROR(cls, engine == NULL, error, ret, HG_NOMEM,
+        "Could not allocate progress engine");
+    hg_atomic_init32(&engine->sleepers, 0);
+    hg_atomic_init32(&engine->next, 0);
+    hg_atomic_init32(&engine->shutdown, 0);
+
+    rc = hg_thread_mutex_init(&engine->mutex);
+    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "hg_thread_mutex_init() failed");
+    mutex_init = HG_TRUE;
+    rc = hg_thread_cond_init(&engine->cond);
+    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "hg_thread_cond_init() failed");
+    cond_init = HG_TRUE;
+
+    engine->workers = (struct hg_core_engine_worker *) calloc(
+        worker_count, sizeof(*engine->workers));
+    HG_CHECK_SUBSYS_ERROR(cls, engine->workers == NULL, error, ret, HG_NOMEM,
+        "Could not allocate array of %u workers", worker_count);
+
+    for (i = 0; i < worker_count; i++) {
+        struct hg_core_engine_worker *worker = &engine->workers[i];
+
+        worker->queue = hg_atomic_queue_alloc(HG_CORE_ENGINE_QUEUE_SIZE);
+        HG_CHECK_SUBSYS_ERROR(cls, worker->queue == NULL, error, ret, HG_NOMEM,
+            "Could not allocate worker queue");
+        worker->engine = engine;
+        worker->id = i;
+        worker->thread_work.func = hg_core_engine_worker;
+        worker->thread_work.args = worker;
+        engine->worker_count++;
+    }
+
+    rc = hg_thread_pool_init(worker_count, &engine->thread_pool);
+    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "Could not create thread pool of %u threads", worker_count);
+
+    /* Each worker keeps running until the engine is destroyed */
+    for (i = 0; i < worker_count; i++) {
+        rc = hg_thread_pool_post(
+            engine->thread_pool, &engine->workers[i].thread_work);
+        HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret,
+            HG_FAULT, "Could not post worker %u", i);
+    }
+
+    *engine_p = engine;
+
+    return HG_SUCCESS;
+
+error:
+    if (engine != NULL) {
+        if (engine->thread_pool != NULL) {
+            hg_atomic_set32(&engine->shutdown, 1);
+            (void) hg_thread_pool_destroy(engine->thread_pool);
+        }
+        if (engine->workers != NULL) {
+            for (i = 0; i < engine->worker_count; i++)
+                hg_atomic_queue_free(engine->workers[i].queue);
+            free(engine->workers);
+        }
+        if (mutex_init)
+            (void) hg_thread_mutex_destroy(&engine->mutex);
+        if (cond_init)
+            (void) hg_thread_cond_destroy(&engine->cond);
+        free(engine);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_engine_destroy(struct hg_core_engine *engine)
+{
+    unsigned int i;
+
+    HG_LOG_SUBSYS_DEBUG(cls, "Destroying progress engine");
+
+    /* Wake up idle workers so that they can exit */
+    hg_thread_mutex_lock(&engine->mutex);
+    hg_atomic_set32(&engine->shutdown, 1);
+    hg_thread_cond_broadcast(&engine->cond);
+    hg_thread_mutex_unlock(&engine->mutex);
+
+    (void) hg_thread_pool_destroy(engine->thread_pool);
+
+    for (i = 0; i < engine->worker_count; i++)
+        hg_atomic_queue_free(engine->workers[i].queue);
+    free(engine->workers);
+    (void) hg_thread_mutex_destroy(&engine->mutex);
+    (void) hg_thread_cond_destroy(&engine->cond);
+    free(engine);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_engine_context_start(struct hg_core_private_context *context)
+{
+    hg_return_t ret;
+    int rc;
+
+    /* Already started when the context was created */
+    if (context->engine_running)
+        return HG_SUCCESS;
+
+    hg_atomic_set32(&context->engine_stop, 0);
+    rc = hg_thread_create(
+        &context->engine_thread, hg_core_engine_progress, context);
+    HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "Could not create engine progress thread");
+    context->engine_running = HG_TRUE;
+
+    HG_LOG_SUBSYS_DEBUG(
+        ctx, "Started engine progress on context (%p)", (void *) context);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_engine_context_stop(struct hg_core_private_context *context)
+{
+    hg_atomic_set32(&context->engine_stop, 1);
+    (void) hg_thread_join(context->engine_thread);
+    context->engine_running = HG_FALSE;
+
+    /* Entries already handed out to workers must be triggered before the
+     * context can be used again from the calling thread */
+    while (hg_atomic_get32(&context->engine_pending) > 0)
+        hg_thread_yield();
+
+    HG_LOG_SUBSYS_DEBUG(
+        ctx, "Stopped engine progress on context (%p)", (void *) context);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_engine_context_wait(struct hg_core_private_context *context,
+    unsigned int timeout_ms, unsigned int *count_p)
+{
+    struct hg_core_completion_notify *completion_notify =
+        &context->completion_notify;
+    int32_t triggered = hg_atomic_get32(&context->engine_triggered);
+    unsigned int count;
+
+    /* Callers may have missed a completion right before waiting, do not
+     * block for longer than the engine itself would */
+    if (timeout_ms > 0) {
+        hg_thread_mutex_lock(&completion_notify->mutex);
+        hg_atomic_incr32(&completion_notify->waiters);
+        hg_atomic_fence();
+        if (hg_atomic_get32(&context->engine_triggered) == triggered)
+            (void) hg_thread_cond_timedwait(&completion_notify->cond,
+                &completion_notify->mutex,
+                MIN(timeout_ms, HG_CORE_ENGINE_TIMEOUT));
+        hg_atomic_decr32(&completion_notify->waiters);
+        hg_thread_mutex_unlock(&completion_notify->mutex);
+    }
+
+    count = (unsigned int) (hg_atomic_get32(&context->engine_triggered) -
+                            triggered);
+    if (count_p)
+        *count_p = count;
+
+    return (count > 0 || hg_atomic_get32(&context->engine_pending) > 0)
+               ? HG_SUCCESS
+               : HG_TIMEOUT;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_core_engine_progress(void *arg)
+{
+    struct hg_core_private_context *context =
+        (struct hg_core_private_context *) arg;
+    struct hg_core_engine *engine = HG_CORE_CONTEXT_CLASS(context)->engine;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+    void *entries[HG_CORE_TRIGGER_BATCH_MAX];
+
+    while (!hg_atomic_get32(&context->engine_stop)) {
+        unsigned int count;
+        hg_return_t ret;
+
+        ret = hg_core_progress(context, HG_CORE_ENGINE_TIMEOUT);
+        HG_CHECK_SUBSYS_ERROR_NORET(poll,
+            ret != HG_SUCCESS && ret != HG_TIMEOUT, done,
+            "Could not make progress");
+
+        /* Hand out everything that completed */
+        do {
+            count = hg_atomic_queue_pop_mc_batch(
+                context->completion_queue, entries, HG_CORE_TRIGGER_BATCH_MAX);
+            if (count == 0 &&
+                hg_atomic_get32(&context->backfill_queue.count) > 0)
+                count = hg_core_backfill_pop_batch(
+                    context, entries, HG_CORE_TRIGGER_BATCH_MAX);
+            if (count > 0)
+                hg_core_engine_dispatch(engine, context, entries, count);
+        } while (count > 0);
+    }
+
+done:
+    hg_thread_exit(tret);
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_engine_dispatch(struct hg_core_engine *engine,
+    struct hg_core_private_context *context, void **entries,
+    unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 0; i < count; i++) {
+        unsigned int first, j;
+
+        hg_atomic_incr32(&context->engine_pending);
+
+        /* Round-robin, move on to next worker if queue is full */
+        first = (unsigned int) hg_atomic_incr32(&engine->next) %
+                engine->worker_count;
+        for (j = 0; j < engine->worker_count; j++) {
+            struct hg_core_engine_worker *worker =
+                &engine->workers[(first + j) % engine->worker_count];
+
+            if (hg_atomic_queue_push(worker->queue, entries[i]) ==
+                HG_UTIL_SUCCESS)
+                break;
+        }
+
+        /* All workers are busy, trigger from this thread */
+        if (j == engine->worker_count) {
+            HG_LOG_SUBSYS_WARNING(perf,
+                "Engine worker queues are full, triggering from progress "
+                "thread");
+            hg_core_engine_trigger(&entries[i], 1);
+        }
+    }
+
+    /* Wake up idle workers if any */
+    hg_atomic_fence();
+    if (hg_atomic_get32(&engine->sleepers) > 0) {
+        hg_thread_mutex_lock(&engine->mutex);
+        if (count > 1)
+            hg_thread_cond_broadcast(&engine->cond);
+        else
+            hg_thread_cond_signal(&engine->cond);
+        hg_thread_mutex_unlock(&engine->mutex);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_core_engine_worker(void *arg)
+{
+    struct hg_core_engine_worker *worker = (struct hg_core_engine_worker *) arg;
+    struct hg_core_engine *engine = worker->engine;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+    void *entries[HG_CORE_TRIGGER_BATCH_MAX];
+
+    while (!hg_atomic_get32(&engine->shutdown)) {
+        unsigned int count;
+
+        /* Own queue first, then try to steal from others */
+        count = hg_atomic_queue_pop_mc_batch(
+            worker->queue, entries, HG_CORE_TRIGGER_BATCH_MAX);
+        if (count == 0)
+            count = hg_core_engine_steal(
+                engine, worker, entries, HG_CORE_TRIGGER_BATCH_MAX);
+        if (count > 0) {
+            hg_core_engine_trigger(entries, count);
+            continue;
+        }
+
+        /* Nothing to do, register as sleeper before checking again so that
+         * dispatching threads either see the sleeper or we see the entry */
+        hg_thread_mutex_lock(&engine->mutex);
+        hg_atomic_incr32(&engine->sleepers);
+        hg_atomic_fence();
+        if (!hg_atomic_get32(&engine->shutdown) &&
+            hg_core_engine_is_empty(engine))
+            (void) hg_thread_cond_timedwait(
+                &engine->cond, &engine->mutex, HG_CORE_ENGINE_TIMEOUT);
+        hg_atomic_decr32(&engine->sleepers);
+        hg_thread_mutex_unlock(&engine->mutex);
+    }
+
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_core_engine_steal(struct hg_core_engine *engine,
+    struct hg_core_engine_worker *worker, void **entries,
+    unsigned int max_count)
+{
+    unsigned int i;
+
+    for (i = 1; i < engine->worker_count; i++) {
+        struct hg_core_engine_worker *victim =
+            &engine->workers[(worker->id + i) % engine->worker_count];
+
+        /* Take at most half of the entries so that victim keeps some work */
+        if (!hg_atomic_queue_is_empty(victim->queue)) {
+            unsigned int count = MAX(
+                MIN(hg_atomic_queue_count(victim->queue) / 2, max_count), 1);
+
+            count = hg_atomic_queue_pop_mc_batch(victim->queue, entries, count);
+            if (count > 0)
+                return count;
+        }
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_core_engine_is_empty(struct hg_core_engine *engine)
+{
+    unsigned int i;
+
+    for (i = 0; i < engine->worker_count; i++)
+        if (!hg_atomic_queue_is_empty(engine->workers[i].queue))
+            return HG_FALSE;
+
+    return HG_TRUE;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_engine_trigger(void **entries, unsigned int count)
+{
+    struct hg_core_private_context *contexts[HG_CORE_TRIGGER_BATCH_MAX];
+    unsigned int i;
+    hg_return_t ret;
+
+    /* Entries may be released once triggered, save their context first */
+    for (i = 0; i < count; i++) {
+        struct hg_completion_entry *hg_completion_entry =
+            (struct hg_completion_entry *) entries[i];
+
+        contexts[i] =
+            (struct hg_core_private_context *) hg_completion_entry->context;
+    }
+
+    ret = hg_core_trigger_entries(entries, count);
+    HG_CHECK_SUBSYS_ERROR_DONE(
+        poll, ret != HG_SUCCESS, "Could not trigger completion entries");
+
+    for (i = 0; i < count; i++) {
+        hg_atomic_incr32(&contexts[i]->engine_triggered);
+        hg_atomic_decr32(&contexts[i]->engine_pending);
+    }
+
+    /* Wake up threads waiting in HG_Core_progress()/HG_Core_trigger() */
+    hg_atomic_fence();
+    for (i = 0; i < count; i++) {
+        struct hg_core_completion_notify *completion_notify =
+            &contexts[i]->completion_notify;
+
+        if ((i > 0 && contexts[i] == contexts[i - 1]) ||
+            hg_atomic_get32(&completion_notify->waiters) == 0)
+            continue;
+        hg_thread_mutex_lock(&completion_notify->mutex);
+        hg_thread_cond_broadcast(&completion_notify->cond);
+        hg_thread_mutex_unlock(&completion_notify->mutex);
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
@@ -5539,7 +7325,7 @@ HG_Core_context_create(hg_core_class_t *hg_core_class)
     HG_LOG_SUBSYS_DEBUG(ctx, "Creating new context with id=%u", 0);
 
     ret = hg_core_context_create(
-        (struct hg_core_private_class *) hg_core_class, 0, &context);
+        (struct hg_core_private_class *) hg_core_class, 0, NULL, &context);
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not create context");
 
     HG_LOG_SUBSYS_DEBUG(ctx, "Created new context (%p)", (void *) context);
@@ -5563,7 +7349,33 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
     HG_LOG_SUBSYS_DEBUG(ctx, "Creating new context with id=%u", id);
 
     ret = hg_core_context_create(
-        (struct hg_core_private_class *) hg_core_class, id, &context);
+        (struct hg_core_private_class *) hg_core_class, id, NULL, &context);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        ctx, error, ret, "Could not create context with id=%u", id);
+
+    HG_LOG_SUBSYS_DEBUG(ctx, "Created new context (%p)", (void *) context);
+
+    return (hg_core_context_t *) context;
+
+error:
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_core_context_t *
+HG_Core_context_create_id_opt(hg_core_class_t *hg_core_class, hg_uint8_t id,
+    const struct hg_context_init_info *hg_context_init_info)
+{
+    struct hg_core_private_context *context;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR_NORET(
+        ctx, hg_core_class == NULL, error, "NULL HG core class");
+
+    HG_LOG_SUBSYS_DEBUG(ctx, "Creating new context with id=%u", id);
+
+    ret = hg_core_context_create((struct hg_core_private_class *) hg_core_class,
+        id, hg_context_init_info, &context);
     HG_CHECK_SUBSYS_HG_ERROR(
         ctx, error, ret, "Could not create context with id=%u", id);
 
@@ -5618,14 +7430,29 @@ error:
 hg_return_t
 HG_Core_context_post(hg_core_context_t *context)
 {
+    struct hg_mem_numa_policy numa_policy;
     hg_return_t ret;
+    int numa_node;
 
     HG_CHECK_SUBSYS_ERROR(ctx, context == NULL, error, ret, HG_INVALID_ARG,
         "NULL HG core context");
 
+    /* Handles are allocated on the same NUMA node as the context */
+    numa_node = ((struct hg_core_private_context *) context)->numa_node;
+    hg_core_context_numa_enter(&numa_node, &numa_policy);
     ret = hg_core_context_post((struct hg_core_private_context *) context);
+    hg_core_context_numa_leave(numa_node, &numa_policy);
     HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not post context");
 
+    /* Handles are posted, engine can now make progress */
+    if (((struct hg_core_private_class *) context->core_class)->engine !=
+        NULL) {
+        ret = hg_core_engine_context_start(
+            (struct hg_core_private_context *) context);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not start engine progress");
+    }
+
     HG_LOG_SUBSYS_DEBUG(
         ctx, "Posted handles on context (%p)", (void *) context);
 
@@ -5635,6 +7462,35 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_context_get_progress_stats(
+    hg_core_context_t *context, struct hg_progress_stats *stats_p)
+{
+    struct hg_core_private_context *private_context =
+        (struct hg_core_private_context *) context;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(ctx, context == NULL, error, ret, HG_INVALID_ARG,
+        "NULL HG core context");
+    HG_CHECK_SUBSYS_ERROR(ctx, stats_p == NULL, error, ret, HG_INVALID_ARG,
+        "NULL pointer to progress stats");
+
+    stats_p->spin_count = (hg_uint64_t) hg_atomic_get64(
+        &private_context->progress_spin.spin_count);
+    stats_p->spin_hits = (hg_uint64_t) hg_atomic_get64(
+        &private_context->progress_spin.spin_hits);
+    stats_p->sleep_count = (hg_uint64_t) hg_atomic_get64(
+        &private_context->progress_spin.sleep_count);
+    stats_p->spin_time =
+        (hg_uint32_t) hg_atomic_get32(&private_context->progress_spin.time);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_register(
@@ -5808,7 +7664,9 @@ HG_Core_addr_lookup1(hg_core_context_t *context, hg_core_cb_t callback,
     hg_completion_entry->op_type = HG_ADDR;
     hg_completion_entry->op_id.hg_core_op_id = hg_core_op_id;
 
-    hg_core_completion_add(context, hg_completion_entry, HG_TRUE);
+    ret = hg_core_completion_add(context, hg_completion_entry, HG_TRUE);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        addr, error, ret, "Could not add lookup to completion queue");
 
     return HG_SUCCESS;
 
@@ -6300,6 +8158,11 @@ HG_Core_progress(hg_core_context_t *context, unsigned int timeout)
     HG_CHECK_SUBSYS_ERROR(poll, context == NULL, done, ret, HG_INVALID_ARG,
         "NULL HG core context");
 
+    /* Progress is made by the engine, only wait for callbacks */
+    if (((struct hg_core_private_context *) context)->engine_running)
+        return hg_core_engine_context_wait(
+            (struct hg_core_private_context *) context, timeout, NULL);
+
     /* Make progress on the HG layer */
     ret = hg_core_progress((struct hg_core_private_context *) context, timeout);
     HG_CHECK_SUBSYS_ERROR_NORET(poll, ret != HG_SUCCESS && ret != HG_TIMEOUT,
@@ -6319,6 +8182,17 @@ HG_Core_trigger(hg_core_context_t *context, unsigned int timeout,
     HG_CHECK_SUBSYS_ERROR(poll, context == NULL, done, ret, HG_INVALID_ARG,
         "NULL HG core context");
 
+    /* Callbacks are triggered by the engine workers, only wait for them */
+    if (((struct hg_core_private_context *) context)->engine_running) {
+        unsigned int count;
+
+        ret = hg_core_engine_context_wait(
+            (struct hg_core_private_context *) context, timeout, &count);
+        if (actual_count_p)
+            *actual_count_p = MIN(count, max_count);
+        return ret;
+    }
+
     ret = hg_core_trigger((struct hg_core_private_context *) context, timeout,
         max_count, actual_count_p);
     HG_CHECK_SUBSYS_ERROR_NORET(poll, ret != HG_SUCCESS && ret != HG_TIMEOUT,
@@ -6328,6 +8202,36 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_trigger_batch(hg_core_context_t *context, unsigned int timeout,
+    unsigned int max_count, unsigned int *actual_count_p)
+{
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(poll, context == NULL, done, ret, HG_INVALID_ARG,
+        "NULL HG core context");
+
+    /* Callbacks are triggered by the engine workers, only wait for them */
+    if (((struct hg_core_private_context *) context)->engine_running) {
+        unsigned int count;
+
+        ret = hg_core_engine_context_wait(
+            (struct hg_core_private_context *) context, timeout, &count);
+        if (actual_count_p)
+            *actual_count_p = MIN(count, max_count);
+        return ret;
+    }
+
+    ret = hg_core_trigger_batch((struct hg_core_private_context *) context,
+        timeout, max_count, actual_count_p);
+    HG_CHECK_SUBSYS_ERROR_NORET(poll, ret != HG_SUCCESS && ret != HG_TIMEOUT,
+        done, "Could not trigger callbacks");
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_cancel(hg_core_handle_t handle)
@@ -276,6 +276,22 @@ HG_Core_context_create(hg_core_class_t *hg_core_class);
 HG_PUBLIC hg_core_context_t *
 HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id);
 
+/**
+ * Create a new context with a user-defined context identifier and
+ * context-specific options (see HG_Core_context_create_id()).
+ * Context must be destroyed by calling HG_Core_context_destroy().
+ *
+ * \param hg_core_class [IN]    pointer to HG core class
+ * \param id [IN]               context ID
+ * \param hg_context_init_info [IN]
+ *                              (Optional) HG context init info, NULL if no info
+ *
+ * \return Pointer to HG core context or NULL in case of failure
+ */
+HG_PUBLIC hg_core_context_t *
+HG_Core_context_create_id_opt(hg_core_class_t *hg_core_class, hg_uint8_t id,
+    const struct hg_context_init_info *hg_context_init_info);
+
 /**
  * Destroy a context created by HG_Core_context_create().
  *
@@ -383,6 +399,20 @@ HG_Core_context_set_handle_create_callback(hg_core_context_t *context,
 HG_PUBLIC hg_return_t
 HG_Core_context_post(hg_core_context_t *context);
 
+/**
+ * Retrieve progress statistics of a context, i.e., the number of times
+ * progress was made while busy-polling versus the number of times progress
+ * had to block (see hg_init_info::progress_spin_time).
+ *
+ * \param context [IN]          pointer to HG core context
+ * \param stats_p [OUT]         pointer to progress stats
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Core_context_get_progress_stats(
+    hg_core_context_t *context, struct hg_progress_stats *stats_p);
+
 /**
  * Dynamically register an RPC ID as well as the RPC callback executed
  * when the RPC request ID is received.
@@ -861,6 +891,23 @@ HG_PUBLIC hg_return_t
 HG_Core_trigger(hg_core_context_t *context, unsigned int timeout,
     unsigned int max_count, unsigned int *actual_count_p);
 
+/**
+ * Execute at most max_count callbacks, similarly to HG_Core_trigger(), but
+ * claim completed operations in batches and dispatch them grouped by type
+ * (RPC, bulk, then lookup). Callbacks of different types may therefore not be
+ * executed in the order in which operations completed.
+ *
+ * \param context [IN]          pointer to HG core context
+ * \param timeout [IN]          timeout (in milliseconds)
+ * \param max_count [IN]        maximum number of callbacks triggered
+ * \param actual_count_p [OUT]  actual number of callbacks triggered
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Core_trigger_batch(hg_core_context_t *context, unsigned int timeout,
+    unsigned int max_count, unsigned int *actual_count_p);
+
 /**
  * Cancel an ongoing operation.
  *
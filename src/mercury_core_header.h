@@ -90,7 +90,7 @@ struct hg_core_header {
 #define HG_CORE_IDENTIFIER (('H' << 1) | ('G')) /* 0xD7 */
 
 /* Mercury protocol version number */
-#define HG_CORE_PROTOCOL_VERSION 0x05
+#define HG_CORE_PROTOCOL_VERSION 0x07
 
 /*********************/
 /* Public Prototypes */
@@ -69,7 +69,7 @@ struct hg_init_info {
     const char *sm_info_string;
 
     /* Control checksum level on RPC (Note this does not include bulk data,
-     * which is never checksummed).
+     * see bulk_checksum).
      * Default is: HG_CHECKSUM_DEFAULT */
     hg_checksum_level_t checksum_level;
 
@@ -98,6 +98,119 @@ struct hg_init_info {
      * beneficial in cases where the RPC execution time is longer than usual.
      * Default is: false */
     hg_bool_t release_input_early;
+
+    /* Controls the default number of entries of the completion queue that is
+     * allocated for each context. Completions that do not fit are pushed to a
+     * slower overflow queue. Value is rounded up to the next power of two, a
+     * value of zero is equivalent to using the internal default value.
+     * Default value is: 1024 */
+    hg_uint32_t completion_queue_size;
+
+    /* Controls whether context resources (completion queue, pools of handles
+     * and bulk operations) should be allocated on the NUMA node of the thread
+     * creating the context. The memory policy of that thread is restored
+     * once the context is created.
+     * Default is: false */
+    hg_bool_t numa_local;
+
+    /* Controls the number of trigger worker threads of the internal progress
+     * engine. When non-zero, each context is progressed by a dedicated
+     * thread that dispatches completed operations to the pool of workers,
+     * which execute the callbacks in parallel. On contexts that are
+     * progressed by the engine, HG_Progress() and HG_Trigger() do not execute
+     * anything and only wait for the workers to trigger callbacks.
+     * Default value is: 0 */
+    hg_uint32_t trigger_workers;
+
+    /* Controls the time (in microseconds) that progress spends busy-polling
+     * NA before arming notifications and blocking, when it is called with a
+     * non-zero timeout. This reduces the wake-up latency of RPCs that arrive
+     * after an idle period at the cost of CPU usage. A value of zero disables
+     * busy-polling. This value has no effect when NA_NO_BLOCK is used.
+     * Default value is: 0 */
+    hg_uint32_t progress_spin_time;
+
+    /* Controls whether the busy-poll window of each context should be tuned
+     * at runtime, within the limit of \progress_spin_time (or an internal
+     * default of 100us if zero), based on how long progress usually waits
+     * before events arrive.
+     * Default is: false */
+    hg_bool_t progress_spin_adaptive;
+
+    /* Controls whether variable-length input data (strings and byte buffers
+     * processed with hg_proc_bytes_ptr()) should be decoded by HG_Get_input()
+     * as pointers that directly reference the receive buffer instead of
+     * being copied. Decoded input is then only valid until HG_Free_input()
+     * is called and must not be modified or freed by the user.
+     * Default is: false */
+    hg_bool_t zero_copy_input;
+
+    /* Controls the maximum size of the NA operations that bulk transfers are
+     * split into. Large segments are then transferred as a pipeline of
+     * smaller operations, of which only a bounded number are in flight at any
+     * given time. A value of zero does not split segments.
+     * Default value is: 0 */
+    hg_size_t bulk_chunk_size;
+
+    /* Enables caching of the memory registrations made by HG_Bulk_create() and
+     * HG_Bulk_create_attr(), and controls the max amount of memory (in bytes)
+     * that the cache may keep registered. Registrations of the same buffer
+     * with identical size, permission flags and memory type are then re-used
+     * by subsequent handles, unused registrations are evicted in LRU order.
+     * Memory that is unmapped or freed must be invalidated by the user with
+     * HG_Bulk_reg_cache_invalidate(). A value of zero disables the cache.
+     * Default value is: 0 */
+    hg_size_t bulk_reg_cache_size;
+
+    /* Controls the number of helper threads used to copy data of bulk
+     * transfers that do not go through NA (transfers to self and copies from
+     * eager bulk handles). Large copies are then split between the calling
+     * thread and the helper threads. A value of zero copies all data from the
+     * calling thread.
+     * Default value is: 0 */
+    hg_uint32_t bulk_copy_threads;
+
+    /* Controls the max size of bulk data that is embedded along with a
+     * read-only bulk handle when it is encoded into an RPC request or
+     * response. Data is embedded only if it is below that size and if it fits
+     * into the eager buffer space that is left at that point, the target then
+     * copies it locally instead of issuing an RMA. A value of zero only
+     * limits data to the eager buffer space left (see also no_bulk_eager).
+     * Default value is: 0 */
+    hg_size_t bulk_eager_size_max;
+
+    /* Controls whether a CRC32C of bulk data is computed while it is being
+     * transferred (over the local buffer, in the order of the transfer) and
+     * reported to the bulk callback so that it can be compared with the
+     * checksum of the sender. Data in device memory is not checksummed.
+     * Default is: false */
+    hg_bool_t bulk_checksum;
+};
+
+/**
+ * HG context init info struct
+ * NB. should be initialized using HG_CONTEXT_INIT_INFO_INITIALIZER
+ */
+struct hg_context_init_info {
+    /* Overrides the number of entries of the context completion queue (see
+     * hg_init_info). A value of zero is equivalent to using the class value.
+     * Default value is: 0 */
+    hg_uint32_t completion_queue_size;
+
+    /* NUMA node on which context resources should be allocated. A negative
+     * value is equivalent to using the class setting (see hg_init_info).
+     * Default value is: -1 */
+    int numa_node;
+};
+
+/**
+ * HG progress stats struct (see HG_Core_context_get_progress_stats())
+ */
+struct hg_progress_stats {
+    hg_uint64_t spin_count;  /* Busy-poll phases entered */
+    hg_uint64_t spin_hits;   /* Busy-poll phases that made progress */
+    hg_uint64_t sleep_count; /* Blocking waits entered */
+    hg_uint32_t spin_time;   /* Current busy-poll window (us) */
 };
 
 /* Error return codes:
@@ -190,7 +303,20 @@ typedef enum {
         .request_post_init = 0, .request_post_incr = 0, .auto_sm = HG_FALSE,   \
         .sm_info_string = NULL, .checksum_level = HG_CHECKSUM_NONE,            \
         .no_bulk_eager = HG_FALSE, .no_loopback = HG_FALSE, .stats = HG_FALSE, \
-        .no_multi_recv = HG_FALSE, .release_input_early = HG_FALSE             \
+        .no_multi_recv = HG_FALSE, .release_input_early = HG_FALSE,            \
+        .completion_queue_size = 0, .numa_local = HG_FALSE,                    \
+        .trigger_workers = 0, .progress_spin_time = 0,                         \
+        .progress_spin_adaptive = HG_FALSE, .zero_copy_input = HG_FALSE,       \
+        .bulk_chunk_size = 0, .bulk_reg_cache_size = 0,                        \
+        .bulk_copy_threads = 0, .bulk_eager_size_max = 0,                      \
+        .bulk_checksum = HG_FALSE                                              \
+    }
+
+/* HG context init info initializer */
+#define HG_CONTEXT_INIT_INFO_INITIALIZER                                       \
+    (struct hg_context_init_info)                                              \
+    {                                                                          \
+        .completion_queue_size = 0, .numa_node = -1                            \
     }
 
 #endif /* MERCURY_CORE_TYPES_H */
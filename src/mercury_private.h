@@ -10,8 +10,6 @@
 
 #include "mercury_core.h"
 
-#include "mercury_queue.h"
-
 /*************************************/
 /* Public Type and Struct Definition */
 /*************************************/
@@ -33,11 +31,13 @@ struct hg_completion_entry {
         hg_core_handle_t hg_core_handle;
         struct hg_bulk_op_id *hg_bulk_op_id;
     } op_id;
-    HG_QUEUE_ENTRY(hg_completion_entry) entry;
+    hg_core_context_t *context; /* Context that the entry was completed on */
     hg_op_type_t op_type;
 };
 
 struct hg_bulk_op_pool;
+struct hg_bulk_reg_cache;
+struct hg_thread_pool;
 
 /*****************/
 /* Public Macros */
@@ -81,6 +81,38 @@ hg_core_bulk_incr(hg_core_class_t *hg_core_class);
 HG_PRIVATE void
 hg_core_bulk_decr(hg_core_class_t *hg_core_class);
 
+/**
+ * Get max size of NA operations issued by bulk transfers (0 if unlimited).
+ */
+HG_PRIVATE hg_size_t
+hg_core_bulk_chunk_size(hg_core_class_t *hg_core_class);
+
+/**
+ * Get max size of data embedded along with bulk handles (0 if unlimited).
+ */
+HG_PRIVATE hg_size_t
+hg_core_bulk_eager_size_max(hg_core_class_t *hg_core_class);
+
+/**
+ * Check whether bulk data is checksummed during transfers.
+ */
+HG_PRIVATE hg_bool_t
+hg_core_bulk_checksum(hg_core_class_t *hg_core_class);
+
+/**
+ * Get bulk registration cache (NULL if not enabled).
+ */
+HG_PRIVATE struct hg_bulk_reg_cache *
+hg_core_bulk_reg_cache(hg_core_class_t *hg_core_class);
+
+/**
+ * Get pool of bulk copy helper threads and number of threads (NULL if not
+ * enabled).
+ */
+HG_PRIVATE struct hg_thread_pool *
+hg_core_bulk_copy_pool(
+    hg_core_class_t *hg_core_class, hg_uint32_t *thread_count_p);
+
 /**
  * Get bulk op pool.
  */
@@ -90,7 +122,7 @@ hg_core_context_get_bulk_op_pool(struct hg_core_context *core_context);
 /**
  * Add entry to completion queue.
  */
-HG_PRIVATE void
+HG_PRIVATE hg_return_t
 hg_core_completion_add(struct hg_core_context *core_context,
     struct hg_completion_entry *hg_completion_entry, hg_bool_t loopback_notify);
 
@@ -113,6 +145,19 @@ hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
 HG_PRIVATE void
 hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool);
 
+/**
+ * Create bulk registration cache that keeps up to max_size bytes registered.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_reg_cache_create(
+    hg_size_t max_size, struct hg_bulk_reg_cache **hg_bulk_reg_cache_p);
+
+/**
+ * Destroy bulk registration cache and release remaining registrations.
+ */
+HG_PRIVATE void
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache);
+
 #ifdef __cplusplus
 }
 #endif
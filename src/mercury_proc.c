@@ -337,6 +337,73 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_proc_bytes_ptr(hg_proc_t proc, void **data, hg_size_t data_size)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(proc, proc == HG_PROC_NULL, error, ret,
+        HG_INVALID_ARG, "Proc is not initialized");
+
+    switch (hg_proc->op) {
+        case HG_ENCODE:
+            if (data_size == 0)
+                break;
+            ret = hg_proc_bytes(proc, *data, data_size);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                proc, error, ret, "Could not encode bytes");
+            break;
+        case HG_DECODE:
+            if (data_size == 0) {
+                *data = NULL;
+                break;
+            }
+#ifndef HG_HAS_XDR
+            if (hg_proc->flags & HG_PROC_ZERO_COPY) {
+                /* Data must be contiguous within the current buffer */
+                HG_CHECK_SUBSYS_ERROR(proc,
+                    hg_proc->current_buf->size_left < data_size, error, ret,
+                    HG_OVERFLOW, "Not enough data left to decode (%" PRIu64
+                    " < %" PRIu64 ")", hg_proc->current_buf->size_left,
+                    data_size);
+                *data = hg_proc->current_buf->buf_ptr;
+                HG_PROC_UPDATE(proc, data_size);
+                HG_PROC_CHECKSUM_UPDATE(proc, *data, data_size);
+                break;
+            }
+#endif
+            *data = malloc(data_size);
+            HG_CHECK_SUBSYS_ERROR(proc, *data == NULL, error, ret, HG_NOMEM,
+                "Could not allocate %" PRIu64 " bytes", data_size);
+            ret = hg_proc_bytes(proc, *data, data_size);
+            if (ret != HG_SUCCESS) {
+                free(*data);
+                *data = NULL;
+                HG_GOTO_SUBSYS_ERROR(
+                    proc, error, ret, ret, "Could not decode bytes");
+            }
+            break;
+        case HG_FREE:
+#ifndef HG_HAS_XDR
+            /* Borrowed data is released along with the proc buffer */
+            if (!(hg_proc->flags & HG_PROC_ZERO_COPY))
+#endif
+                free(*data);
+            *data = NULL;
+            break;
+        default:
+            HG_GOTO_SUBSYS_ERROR(
+                proc, error, ret, HG_INVALID_ARG, "Invalid proc op");
+    }
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 hg_proc_set_extra_buf_is_mine(hg_proc_t proc, hg_bool_t theirs)
@@ -50,6 +50,7 @@ typedef enum { HG_CRC16, HG_CRC32, HG_CRC64, HG_NOHASH } hg_proc_hash_t;
  */
 #define HG_PROC_SM         (1 << 0)
 #define HG_PROC_BULK_EAGER (1 << 1)
+#define HG_PROC_ZERO_COPY  (1 << 2)
 
 /* Branch predictor hints */
 #ifndef _WIN32
@@ -548,6 +549,25 @@ hg_proc_hg_uint64_t(hg_proc_t proc, void *data);
 static HG_INLINE hg_return_t
 hg_proc_bytes(hg_proc_t proc, void *data, hg_size_t data_size);
 
+/**
+ * Generic processing routine for encoding stream of bytes referenced by
+ * pointer. When decoding, the pointer is set to a newly allocated buffer
+ * or, if the HG_PROC_ZERO_COPY flag is set, to the location of the data
+ * within the proc buffer. In that case, the data is borrowed and remains
+ * valid only until the proc buffer is released (e.g., HG_Free_input()).
+ * Memory is released when HG_FREE is used.
+ *
+ * \remark HG_PROC_ZERO_COPY is ignored when XDR encoding is used.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param data [IN/OUT]         pointer to data pointer
+ * \param data_size [IN]        data size
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+hg_proc_bytes_ptr(hg_proc_t proc, void **data, hg_size_t data_size);
+
 /**
  * For convenience map stdint types to hg types
  */
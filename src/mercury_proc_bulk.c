@@ -56,16 +56,23 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
                 flags |= HG_BULK_SM;
 #endif
 
-            /* Try to make everything fit in an eager buffer */
+            /* Try to make everything fit in an eager buffer if data is below
+             * the eager size limit */
             if (hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER) {
+                hg_size_t eager_size_max =
+                    hg_bulk_get_eager_size_max(*bulk_ptr);
+
                 HG_LOG_DEBUG("Proc size left is %" PRIu64 " bytes",
                     hg_proc_get_size_left(proc));
-                buf_size = HG_Bulk_get_serialize_size(
-                    *bulk_ptr, HG_BULK_EAGER | flags);
-
-                if (hg_proc_get_size_left(proc) >=
-                    (buf_size + sizeof(hg_uint64_t)))
-                    try_eager = HG_TRUE;
+                if (eager_size_max == 0 ||
+                    HG_Bulk_get_size(*bulk_ptr) <= eager_size_max) {
+                    buf_size = HG_Bulk_get_serialize_size(
+                        *bulk_ptr, HG_BULK_EAGER | flags);
+
+                    if (hg_proc_get_size_left(proc) >=
+                        (buf_size + sizeof(hg_uint64_t)))
+                        try_eager = HG_TRUE;
+                }
             }
             if (try_eager) {
                 HG_LOG_DEBUG("HG_BULK_EAGER flag set");
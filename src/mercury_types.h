@@ -46,6 +46,28 @@ struct hg_bulk_attr {
     hg_uint64_t device;     /*!< Optional device ID */
 };
 
+/**
+ * Bulk registration cache stats (see HG_Bulk_reg_cache_get_stats()).
+ */
+struct hg_bulk_reg_cache_stats {
+    hg_uint64_t hit_count;   /*!< Registrations re-used */
+    hg_uint64_t miss_count;  /*!< Registrations not found in cache */
+    hg_uint64_t evict_count; /*!< Registrations evicted or invalidated */
+    hg_size_t size;          /*!< Memory currently registered by cache */
+    hg_uint32_t entry_count; /*!< Registrations currently cached */
+};
+
+/**
+ * Bulk transfer descriptor (see HG_Bulk_transfer_list()).
+ */
+struct hg_bulk_transfer_desc {
+    hg_bulk_t origin_handle; /*!< Origin bulk handle */
+    hg_size_t origin_offset; /*!< Offset in origin handle */
+    hg_bulk_t local_handle;  /*!< Local bulk handle */
+    hg_size_t local_offset;  /*!< Offset in local handle */
+    hg_size_t size;          /*!< Size of data to transfer */
+};
+
 /**
  * Bulk transfer operators.
  */
@@ -72,6 +94,7 @@ struct hg_cb_info_bulk {
     hg_bulk_t local_handle;  /* HG Bulk local handle */
     hg_bulk_op_t op;         /* Operation type */
     hg_size_t size;          /* Total size transferred */
+    hg_uint32_t checksum;    /* CRC32C of data (if bulk_checksum is set) */
 };
 
 struct hg_cb_info {
@@ -76,18 +76,45 @@
 /* Size of shared-memory buffer */
 #define NA_SM_COPY_BUF_SIZE NA_SM_PAGE_SIZE
 
+/* Copy buffers are split into size classes of 4KB, 16KB and 64KB */
+#define NA_SM_COPY_BUF_CLASSES     3
+#define NA_SM_COPY_BUF_SIZE_MEDIUM (NA_SM_COPY_BUF_SIZE << 2)
+#define NA_SM_COPY_BUF_SIZE_MAX    (NA_SM_COPY_BUF_SIZE << 4)
+#define NA_SM_NUM_BUFS_MEDIUM      32
+#define NA_SM_NUM_BUFS_MAX         8
+#define NA_SM_COPY_BUF_ARENA_SIZE                                              \
+    (NA_SM_NUM_BUFS * NA_SM_COPY_BUF_SIZE +                                    \
+        NA_SM_NUM_BUFS_MEDIUM * NA_SM_COPY_BUF_SIZE_MEDIUM +                   \
+        NA_SM_NUM_BUFS_MAX * NA_SM_COPY_BUF_SIZE_MAX)
+
+/* Buffer index encodes size class (upper 2 bits) and buffer (lower 6 bits) */
+#define NA_SM_BUF_IDX(c, i)  (((c) << 6) | (i))
+#define NA_SM_BUF_CLASS(idx) ((idx) >> 6)
+#define NA_SM_BUF_NUM(idx)   ((idx) & 0x3f)
+
 /* Max number of fds used for cleanup */
 #define NA_SM_CLEANUP_NFDS 16
 
-/* Max number of peers */
-#define NA_SM_MAX_PEERS (NA_CONTEXT_ID_MAX + 1)
+/* Default and max number of peers (queue pairs) of a region, the default
+ * can be overridden through the NA_SM_MAX_PEERS environment variable */
+#define NA_SM_MAX_PEERS_DEFAULT (NA_CONTEXT_ID_MAX + 1)
+#define NA_SM_MAX_PEERS_LIMIT   (4096)
+
+/* Size of cmd queue, each peer may have both a reserve and a release cmd in
+ * flight and one entry of the ring is always left empty */
+#define NA_SM_CMD_QUEUE_SIZE (NA_SM_MAX_PEERS_LIMIT * 4)
+
+/* Size of region for a given number of queue pairs */
+#define NA_SM_REGION_SIZE(pair_max)                                            \
+    (sizeof(struct na_sm_region) +                                             \
+        (size_t) (pair_max) * sizeof(struct na_sm_queue_pair))
 
 /* Addr status bits */
 #define NA_SM_ADDR_RESERVED   (1 << 0)
 #define NA_SM_ADDR_CMD_PUSHED (1 << 1)
 #define NA_SM_ADDR_RESOLVED   (1 << 2)
 
-/* Msg sizes */
+/* Default msg sizes (can be raised up to NA_SM_COPY_BUF_SIZE_MAX) */
 #define NA_SM_UNEXPECTED_SIZE NA_SM_COPY_BUF_SIZE
 #define NA_SM_EXPECTED_SIZE   NA_SM_UNEXPECTED_SIZE
 
@@ -100,6 +127,20 @@
 /* Max events */
 #define NA_SM_MAX_EVENTS 16
 
+/* Size of multi-recv completion ring (must be a power of 2) */
+#define NA_SM_OP_MULTI_CQ_SIZE (256)
+
+/* Alignment of messages received into multi-recv buffers */
+#define NA_SM_MULTI_RECV_ALIGN (8)
+
+/* Number of buckets in expected op table (must be a power of 2) */
+#define NA_SM_OP_TABLE_SIZE (1024)
+
+/* Number of unexpected msg entries per slab chunk, payloads up to the inline
+ * size are copied into the entry's slot */
+#define NA_SM_UNEXPECTED_SLAB_COUNT (64)
+#define NA_SM_UNEXPECTED_INLINE_SIZE NA_SM_COPY_BUF_SIZE
+
 /* Op ID status bits */
 #define NA_SM_OP_COMPLETED (1 << 0)
 #define NA_SM_OP_RETRYING  (1 << 1)
@@ -137,6 +178,23 @@
         hg_atomic_set32(&__op->status, 0);                                     \
     } while (0)
 
+#define NA_SM_OP_RESET_MULTI_RECV(__op, __context, __cb, __arg)                \
+    do {                                                                       \
+        __op->context = __context;                                             \
+        __op->completion_data.callback_info.type =                             \
+            NA_CB_MULTI_RECV_UNEXPECTED;                                       \
+        __op->completion_data.callback = __cb;                                 \
+        __op->completion_data.callback_info.arg = __arg;                       \
+        __op->completion_data.callback_info.info.multi_recv_unexpected =       \
+            (struct na_cb_info_multi_recv_unexpected){.actual_buf_size = 0,    \
+                .source = NULL,                                                \
+                .tag = 0,                                                      \
+                .actual_buf = NULL,                                            \
+                .last = false};                                                \
+        __op->addr = NULL;                                                     \
+        hg_atomic_set32(&__op->status, 0);                                     \
+    } while (0)
+
 #define NA_SM_OP_RELEASE(__op)                                                 \
     do {                                                                       \
         if (__op->addr)                                                        \
@@ -156,6 +214,11 @@
 #define NA_SM_PRINT_SHM_NAME(str, size, uri)                                   \
     snprintf(str, size, NA_SM_SHM_PREFIX "-%s", uri)
 
+/* Generate SHM file name of exported memory */
+#define NA_SM_PRINT_MEM_SHM_NAME(str, size, addr_key, mem_id)                  \
+    snprintf(str, size, NA_SM_SHM_PREFIX "-%d-%" PRIu8 "-m%" PRIu32,          \
+        addr_key.pid, addr_key.id, mem_id)
+
 /* Generate socket path */
 #define NA_SM_PRINT_SOCK_PATH(str, size, uri)                                  \
     snprintf(str, size, NA_SM_TMP_DIRECTORY "/" NA_SM_SHM_PREFIX "-%s", uri);
@@ -179,9 +242,9 @@
 NA_PACKED(union na_sm_msg_hdr {
     struct {
         unsigned int tag : 32;      /* Message tag : UINT MAX */
-        unsigned int buf_size : 16; /* Buffer length: 4KB MAX */
-        unsigned int buf_idx : 8;   /* Index reserved: 64 MAX */
-        unsigned int type : 8;      /* Message type */
+        unsigned int buf_size : 20; /* Buffer length: 1MB MAX */
+        unsigned int buf_idx : 8;   /* Index reserved: 4 x 64 MAX */
+        unsigned int type : 4;      /* Message type */
     } hdr;
     uint64_t val;
 });
@@ -192,16 +255,20 @@ union na_sm_cacheline_atomic_int64 {
     char pad[NA_SM_CACHE_LINE_SIZE];
 };
 
-union na_sm_cacheline_atomic_int256 {
-    hg_atomic_int64_t val[4];
-    char pad[NA_SM_CACHE_LINE_SIZE];
+/* Msg buffer size class */
+struct na_sm_copy_buf_class {
+    size_t size;        /* Size of buffers */
+    size_t offset;      /* Offset of first buffer in arena */
+    unsigned int count; /* Number of buffers (64 max) */
 };
 
-/* Msg buffers (page aligned) */
+/* Msg buffers (page aligned arena of size-classed buffers) */
 struct na_sm_copy_buf {
-    hg_thread_spin_t buf_locks[NA_SM_NUM_BUFS];    /* Locks on buffers */
-    char buf[NA_SM_NUM_BUFS][NA_SM_COPY_BUF_SIZE]; /* Array of buffers */
-    union na_sm_cacheline_atomic_int64 available;  /* Available bitmask */
+    hg_thread_spin_t buf_locks[NA_SM_COPY_BUF_CLASSES]
+                              [NA_SM_NUM_BUFS]; /* Locks on buffers */
+    char buf[NA_SM_COPY_BUF_ARENA_SIZE];        /* Buffer arena */
+    union na_sm_cacheline_atomic_int64
+        available[NA_SM_COPY_BUF_CLASSES]; /* Available bitmasks */
 };
 
 /* Msg queue (allocate queue's flexible array member statically) */
@@ -215,6 +282,7 @@ struct na_sm_msg_queue {
     hg_atomic_int32_t cons_tail;
     unsigned int cons_size;
     unsigned int cons_mask;
+    hg_atomic_int32_t cons_wait; /* Consumer waits for a notification */
     NA_ALIGNED(hg_atomic_int64_t ring[NA_SM_NUM_BUFS], HG_MEM_CACHE_LINE_SIZE);
 };
 
@@ -230,11 +298,10 @@ enum na_sm_cmd { NA_SM_RESERVED = 1, NA_SM_RELEASED };
 /* Cmd header */
 NA_PACKED(union na_sm_cmd_hdr {
     struct {
-        unsigned int pid : 32;     /* PID */
-        unsigned int id : 8;       /* ID */
-        unsigned int pair_idx : 8; /* Index reserved */
-        unsigned int type : 8;     /* Cmd type */
-        unsigned int pad : 8;      /* 8 bits left */
+        unsigned int pid : 32;      /* PID */
+        unsigned int id : 8;        /* ID */
+        unsigned int pair_idx : 16; /* Index reserved */
+        unsigned int type : 8;      /* Cmd type */
     } hdr;
     uint64_t val;
 });
@@ -250,9 +317,8 @@ struct na_sm_cmd_queue {
     hg_atomic_int32_t cons_tail;
     unsigned int cons_size;
     unsigned int cons_mask;
-    /* To be safe, make the queue twice as large */
-    NA_ALIGNED(
-        hg_atomic_int64_t ring[NA_SM_MAX_PEERS * 2], HG_MEM_CACHE_LINE_SIZE);
+    NA_ALIGNED(hg_atomic_int64_t ring[NA_SM_CMD_QUEUE_SIZE],
+        HG_MEM_CACHE_LINE_SIZE);
 };
 
 /* Address key */
@@ -261,14 +327,17 @@ struct na_sm_addr_key {
     uint8_t id; /* SM ID */
 };
 
-/* Shared region */
+/* Shared region (queue pairs are only touched once reserved) */
 struct na_sm_region {
-    struct na_sm_addr_key addr_key;  /* Region IDs */
-    struct na_sm_copy_buf copy_bufs; /* Pool of msg buffers */
-    NA_ALIGNED(struct na_sm_queue_pair queue_pairs[NA_SM_MAX_PEERS],
-        NA_SM_PAGE_SIZE);                          /* Msg queue pairs */
-    struct na_sm_cmd_queue cmd_queue;              /* Cmd queue */
-    union na_sm_cacheline_atomic_int256 available; /* Available pairs */
+    struct na_sm_addr_key addr_key;   /* Region IDs */
+    size_t size;                      /* Size of region */
+    unsigned int pair_max;            /* Number of queue pairs */
+    struct na_sm_copy_buf copy_bufs;  /* Pool of msg buffers */
+    struct na_sm_cmd_queue cmd_queue; /* Cmd queue */
+    NA_ALIGNED(hg_atomic_int64_t available[NA_SM_MAX_PEERS_LIMIT / 64],
+        NA_SM_CACHE_LINE_SIZE); /* Available pairs */
+    NA_ALIGNED(struct na_sm_queue_pair queue_pairs[],
+        NA_SM_PAGE_SIZE); /* Msg queue pairs */
 };
 
 /* Poll type */
@@ -278,9 +347,19 @@ enum na_sm_poll_type {
     NA_SM_POLL_TX_NOTIFY
 };
 
+/* Peer memory mapped locally */
+struct na_sm_mem_map {
+    HG_LIST_ENTRY(na_sm_mem_map) entry; /* Entry in map list */
+    char *base;                         /* Local address of mapping */
+    size_t size;                        /* Size of mapping */
+    uint32_t id;                        /* Export ID */
+};
+
 /* Address */
 struct na_sm_addr {
     hg_thread_mutex_t resolve_lock;     /* Lock to resolve address */
+    hg_thread_mutex_t map_lock;         /* Lock on mapped peer memory */
+    HG_LIST_HEAD(na_sm_mem_map) maps;   /* Mapped peer memory */
     HG_LIST_ENTRY(na_sm_addr) entry;    /* Entry in poll list */
     struct na_sm_addr_key addr_key;     /* Address key */
     struct na_sm_endpoint *endpoint;    /* Endpoint */
@@ -294,7 +373,7 @@ struct na_sm_addr {
     enum na_sm_poll_type rx_poll_type;  /* Rx poll type */
     hg_atomic_int32_t refcount;         /* Ref count */
     hg_atomic_int32_t status;           /* Status bits */
-    uint8_t queue_pair_idx;             /* Shared queue pair index */
+    uint16_t queue_pair_idx;            /* Shared queue pair index */
     bool unexpected;                    /* Unexpected address */
 };
 
@@ -314,6 +393,9 @@ struct na_sm_map {
 struct na_sm_mem_desc_info {
     unsigned long iovcnt; /* Segment count */
     size_t len;           /* Size of region */
+    uint64_t map_base;    /* Base address of exported memory */
+    uint64_t map_size;    /* Size of exported memory */
+    uint32_t map_id;      /* Export ID (0 if memory is not exported) */
     uint8_t flags;        /* Flag of operation access */
 };
 
@@ -339,19 +421,57 @@ struct na_sm_msg_info {
     na_tag_t tag;
 };
 
+/* Multi-recv info */
+struct na_sm_multi_recv_info {
+    void *buf;                  /* Multi-recv buffer            */
+    size_t buf_size;            /* Multi-recv buffer size       */
+    size_t offset;              /* Offset of next message       */
+    hg_atomic_int32_t overflow; /* Messages left in msg queue   */
+};
+
+/* Ring-buffer of multi-recv completions */
+struct na_sm_completion_multi {
+    struct na_cb_completion_data *data;
+    hg_atomic_int32_t head;
+    hg_atomic_int32_t tail;
+    int32_t mask;
+    uint32_t size;
+};
+
 /* Unexpected msg info */
 struct na_sm_unexpected_info {
     HG_QUEUE_ENTRY(na_sm_unexpected_info) entry;
     struct na_sm_addr *na_sm_addr;
     void *buf;
+    void *inline_buf; /* Preallocated payload slot */
     size_t buf_size;
     na_tag_t tag;
 };
 
+/* Chunk of unexpected msg entries and of their payload slots */
+struct na_sm_unexpected_chunk {
+    NA_ALIGNED(struct na_sm_unexpected_info
+                   infos[NA_SM_UNEXPECTED_SLAB_COUNT],
+        NA_SM_CACHE_LINE_SIZE);
+    NA_ALIGNED(char bufs[NA_SM_UNEXPECTED_SLAB_COUNT]
+                        [NA_SM_UNEXPECTED_INLINE_SIZE],
+        NA_SM_PAGE_SIZE);
+    struct na_sm_unexpected_chunk *next;
+};
+
+/* Slab of unexpected msg entries */
+struct na_sm_unexpected_slab {
+    HG_QUEUE_HEAD(na_sm_unexpected_info) free_list; /* Free entries */
+    struct na_sm_unexpected_chunk *chunks;          /* Allocated chunks */
+    hg_atomic_int64_t *overflow_count;              /* Number of grows */
+    hg_thread_spin_t lock;                          /* Free list lock */
+};
+
 /* Unexpected msg queue */
 struct na_sm_unexpected_msg_queue {
     HG_QUEUE_HEAD(na_sm_unexpected_info) queue;
     hg_thread_spin_t lock;
+    struct na_sm_unexpected_slab slab;
 };
 
 /* RMA op */
@@ -362,14 +482,17 @@ typedef na_return_t (*na_sm_process_vm_op_t)(pid_t pid,
 /* Operation ID */
 struct na_sm_op_id {
     struct na_cb_completion_data completion_data; /* Completion data */
+    struct na_sm_completion_multi completion_multi; /* Multi completions */
     union {
         struct na_sm_msg_info msg;
+        struct na_sm_multi_recv_info multi_recv;
     } info;                            /* Op info                  */
     HG_QUEUE_ENTRY(na_sm_op_id) entry; /* Entry in queue           */
     na_class_t *na_class;              /* NA class associated      */
     na_context_t *context;             /* NA context associated    */
     struct na_sm_addr *addr;           /* Address associated       */
     hg_atomic_int32_t status;          /* Operation status         */
+    bool multi_event;                  /* Triggers multiple events */
 };
 
 /* Op ID queue */
@@ -378,13 +501,20 @@ struct na_sm_op_queue {
     hg_thread_spin_t lock;
 };
 
+/* Op ID table, expected op IDs are hashed on (source addr, tag) */
+struct na_sm_op_table {
+    HG_QUEUE_HEAD(na_sm_op_id) buckets[NA_SM_OP_TABLE_SIZE];
+    hg_thread_spin_t lock;
+    size_t count; /* Number of op IDs in table */
+};
+
 /* Endpoint */
 struct na_sm_endpoint {
-    struct na_sm_map addr_map; /* Address map */
+    struct na_sm_map addr_map;                 /* Address map */
     struct na_sm_unexpected_msg_queue
         unexpected_msg_queue;                  /* Unexpected msg queue */
     struct na_sm_op_queue unexpected_op_queue; /* Unexpected op queue */
-    struct na_sm_op_queue expected_op_queue;   /* Expected op queue */
+    struct na_sm_op_table expected_op_table;   /* Expected op table */
     struct na_sm_op_queue retry_op_queue;      /* Retry op queue */
     struct na_sm_addr_list poll_addr_list;     /* List of addresses to poll */
     struct na_sm_addr *source_addr;            /* Source addr */
@@ -393,9 +523,26 @@ struct na_sm_endpoint {
     enum na_sm_poll_type sock_poll_type;       /* Sock poll type */
     hg_atomic_int32_t nofile;                  /* Number of opened fds */
     uint32_t nofile_max;                       /* Max number of fds */
+    hg_atomic_int64_t *notify_count;           /* Notifications sent to peers */
+    hg_atomic_int64_t *notify_skip_count;      /* Notifications not needed */
     bool listen;                               /* Listen on sock */
 };
 
+/* Memory exported to peers (see NA_SM_Mem_alloc()) */
+struct na_sm_mem_export {
+    HG_LIST_ENTRY(na_sm_mem_export) entry; /* Entry in export list */
+    void *base;                            /* Base address */
+    size_t size;                           /* Size of mapping */
+    uint32_t id;                           /* Export ID */
+};
+
+/* Export list */
+struct na_sm_mem_export_list {
+    HG_LIST_HEAD(na_sm_mem_export) list;
+    hg_thread_spin_t lock;
+    uint32_t id_next; /* Next export ID */
+};
+
 /* Private context */
 struct na_sm_context {
     struct hg_poll_event events[NA_SM_MAX_EVENTS];
@@ -403,9 +550,12 @@ struct na_sm_context {
 
 /* Private data */
 struct na_sm_class {
-    struct na_sm_endpoint endpoint; /* Endpoint */
-    size_t iov_max;                 /* Max number of IOVs */
-    uint8_t context_max;            /* Max number of contexts */
+    struct na_sm_endpoint endpoint;           /* Endpoint */
+    struct na_sm_mem_export_list mem_exports; /* Exported memory */
+    size_t unexpected_size_max;               /* Max unexpected size */
+    size_t expected_size_max;                 /* Max expected size */
+    size_t iov_max;                           /* Max number of IOVs */
+    uint8_t context_max;                      /* Max number of contexts */
 };
 
 /********************/
@@ -471,6 +621,14 @@ na_sm_msg_queue_pop(
 static NA_INLINE bool
 na_sm_msg_queue_is_empty(struct na_sm_msg_queue *na_sm_queue);
 
+/**
+ * Check whether the consumer must be notified after a push. Consumers ask for
+ * a notification before waiting, the first producer that sees the request
+ * clears it so that notifications are coalesced.
+ */
+static NA_INLINE bool
+na_sm_msg_queue_must_notify(struct na_sm_msg_queue *na_sm_queue);
+
 /**
  * Initialize queue.
  */
@@ -514,7 +672,8 @@ na_sm_string_to_addr(
  * Open shared-memory region.
  */
 static na_return_t
-na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p);
+na_sm_region_open(const char *uri, bool create, unsigned int pair_max,
+    struct na_sm_region **region_p);
 
 /**
  * Close shared-memory region.
@@ -564,13 +723,13 @@ na_sm_sock_path_cleanup(
  */
 static na_return_t
 na_sm_event_create(
-    const char *uri, uint8_t pair_index, unsigned char pair, int *event);
+    const char *uri, uint16_t pair_index, unsigned char pair, int *event);
 
 /**
  * Destroy event.
  */
 static na_return_t
-na_sm_event_destroy(const char *uri, uint8_t pair_index, unsigned char pair,
+na_sm_event_destroy(const char *uri, uint16_t pair_index, unsigned char pair,
     bool remove, int event);
 
 /**
@@ -602,7 +761,7 @@ na_sm_poll_deregister(hg_poll_set_t *poll_set, int fd);
  */
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
-    bool listen, bool no_wait, uint32_t nofile_max);
+    bool listen, bool no_wait, uint32_t nofile_max, unsigned int pair_max);
 
 /**
  * Close shared-memory endpoint.
@@ -614,13 +773,13 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint);
  * Reserve queue pair.
  */
 static na_return_t
-na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, uint8_t *index);
+na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, uint16_t *index);
 
 /**
  * Release queue pair.
  */
 static NA_INLINE void
-na_sm_queue_pair_release(struct na_sm_region *na_sm_region, uint8_t index);
+na_sm_queue_pair_release(struct na_sm_region *na_sm_region, uint16_t index);
 
 /**
  * Lookup addr key from map.
@@ -715,10 +874,26 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
     na_tag_t tag);
 
 /**
- * Reserve shared buffer.
+ * Reserve shared buffer of at least buf_size bytes. Buffers are taken from
+ * the smallest size class that fits, larger classes are used if it is
+ * exhausted.
  */
 static NA_INLINE na_return_t
-na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index);
+na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, size_t buf_size,
+    unsigned int *index);
+
+/**
+ * Reserve buffer from size class.
+ */
+static NA_INLINE bool
+na_sm_buf_reserve_class(
+    struct na_sm_copy_buf *na_sm_copy_buf, unsigned int c, unsigned int *i);
+
+/**
+ * Get pointer to shared buffer.
+ */
+static NA_INLINE char *
+na_sm_buf_ptr(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index);
 
 /**
  * Release shared buffer.
@@ -791,6 +966,37 @@ na_sm_process_vm_readv(pid_t pid, const struct iovec *local_iov,
     unsigned long liovcnt, const struct iovec *remote_iov,
     unsigned long riovcnt, size_t length);
 
+/**
+ * Copy between local IOVs and exported peer memory mapped locally.
+ */
+static na_return_t
+na_sm_rma_mapped(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_desc_info *remote_info, bool put,
+    const struct iovec *liov, unsigned long liovcnt, const struct iovec *riov,
+    unsigned long riovcnt, size_t length);
+
+/**
+ * Get local mapping of exported peer memory (mapped on first use). Fails if
+ * the descriptor does not match the size of an existing mapping.
+ */
+static na_return_t
+na_sm_mem_map_get(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_desc_info *remote_info, char **base_p,
+    size_t *size_p);
+
+/**
+ * Unmap peer memory mapped through address.
+ */
+static void
+na_sm_mem_maps_release(struct na_sm_addr *na_sm_addr);
+
+/**
+ * Fill export info of memory handle if all its segments are exported.
+ */
+static void
+na_sm_mem_handle_set_export(struct na_sm_mem_export_list *mem_exports,
+    struct na_sm_mem_handle *na_sm_mem_handle);
+
 /**
  * Poll waiting for timeout milliseconds.
  */
@@ -804,6 +1010,20 @@ na_sm_poll_wait(na_context_t *context, struct na_sm_endpoint *na_sm_endpoint,
 static na_return_t
 na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, bool *progressed_ptr);
 
+/**
+ * Poll rx queues without waiting.
+ */
+static na_return_t
+na_sm_poll_rx_queues(
+    struct na_sm_endpoint *na_sm_endpoint, bool *progressed_ptr);
+
+/**
+ * Request notifications from peers before waiting. Return true if all rx
+ * queues are empty and it is safe to wait.
+ */
+static bool
+na_sm_poll_park(struct na_sm_endpoint *na_sm_endpoint);
+
 /**
  * Progress on endpoint sock.
  */
@@ -851,11 +1071,106 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr,
     struct na_sm_unexpected_msg_queue *unexpected_msg_queue);
 
+/**
+ * Initialize slab of unexpected msg entries.
+ */
+static na_return_t
+na_sm_unexpected_slab_init(struct na_sm_unexpected_slab *slab);
+
+/**
+ * Free slab of unexpected msg entries.
+ */
+static void
+na_sm_unexpected_slab_destroy(struct na_sm_unexpected_slab *slab);
+
+/**
+ * Add a new chunk of entries to the slab (must be called with slab lock).
+ */
+static na_return_t
+na_sm_unexpected_slab_grow(struct na_sm_unexpected_slab *slab);
+
+/**
+ * Get unexpected msg entry that can hold buf_size bytes.
+ */
+static struct na_sm_unexpected_info *
+na_sm_unexpected_info_alloc(
+    struct na_sm_unexpected_slab *slab, size_t buf_size);
+
+/**
+ * Release unexpected msg entry.
+ */
+static void
+na_sm_unexpected_info_free(struct na_sm_unexpected_slab *slab,
+    struct na_sm_unexpected_info *na_sm_unexpected_info);
+
+/**
+ * Reserve space for a message of size buf_size in a multi-recv buffer.
+ * Returns NA_AGAIN if the completion ring is full. Returns NA_MSGSIZE if the
+ * message does not fit, in which case the buffer is retired and the reserved
+ * completion entry must be used to report the error.
+ * Must be called with the unexpected op queue lock held.
+ */
+static na_return_t
+na_sm_multi_recv_reserve(struct na_sm_op_id *na_sm_op_id, size_t buf_size,
+    struct na_cb_completion_data **completion_data_p, void **buf_p,
+    bool *last_p);
+
+/**
+ * Complete one event of a multi-recv operation.
+ */
+static void
+na_sm_multi_recv_complete(struct na_sm_op_id *na_sm_op_id,
+    struct na_cb_completion_data *completion_data, na_return_t cb_ret,
+    void *buf, size_t buf_size, struct na_sm_addr *source, na_tag_t tag,
+    bool last);
+
+/**
+ * Move messages from the unexpected msg queue into a multi-recv buffer.
+ * Returns true if at least one message was consumed.
+ */
+static bool
+na_sm_multi_recv_drain(
+    struct na_sm_endpoint *na_sm_endpoint, struct na_sm_op_id *na_sm_op_id);
+
+/**
+ * Hash (source addr, tag) pair into expected op table bucket index.
+ */
+static NA_INLINE unsigned int
+na_sm_op_table_hash(struct na_sm_addr *na_sm_addr, na_tag_t tag);
+
+/**
+ * Init expected op table.
+ */
+static void
+na_sm_op_table_init(struct na_sm_op_table *op_table);
+
+/**
+ * Insert op ID into expected op table.
+ */
+static void
+na_sm_op_table_push(
+    struct na_sm_op_table *op_table, struct na_sm_op_id *na_sm_op_id);
+
+/**
+ * Remove and return first op ID matching (source addr, tag).
+ */
+static struct na_sm_op_id *
+na_sm_op_table_match(struct na_sm_op_table *op_table,
+    struct na_sm_addr *na_sm_addr, na_tag_t tag);
+
+/**
+ * Remove op ID from expected op table if still queued and mark it canceled.
+ * Returns true if the op ID was removed.
+ */
+static bool
+na_sm_op_table_cancel(
+    struct na_sm_op_table *op_table, struct na_sm_op_id *na_sm_op_id);
+
 /**
  * Process expected messages.
  */
 static na_return_t
-na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
+na_sm_process_expected(struct na_sm_op_table *expected_op_table,
     struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr);
 
 /**
@@ -889,6 +1204,37 @@ na_sm_complete_signal(struct na_sm_class *na_sm_class);
 static NA_INLINE void
 na_sm_release(void *arg);
 
+/**
+ * Release one multi-recv completion entry.
+ */
+static void
+na_sm_release_multi(void *arg);
+
+/**
+ * Init ring-buffer to hold multi-recv completions.
+ */
+static na_return_t
+na_sm_completion_multi_init(
+    struct na_sm_completion_multi *completion_multi, uint32_t size);
+
+/**
+ * Destroy ring-buffer to hold multi-recv completions.
+ */
+static void
+na_sm_completion_multi_destroy(struct na_sm_completion_multi *completion_multi);
+
+/**
+ * Reserve entry to hold completion data.
+ */
+static struct na_cb_completion_data *
+na_sm_completion_multi_push(struct na_sm_completion_multi *completion_multi);
+
+/**
+ * Release last entry from ring-buffer.
+ */
+static void
+na_sm_completion_multi_pop(struct na_sm_completion_multi *completion_multi);
+
 /* check_protocol */
 static bool
 na_sm_check_protocol(const char *protocol_name);
@@ -902,6 +1248,10 @@ na_sm_initialize(
 static na_return_t
 na_sm_finalize(na_class_t *na_class);
 
+/* has_opt_feature */
+static bool
+na_sm_has_opt_feature(na_class_t *na_class, unsigned long flags);
+
 /* context_create */
 static na_return_t
 na_sm_context_create(na_class_t *na_class, void **context_p, uint8_t id);
@@ -990,6 +1340,12 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
     na_cb_t callback, void *arg, void *buf, size_t buf_size, void *plugin_data,
     na_op_id_t *op_id);
 
+/* msg_multi_recv_unexpected */
+static na_return_t
+na_sm_msg_multi_recv_unexpected(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, void *buf, size_t buf_size, void *plugin_data,
+    na_op_id_t *op_id);
+
 /* msg_send_expected */
 static na_return_t
 na_sm_msg_send_expected(na_class_t *na_class, na_context_t *context,
@@ -1082,7 +1438,7 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
     na_sm_initialize,                  /* initialize */
     na_sm_finalize,                    /* finalize */
     na_sm_cleanup,                     /* cleanup */
-    NULL,                              /* has_opt_feature */
+    na_sm_has_opt_feature,             /* has_opt_feature */
     na_sm_context_create,              /* context_create */
     na_sm_context_destroy,             /* context_destroy */
     na_sm_op_create,                   /* op_create */
@@ -1108,7 +1464,7 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
     NULL,                              /* msg_init_unexpected */
     na_sm_msg_send_unexpected,         /* msg_send_unexpected */
     na_sm_msg_recv_unexpected,         /* msg_recv_unexpected */
-    NULL,                              /* msg_multi_recv_unexpected */
+    na_sm_msg_multi_recv_unexpected,   /* msg_multi_recv_unexpected */
     NULL,                              /* msg_init_expected */
     na_sm_msg_send_expected,           /* msg_send_expected */
     na_sm_msg_recv_expected,           /* msg_recv_expected */
@@ -1133,6 +1489,18 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
     na_sm_cancel                         /* cancel */
 };
 
+/* Copy buffer size classes, ordered by increasing size */
+static const struct na_sm_copy_buf_class
+    na_sm_copy_buf_classes_g[NA_SM_COPY_BUF_CLASSES] = {
+        {.size = NA_SM_COPY_BUF_SIZE, .offset = 0, .count = NA_SM_NUM_BUFS},
+        {.size = NA_SM_COPY_BUF_SIZE_MEDIUM,
+            .offset = NA_SM_NUM_BUFS * NA_SM_COPY_BUF_SIZE,
+            .count = NA_SM_NUM_BUFS_MEDIUM},
+        {.size = NA_SM_COPY_BUF_SIZE_MAX,
+            .offset = NA_SM_NUM_BUFS * NA_SM_COPY_BUF_SIZE +
+                      NA_SM_NUM_BUFS_MEDIUM * NA_SM_COPY_BUF_SIZE_MEDIUM,
+            .count = NA_SM_NUM_BUFS_MAX}};
+
 /********************/
 /* Plugin callbacks */
 /********************/
@@ -1254,6 +1622,101 @@ NA_SM_Host_id_cmp(na_sm_id_t id1, na_sm_id_t id2)
 #endif
 }
 
+/*---------------------------------------------------------------------------*/
+void *
+NA_SM_Mem_alloc(na_class_t *na_class, size_t size)
+{
+    struct na_sm_mem_export_list *mem_exports;
+    struct na_sm_mem_export *mem_export = NULL;
+    char filename[NA_SM_MAX_FILENAME];
+    size_t page_size = (size_t) hg_mem_get_page_size();
+    int rc;
+
+    NA_CHECK_SUBSYS_ERROR_NORET(mem,
+        na_class == NULL || na_class->ops != &NA_PLUGIN_OPS(sm), error,
+        "Not an SM class");
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, size == 0, error, "NULL size");
+    mem_exports = &NA_SM_CLASS(na_class)->mem_exports;
+
+    mem_export = (struct na_sm_mem_export *) malloc(sizeof(*mem_export));
+    NA_CHECK_SUBSYS_ERROR_NORET(
+        mem, mem_export == NULL, error, "Could not allocate mem export");
+    mem_export->size = (size + page_size - 1) / page_size * page_size;
+
+    hg_thread_spin_lock(&mem_exports->lock);
+    mem_export->id = mem_exports->id_next++;
+    hg_thread_spin_unlock(&mem_exports->lock);
+
+    /* Export IDs are never reused so that peers can cache mappings */
+    rc = NA_SM_PRINT_MEM_SHM_NAME(filename, NA_SM_MAX_FILENAME,
+        NA_SM_CLASS(na_class)->endpoint.source_addr->addr_key, mem_export->id);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, rc < 0 || rc > NA_SM_MAX_FILENAME, error,
+        "NA_SM_PRINT_MEM_SHM_NAME() failed, rc: %d", rc);
+
+    NA_LOG_SUBSYS_DEBUG(mem, "shm_map() %s", filename);
+    mem_export->base = na_sm_shm_map(filename, mem_export->size, true);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, mem_export->base == NULL, error,
+        "Could not map new SM memory (%s)", filename);
+
+    hg_thread_spin_lock(&mem_exports->lock);
+    HG_LIST_INSERT_HEAD(&mem_exports->list, mem_export, entry);
+    hg_thread_spin_unlock(&mem_exports->lock);
+
+    return mem_export->base;
+
+error:
+    free(mem_export);
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+NA_SM_Mem_free(na_class_t *na_class, void *buf)
+{
+    struct na_sm_mem_export_list *mem_exports;
+    struct na_sm_mem_export *mem_export;
+    char filename[NA_SM_MAX_FILENAME];
+    na_return_t na_ret;
+    int rc;
+
+    if (buf == NULL)
+        return;
+
+    NA_CHECK_SUBSYS_ERROR_NORET(mem,
+        na_class == NULL || na_class->ops != &NA_PLUGIN_OPS(sm), done,
+        "Not an SM class");
+    mem_exports = &NA_SM_CLASS(na_class)->mem_exports;
+
+    hg_thread_spin_lock(&mem_exports->lock);
+    HG_LIST_FOREACH (mem_export, &mem_exports->list, entry) {
+        if (mem_export->base == buf) {
+            HG_LIST_REMOVE(mem_export, entry);
+            break;
+        }
+    }
+    hg_thread_spin_unlock(&mem_exports->lock);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, mem_export == NULL, done,
+        "Buffer %p was not allocated with NA_SM_Mem_alloc()", buf);
+
+    rc = NA_SM_PRINT_MEM_SHM_NAME(filename, NA_SM_MAX_FILENAME,
+        NA_SM_CLASS(na_class)->endpoint.source_addr->addr_key, mem_export->id);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, rc < 0 || rc > NA_SM_MAX_FILENAME,
+        release, "NA_SM_PRINT_MEM_SHM_NAME() failed, rc: %d", rc);
+
+    /* Peers keep their mapping until their address gets freed */
+    NA_LOG_SUBSYS_DEBUG(mem, "shm_unmap() %s", filename);
+    na_ret = na_sm_shm_unmap(filename, mem_export->base, mem_export->size);
+    NA_CHECK_SUBSYS_ERROR_DONE(
+        mem, na_ret != NA_SUCCESS, "Could not unmap SM memory");
+
+release:
+    free(mem_export);
+
+done:
+    return;
+}
+
 #ifdef NA_SM_HAS_CMA
 /*---------------------------------------------------------------------------*/
 static int
@@ -1405,6 +1868,7 @@ na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue)
     hg_atomic_init32(&na_sm_queue->cons_head, 0);
     hg_atomic_init32(&na_sm_queue->prod_tail, 0);
     hg_atomic_init32(&na_sm_queue->cons_tail, 0);
+    hg_atomic_init32(&na_sm_queue->cons_wait, 0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1484,11 +1948,22 @@ na_sm_msg_queue_is_empty(struct na_sm_msg_queue *na_sm_queue)
             hg_atomic_get32(&na_sm_queue->prod_tail));
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE bool
+na_sm_msg_queue_must_notify(struct na_sm_msg_queue *na_sm_queue)
+{
+    /* Order push before reading the wait flag (pairs with na_sm_poll_park()) */
+    hg_atomic_fence();
+
+    return hg_atomic_get32(&na_sm_queue->cons_wait) &&
+           hg_atomic_cas32(&na_sm_queue->cons_wait, 1, 0);
+}
+
 /*---------------------------------------------------------------------------*/
 static void
 na_sm_cmd_queue_init(struct na_sm_cmd_queue *na_sm_queue)
 {
-    unsigned int count = NA_SM_MAX_PEERS * 2;
+    unsigned int count = NA_SM_CMD_QUEUE_SIZE;
 
     na_sm_queue->prod_size = na_sm_queue->cons_size = count;
     na_sm_queue->prod_mask = na_sm_queue->cons_mask = count - 1;
@@ -1616,10 +2091,13 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p)
+na_sm_region_open(const char *uri, bool create, unsigned int pair_max,
+    struct na_sm_region **region_p)
 {
     char filename[NA_SM_MAX_FILENAME];
     struct na_sm_region *na_sm_region = NULL;
+    size_t size = (create) ? NA_SM_REGION_SIZE(pair_max)
+                           : sizeof(struct na_sm_region);
     na_return_t ret = NA_SUCCESS;
     int rc;
 
@@ -1630,31 +2108,67 @@ na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p)
 
     /* Open SHM object */
     NA_LOG_SUBSYS_DEBUG(cls, "shm_map() %s", filename);
-    na_sm_region = (struct na_sm_region *) na_sm_shm_map(
-        filename, sizeof(struct na_sm_region), create);
+    na_sm_region =
+        (struct na_sm_region *) na_sm_shm_map(filename, size, create);
     NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
         "Could not map new SM region (%s)", filename);
 
+    if (!create) {
+        unsigned int region_pair_max = na_sm_region->pair_max;
+        size_t region_size = na_sm_region->size;
+
+        /* Header is written by the peer, validate it before using it */
+        if (region_pair_max > NA_SM_MAX_PEERS_LIMIT ||
+            region_size != NA_SM_REGION_SIZE(region_pair_max)) {
+            (void) na_sm_shm_unmap(NULL, na_sm_region, size);
+            NA_GOTO_SUBSYS_ERROR(cls, done, ret, NA_PROTOCOL_ERROR,
+                "Invalid SM region header (%s, pair_max=%u, size=%zu)",
+                filename, region_pair_max, region_size);
+        }
+        size = region_size;
+    }
+
+    if (!create && size > sizeof(struct na_sm_region)) {
+        /* Remap with the number of queue pairs that the region was created
+         * with */
+        ret = na_sm_shm_unmap(NULL, na_sm_region, sizeof(struct na_sm_region));
+        NA_CHECK_SUBSYS_NA_ERROR(cls, done, ret, "Could not unmap SM region");
+
+        na_sm_region =
+            (struct na_sm_region *) na_sm_shm_map(filename, size, false);
+        NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
+            "Could not map SM region (%s)", filename);
+    }
+
     if (create) {
-        int i;
+        unsigned int i;
+
+        na_sm_region->size = size;
+        na_sm_region->pair_max = pair_max;
+
+        /* Initialize copy buf (all buffers are available by default), pages
+         * of the arena are left untouched until buffers get used */
+        for (i = 0; i < NA_SM_COPY_BUF_CLASSES; i++) {
+            unsigned int count = na_sm_copy_buf_classes_g[i].count, j;
 
-        /* Initialize copy buf (all buffers are available by default) */
-        hg_atomic_init64(
-            &na_sm_region->copy_bufs.available.val, ~((int64_t) 0));
-        memset(&na_sm_region->copy_bufs.buf, 0,
-            sizeof(na_sm_region->copy_bufs.buf));
+            hg_atomic_init64(&na_sm_region->copy_bufs.available[i].val,
+                (count < 64) ? (int64_t) ((UINT64_C(1) << count) - 1)
+                             : ~((int64_t) 0));
 
-        /* Initialize locks */
-        for (i = 0; i < NA_SM_NUM_BUFS; i++)
-            hg_thread_spin_init(&na_sm_region->copy_bufs.buf_locks[i]);
+            /* Initialize locks */
+            for (j = 0; j < count; j++)
+                hg_thread_spin_init(
+                    &na_sm_region->copy_bufs.buf_locks[i][j]);
+        }
 
-        /* Initialize queue pairs */
-        for (i = 0; i < 4; i++)
-            hg_atomic_init64(&na_sm_region->available.val[i], ~((int64_t) 0));
+        /* Mark queue pairs as available, queue pairs get initialized when
+         * they are reserved so that their pages are only touched when used */
+        for (i = 0; i < NA_SM_MAX_PEERS_LIMIT / 64; i++) {
+            unsigned int count = (pair_max > i * 64) ? pair_max - i * 64 : 0;
 
-        for (i = 0; i < NA_SM_MAX_PEERS; i++) {
-            na_sm_msg_queue_init(&na_sm_region->queue_pairs[i].rx_queue);
-            na_sm_msg_queue_init(&na_sm_region->queue_pairs[i].tx_queue);
+            hg_atomic_init64(&na_sm_region->available[i],
+                (count < 64) ? (int64_t) ((UINT64_C(1) << count) - 1)
+                             : ~((int64_t) 0));
         }
 
         /* Initialize command queue */
@@ -1685,7 +2199,7 @@ na_sm_region_close(const char *uri, struct na_sm_region *region)
 
     NA_LOG_SUBSYS_DEBUG(
         cls, "shm_unmap() %s", (filename_p == NULL) ? "is NULL" : filename_p);
-    ret = na_sm_shm_unmap(filename_p, region, sizeof(struct na_sm_region));
+    ret = na_sm_shm_unmap(filename_p, region, region->size);
     NA_CHECK_SUBSYS_NA_ERROR(cls, done, ret, "Could not unmap SM region (%s)",
         (filename_p == NULL) ? "is NULL" : filename_p);
 
@@ -1922,7 +2436,7 @@ na_sm_sock_path_cleanup(const char *fpath, const struct stat NA_UNUSED *sb,
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_event_create(const char NA_UNUSED *uri, uint8_t NA_UNUSED pair_index,
+na_sm_event_create(const char NA_UNUSED *uri, uint16_t NA_UNUSED pair_index,
     unsigned char NA_UNUSED pair, int *event)
 {
     na_return_t ret = NA_SUCCESS;
@@ -1982,7 +2496,7 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_event_destroy(const char NA_UNUSED *uri, uint8_t NA_UNUSED pair_index,
+na_sm_event_destroy(const char NA_UNUSED *uri, uint16_t NA_UNUSED pair_index,
     unsigned char NA_UNUSED pair, bool NA_UNUSED remove, int event)
 {
     na_return_t ret = NA_SUCCESS;
@@ -2107,13 +2621,13 @@ done:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
-    bool listen, bool no_wait, uint32_t nofile_max)
+    bool listen, bool no_wait, uint32_t nofile_max, unsigned int pair_max)
 {
     static hg_atomic_int32_t sm_id_g = HG_ATOMIC_VAR_INIT(0);
     struct na_sm_addr_key addr_key = {0, 0};
     struct na_sm_region *shared_region = NULL;
     char uri[NA_SM_MAX_FILENAME], *uri_p = NULL;
-    uint8_t queue_pair_idx = 0;
+    uint16_t queue_pair_idx = 0;
     bool queue_pair_reserved = false, sock_registered = false,
          tx_notify_registered = false;
     int tx_notify = -1, rx_notify = -1;
@@ -2130,18 +2644,27 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
     /* Save listen state */
     na_sm_endpoint->listen = listen;
 
+    /* Notification counters */
+    HG_LOG_ADD_COUNTER64(na, &na_sm_endpoint->notify_skip_count,
+        "sm_notify_skip_count", "SM notifications coalesced");
+    HG_LOG_ADD_COUNTER64(na, &na_sm_endpoint->notify_count,
+        "sm_notify_count", "SM notifications sent");
+
     NA_LOG_SUBSYS_DEBUG(cls, "Opening new endpoint for PID=%d, ID=%u",
         addr_key.pid, addr_key.id);
 
     /* Initialize queues */
     HG_QUEUE_INIT(&na_sm_endpoint->unexpected_msg_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->unexpected_msg_queue.lock);
+    ret = na_sm_unexpected_slab_init(
+        &na_sm_endpoint->unexpected_msg_queue.slab);
+    NA_CHECK_SUBSYS_NA_ERROR(
+        cls, error, ret, "Could not allocate unexpected msg slab");
 
     HG_QUEUE_INIT(&na_sm_endpoint->unexpected_op_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->unexpected_op_queue.lock);
 
-    HG_QUEUE_INIT(&na_sm_endpoint->expected_op_queue.queue);
-    hg_thread_spin_init(&na_sm_endpoint->expected_op_queue.lock);
+    na_sm_op_table_init(&na_sm_endpoint->expected_op_table);
 
     HG_QUEUE_INIT(&na_sm_endpoint->retry_op_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->retry_op_queue.lock);
@@ -2185,7 +2708,7 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
         uri_p = uri;
 
         /* If we're listening, create a new shm region using URI */
-        ret = na_sm_region_open(uri_p, true, &shared_region);
+        ret = na_sm_region_open(uri_p, true, pair_max, &shared_region);
         NA_CHECK_SUBSYS_NA_ERROR(
             cls, error, ret, "Could not open shared-memory region");
 
@@ -2331,8 +2854,9 @@ error:
     }
 
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_msg_queue.lock);
+    na_sm_unexpected_slab_destroy(&na_sm_endpoint->unexpected_msg_queue.slab);
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
-    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_table.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
 
@@ -2379,10 +2903,10 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint)
     NA_CHECK_SUBSYS_ERROR(cls, empty == false, done, ret, NA_BUSY,
         "Unexpected op queue should be empty");
 
-    /* Check that expected op queue is empty */
-    empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->expected_op_queue.queue);
+    /* Check that expected op table is empty */
+    empty = (na_sm_endpoint->expected_op_table.count == 0);
     NA_CHECK_SUBSYS_ERROR(cls, empty == false, done, ret, NA_BUSY,
-        "Expected op queue should be empty");
+        "Expected op table should be empty");
 
     /* Check that retry op queue is empty */
     empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->retry_op_queue.queue);
@@ -2467,8 +2991,9 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint)
 
     /* Destroy mutexes */
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_msg_queue.lock);
+    na_sm_unexpected_slab_destroy(&na_sm_endpoint->unexpected_msg_queue.slab);
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
-    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_table.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
 
@@ -2478,17 +3003,19 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, uint8_t *index)
+na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, uint16_t *index)
 {
-    unsigned int j = 0;
+    /* Pair count is shared with peers, never scan past the available mask */
+    unsigned int pair_max =
+        MIN(na_sm_region->pair_max, NA_SM_MAX_PEERS_LIMIT);
+    unsigned int j = 0, words = (pair_max + 63) / 64;
 
     do {
         int64_t bits = (int64_t) 1;
         unsigned int i = 0;
 
         do {
-            int64_t available =
-                hg_atomic_get64(&na_sm_region->available.val[j]);
+            int64_t available = hg_atomic_get64(&na_sm_region->available[j]);
             if (!available) {
                 j++;
                 break;
@@ -2502,33 +3029,40 @@ na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, uint8_t *index)
                 continue;
             }
 
-            if (hg_atomic_cas64(&na_sm_region->available.val[j], available,
+            if (hg_atomic_cas64(&na_sm_region->available[j], available,
                     available & ~bits)) {
+                struct na_sm_queue_pair *queue_pair;
 #ifdef NA_HAS_DEBUG
                 char buf[65] = {'\0'};
-                available = hg_atomic_get64(&na_sm_region->available.val[j]);
+                available = hg_atomic_get64(&na_sm_region->available[j]);
                 NA_LOG_SUBSYS_DEBUG(addr,
                     "Reserved pair index %u\n### Available: %s", (i + (j * 64)),
                     lltoa((uint64_t) available, buf, 2));
 #endif
-                *index = (uint8_t) (i + (j * 64));
+                *index = (uint16_t) (i + (j * 64));
+
+                /* Owner of the pair initializes it before advertising it */
+                queue_pair = &na_sm_region->queue_pairs[*index];
+                na_sm_msg_queue_init(&queue_pair->rx_queue);
+                na_sm_msg_queue_init(&queue_pair->tx_queue);
+
                 return NA_SUCCESS;
             }
 
             /* Can't use atomic XOR directly, if there is a race and the cas
              * fails, we should be able to pick the next one available */
         } while (i < 64);
-    } while (j < 4);
+    } while (j < words);
 
     return NA_AGAIN;
 }
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE void
-na_sm_queue_pair_release(struct na_sm_region *na_sm_region, uint8_t index)
+na_sm_queue_pair_release(struct na_sm_region *na_sm_region, uint16_t index)
 {
     hg_atomic_or64(
-        &na_sm_region->available.val[index / 64], (int64_t) 1 << index % 64);
+        &na_sm_region->available[index / 64], (int64_t) 1 << index % 64);
     NA_LOG_SUBSYS_DEBUG(addr, "Released pair index %u", index);
 }
 
@@ -2635,6 +3169,8 @@ na_sm_addr_create(struct na_sm_endpoint *na_sm_endpoint, const char *uri,
     hg_atomic_init32(&na_sm_addr->refcount, 1);
     hg_atomic_init32(&na_sm_addr->status, 0);
     hg_thread_mutex_init(&na_sm_addr->resolve_lock);
+    hg_thread_mutex_init(&na_sm_addr->map_lock);
+    HG_LIST_INIT(&na_sm_addr->maps);
 
     /* Keep a copy of the URI to open SHM/sock paths */
     if (uri) {
@@ -2675,7 +3211,11 @@ na_sm_addr_destroy(struct na_sm_addr *na_sm_addr)
             &na_sm_addr->endpoint->addr_map, &na_sm_addr->addr_key);
     }
 
+    /* Release cached mappings of peer memory */
+    na_sm_mem_maps_release(na_sm_addr);
+
     hg_thread_mutex_destroy(&na_sm_addr->resolve_lock);
+    hg_thread_mutex_destroy(&na_sm_addr->map_lock);
     free(na_sm_addr->uri);
     free(na_sm_addr);
 }
@@ -2729,7 +3269,7 @@ na_sm_addr_resolve(struct na_sm_addr *na_sm_addr)
     /* Open shm region */
     if (!na_sm_addr->shared_region) {
         ret = na_sm_region_open(
-            na_sm_addr->uri, false, &na_sm_addr->shared_region);
+            na_sm_addr->uri, false, 0, &na_sm_addr->shared_region);
         NA_CHECK_SUBSYS_NA_ERROR(
             addr, error, ret, "Could not open shared-memory region");
     }
@@ -2755,7 +3295,7 @@ na_sm_addr_resolve(struct na_sm_addr *na_sm_addr)
     cmd_hdr = (union na_sm_cmd_hdr){.hdr.type = NA_SM_RESERVED,
         .hdr.pid = (unsigned int) na_sm_endpoint->source_addr->addr_key.pid,
         .hdr.id = na_sm_endpoint->source_addr->addr_key.id & 0xff,
-        .hdr.pair_idx = na_sm_addr->queue_pair_idx & 0xff};
+        .hdr.pair_idx = na_sm_addr->queue_pair_idx & 0xffff};
 
     NA_LOG_SUBSYS_DEBUG(addr, "Pushing cmd with %d for %d/%u/%u val=%" PRIu64,
         cmd_hdr.hdr.type, cmd_hdr.hdr.pid, cmd_hdr.hdr.id, cmd_hdr.hdr.pair_idx,
@@ -2876,7 +3416,7 @@ na_sm_addr_release(struct na_sm_addr *na_sm_addr)
         cmd_hdr = (union na_sm_cmd_hdr){.hdr.type = NA_SM_RELEASED,
             .hdr.pid = (unsigned int) na_sm_endpoint->source_addr->addr_key.pid,
             .hdr.id = na_sm_endpoint->source_addr->addr_key.id & 0xff,
-            .hdr.pair_idx = na_sm_addr->queue_pair_idx & 0xff};
+            .hdr.pair_idx = na_sm_addr->queue_pair_idx & 0xffff};
 
         if (na_sm_endpoint->poll_set) {
             /* Send events to remote process (silence error as this is best
@@ -2992,7 +3532,9 @@ na_sm_addr_event_send(int sock, const char *dest_name,
 
     nsend = sendmsg(sock, &msg, 0);
     if (!ignore_error) {
-        if (unlikely(nsend == -1 && errno == ETOOMANYREFS))
+        /* Sock buffer of remote may be full when many peers connect */
+        if (unlikely(nsend == -1 &&
+                     (errno == ETOOMANYREFS || errno == EAGAIN)))
             ret = NA_AGAIN;
         else
             NA_CHECK_SUBSYS_ERROR(addr, nsend == -1, done, ret,
@@ -3076,8 +3618,11 @@ na_sm_msg_send(struct na_sm_class *na_sm_class, na_context_t *context,
 {
     na_return_t ret;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_COPY_BUF_SIZE, error, ret,
-        NA_OVERFLOW, "Exceeds copy buf size, %zu", buf_size);
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size > ((cb_type == NA_CB_SEND_UNEXPECTED)
+                           ? na_sm_class->unexpected_size_max
+                           : na_sm_class->expected_size_max),
+        error, ret, NA_OVERFLOW, "Exceeds msg size, %zu", buf_size);
 
     /* Check op_id */
     NA_CHECK_SUBSYS_ERROR(op, na_sm_op_id == NULL, error, ret, NA_INVALID_ARG,
@@ -3143,8 +3688,8 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
     /* No need to reserve for 0-size messages */
     if (buf_size > 0) {
         /* Try to reserve buffer atomically */
-        ret =
-            na_sm_buf_reserve(&na_sm_addr->shared_region->copy_bufs, &buf_idx);
+        ret = na_sm_buf_reserve(
+            &na_sm_addr->shared_region->copy_bufs, buf_size, &buf_idx);
         if (unlikely(ret == NA_AGAIN))
             return NA_AGAIN;
 
@@ -3156,23 +3701,35 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
     /* Post message to queue */
     msg_hdr = (union na_sm_msg_hdr){.hdr.type = cb_type,
         .hdr.buf_idx = buf_idx & 0xff,
-        .hdr.buf_size = buf_size & 0xffff,
+        .hdr.buf_size = buf_size & 0xfffff,
         .hdr.tag = tag};
 
+    /* Full queue is not an error, op gets pushed to retry queue */
     rc = na_sm_msg_queue_push(na_sm_addr->tx_queue, &msg_hdr);
-    NA_CHECK_SUBSYS_ERROR(
-        msg, rc == false, release, ret, NA_AGAIN, "Full queue");
+    if (unlikely(rc == false)) {
+        ret = NA_AGAIN;
+        goto release;
+    }
 
-    /* Notify remote if notifications are enabled */
+    /* Notify remote if notifications are enabled and remote is waiting */
     if (na_sm_addr == na_sm_endpoint->source_addr &&
         na_sm_addr->rx_notify > 0) {
-        int rc1 = hg_event_set(na_sm_addr->rx_notify);
-        NA_CHECK_SUBSYS_ERROR(msg, rc1 != HG_UTIL_SUCCESS, release, ret,
-            na_sm_errno_to_na(errno), "Could not send completion notification");
+        if (na_sm_msg_queue_must_notify(na_sm_addr->tx_queue)) {
+            int rc1 = hg_event_set(na_sm_addr->rx_notify);
+            NA_CHECK_SUBSYS_ERROR(msg, rc1 != HG_UTIL_SUCCESS, release, ret,
+                na_sm_errno_to_na(errno),
+                "Could not send completion notification");
+            hg_atomic_incr64(na_sm_endpoint->notify_count);
+        } else
+            hg_atomic_incr64(na_sm_endpoint->notify_skip_count);
     } else if (na_sm_addr->tx_notify > 0) {
-        ret = na_sm_event_set(na_sm_addr->tx_notify);
-        NA_CHECK_SUBSYS_NA_ERROR(
-            msg, release, ret, "Could not send completion notification");
+        if (na_sm_msg_queue_must_notify(na_sm_addr->tx_queue)) {
+            ret = na_sm_event_set(na_sm_addr->tx_notify);
+            NA_CHECK_SUBSYS_NA_ERROR(
+                msg, release, ret, "Could not send completion notification");
+            hg_atomic_incr64(na_sm_endpoint->notify_count);
+        } else
+            hg_atomic_incr64(na_sm_endpoint->notify_skip_count);
     }
 
     return NA_SUCCESS;
@@ -3187,13 +3744,35 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE na_return_t
-na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
+na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, size_t buf_size,
+    unsigned int *index)
+{
+    unsigned int c, i;
+
+    for (c = 0; c < NA_SM_COPY_BUF_CLASSES; c++) {
+        if (buf_size > na_sm_copy_buf_classes_g[c].size)
+            continue;
+        if (na_sm_buf_reserve_class(na_sm_copy_buf, c, &i)) {
+            *index = NA_SM_BUF_IDX(c, i);
+            return NA_SUCCESS;
+        }
+    }
+
+    return NA_AGAIN;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE bool
+na_sm_buf_reserve_class(
+    struct na_sm_copy_buf *na_sm_copy_buf, unsigned int c, unsigned int *i)
 {
+    hg_atomic_int64_t *available_p = &na_sm_copy_buf->available[c].val;
+    unsigned int count = na_sm_copy_buf_classes_g[c].count;
     int64_t bits = (int64_t) 1;
-    unsigned int i = 0;
+    unsigned int j = 0;
 
     do {
-        int64_t available = hg_atomic_get64(&na_sm_copy_buf->available.val);
+        int64_t available = hg_atomic_get64(available_p);
         if (!available) {
             /* Nothing available */
             break;
@@ -3201,35 +3780,48 @@ na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
         if ((available & bits) != bits) {
             /* Already reserved */
             hg_atomic_fence();
-            i++;
+            j++;
             bits <<= 1;
             continue;
         }
 
-        if (hg_atomic_cas64(
-                &na_sm_copy_buf->available.val, available, available & ~bits)) {
+        if (hg_atomic_cas64(available_p, available, available & ~bits)) {
 #ifdef NA_HAS_DEBUG
             char buf[65] = {'\0'};
-            available = hg_atomic_get64(&na_sm_copy_buf->available.val);
-            NA_LOG_SUBSYS_DEBUG(msg, "Reserved bit index %u\n### Available: %s",
-                i, lltoa((uint64_t) available, buf, 2));
+            available = hg_atomic_get64(available_p);
+            NA_LOG_SUBSYS_DEBUG(msg,
+                "Reserved bit index %u (class %u)\n### Available: %s", j, c,
+                lltoa((uint64_t) available, buf, 2));
 #endif
-            *index = i;
-            return NA_SUCCESS;
+            *i = j;
+            return true;
         }
         /* Can't use atomic XOR directly, if there is a race and the cas
          * fails, we should be able to pick the next one available */
-    } while (i < NA_SM_NUM_BUFS);
+    } while (j < count);
 
-    return NA_AGAIN;
+    return false;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE char *
+na_sm_buf_ptr(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index)
+{
+    const struct na_sm_copy_buf_class *buf_class =
+        &na_sm_copy_buf_classes_g[NA_SM_BUF_CLASS(index)];
+
+    return na_sm_copy_buf->buf + buf_class->offset +
+           buf_class->size * NA_SM_BUF_NUM(index);
 }
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE void
 na_sm_buf_release(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index)
 {
-    hg_atomic_or64(&na_sm_copy_buf->available.val, (int64_t) 1 << index);
-    NA_LOG_SUBSYS_DEBUG(msg, "Released bit index %u", index);
+    hg_atomic_or64(&na_sm_copy_buf->available[NA_SM_BUF_CLASS(index)].val,
+        (int64_t) 1 << NA_SM_BUF_NUM(index));
+    NA_LOG_SUBSYS_DEBUG(msg, "Released bit index %u (class %u)",
+        NA_SM_BUF_NUM(index), NA_SM_BUF_CLASS(index));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3237,9 +3829,12 @@ static NA_INLINE void
 na_sm_buf_copy_to(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     const void *src, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(na_sm_copy_buf->buf[index], src, n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    hg_thread_spin_t *lock = &na_sm_copy_buf->buf_locks[NA_SM_BUF_CLASS(
+        index)][NA_SM_BUF_NUM(index)];
+
+    hg_thread_spin_lock(lock);
+    memcpy(na_sm_buf_ptr(na_sm_copy_buf, index), src, n);
+    hg_thread_spin_unlock(lock);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3247,9 +3842,12 @@ static NA_INLINE void
 na_sm_buf_copy_from(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     void *dest, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(dest, na_sm_copy_buf->buf[index], n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    hg_thread_spin_t *lock = &na_sm_copy_buf->buf_locks[NA_SM_BUF_CLASS(
+        index)][NA_SM_BUF_NUM(index)];
+
+    hg_thread_spin_lock(lock);
+    memcpy(dest, na_sm_buf_ptr(na_sm_copy_buf, index), n);
+    hg_thread_spin_unlock(lock);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3274,7 +3872,7 @@ na_sm_rma(struct na_sm_class *na_sm_class, na_context_t *context,
     na_return_t ret;
 
 #if !defined(NA_SM_HAS_CMA) && !defined(__APPLE__)
-    NA_GOTO_SUBSYS_ERROR(
+    NA_CHECK_SUBSYS_ERROR(rma, na_sm_mem_handle_remote->info.map_id == 0,
         error, ret, NA_OPNOTSUPPORTED, "Not implemented for this platform");
 #endif
 
@@ -3359,9 +3957,17 @@ na_sm_rma(struct na_sm_class *na_sm_class, na_context_t *context,
     NA_LOG_SUBSYS_DEBUG(rma, "Posting rma op (op id=%p)", (void *) na_sm_op_id);
 
     /* NB. addr does not need to be fully "resolved" to issue RMA */
-    ret = process_vm_op(
-        na_sm_addr->addr_key.pid, liov, liovcnt, riov, riovcnt, length);
-    NA_CHECK_SUBSYS_NA_ERROR(rma, release, ret, "process_vm_op() failed");
+    if (na_sm_mem_handle_remote->info.map_id != 0) {
+        /* Exported memory is copied directly once mapped */
+        ret = na_sm_rma_mapped(na_sm_addr, &na_sm_mem_handle_remote->info,
+            cb_type == NA_CB_PUT, liov, liovcnt, riov, riovcnt, length);
+        NA_CHECK_SUBSYS_NA_ERROR(
+            rma, release, ret, "na_sm_rma_mapped() failed");
+    } else {
+        ret = process_vm_op(
+            na_sm_addr->addr_key.pid, liov, liovcnt, riov, riovcnt, length);
+        NA_CHECK_SUBSYS_NA_ERROR(rma, release, ret, "process_vm_op() failed");
+    }
 
     /* Free before adding to completion queue */
     if (liovcnt > NA_SM_IOV_STATIC_MAX &&
@@ -3615,24 +4221,182 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_poll_wait(na_context_t *context, struct na_sm_endpoint *na_sm_endpoint,
-    unsigned int timeout, bool *progressed_ptr)
+na_sm_rma_mapped(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_desc_info *remote_info, bool put,
+    const struct iovec *liov, unsigned long liovcnt, const struct iovec *riov,
+    unsigned long riovcnt, size_t length)
 {
-    struct hg_poll_event *events = NA_SM_CONTEXT(context)->events;
-    unsigned int nevents = 0, i;
-    bool progressed = false;
-    na_return_t ret = NA_SUCCESS;
-    int rc;
+    unsigned long li = 0, ri = 0;
+    size_t loff = 0, roff = 0, map_size;
+    char *map_base;
+    na_return_t ret;
 
-    /* Just wait on a single event, anything greater may increase
-     * latency, and slow down progress, we will not wait next round
-     * if something is still in the queues */
-    rc = hg_poll_wait(
-        na_sm_endpoint->poll_set, timeout, NA_SM_MAX_EVENTS, events, &nevents);
-    NA_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, done, ret,
-        na_sm_errno_to_na(errno), "hg_poll_wait() failed");
+    ret = na_sm_mem_map_get(na_sm_addr, remote_info, &map_base, &map_size);
+    NA_CHECK_SUBSYS_NA_ERROR(rma, error, ret, "Could not map peer memory");
 
-    if (nevents == 1 && (events[0].events & HG_POLLINTR)) {
+    while (length > 0 && li < liovcnt && ri < riovcnt) {
+        size_t n = MIN(length,
+            MIN(liov[li].iov_len - loff, riov[ri].iov_len - roff));
+        uint64_t raddr = (uint64_t) (uintptr_t) riov[ri].iov_base + roff;
+        char *lptr = (char *) liov[li].iov_base + loff, *rptr;
+
+        /* Remote segments must remain within mapped memory */
+        NA_CHECK_SUBSYS_ERROR(rma,
+            raddr < remote_info->map_base || n > map_size ||
+                raddr - remote_info->map_base > map_size - n,
+            error, ret, NA_FAULT, "Remote segment is not within export");
+        rptr = map_base + (raddr - remote_info->map_base);
+
+        if (put)
+            memcpy(rptr, lptr, n);
+        else
+            memcpy(lptr, rptr, n);
+
+        length -= n;
+        loff += n;
+        roff += n;
+        if (loff == liov[li].iov_len) {
+            li++;
+            loff = 0;
+        }
+        if (roff == riov[ri].iov_len) {
+            ri++;
+            roff = 0;
+        }
+    }
+    NA_CHECK_SUBSYS_ERROR(rma, length > 0, error, ret, NA_MSGSIZE,
+        "Could not copy %zu remaining bytes", length);
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_mem_map_get(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_desc_info *remote_info, char **base_p,
+    size_t *size_p)
+{
+    struct na_sm_mem_map *mem_map;
+    na_return_t ret = NA_SUCCESS;
+
+    hg_thread_mutex_lock(&na_sm_addr->map_lock);
+    HG_LIST_FOREACH (mem_map, &na_sm_addr->maps, entry) {
+        if (mem_map->id == remote_info->map_id)
+            break;
+    }
+
+    if (mem_map == NULL) {
+        char filename[NA_SM_MAX_FILENAME];
+        int rc;
+
+        rc = NA_SM_PRINT_MEM_SHM_NAME(filename, NA_SM_MAX_FILENAME,
+            na_sm_addr->addr_key, remote_info->map_id);
+        NA_CHECK_SUBSYS_ERROR(rma, rc < 0 || rc > NA_SM_MAX_FILENAME, unlock,
+            ret, NA_OVERFLOW, "NA_SM_PRINT_MEM_SHM_NAME() failed, rc: %d", rc);
+
+        mem_map = (struct na_sm_mem_map *) malloc(sizeof(*mem_map));
+        NA_CHECK_SUBSYS_ERROR(rma, mem_map == NULL, unlock, ret, NA_NOMEM,
+            "Could not allocate mem map");
+        mem_map->size = (size_t) remote_info->map_size;
+        mem_map->id = remote_info->map_id;
+
+        NA_LOG_SUBSYS_DEBUG(rma, "shm_map() %s", filename);
+        mem_map->base = (char *) na_sm_shm_map(filename, mem_map->size, false);
+        NA_CHECK_SUBSYS_ERROR(rma, mem_map->base == NULL, error, ret, NA_NODEV,
+            "Could not map peer memory (%s)", filename);
+
+        HG_LIST_INSERT_HEAD(&na_sm_addr->maps, mem_map, entry);
+    } else {
+        /* Existing mapping was sized from the first descriptor */
+        NA_CHECK_SUBSYS_ERROR(rma,
+            (size_t) remote_info->map_size != mem_map->size, unlock, ret,
+            NA_FAULT,
+            "Export size (%" PRIu64 ") does not match mapped size (%zu)",
+            remote_info->map_size, mem_map->size);
+    }
+    *base_p = mem_map->base;
+    *size_p = mem_map->size;
+    hg_thread_mutex_unlock(&na_sm_addr->map_lock);
+
+    return NA_SUCCESS;
+
+error:
+    free(mem_map);
+unlock:
+    hg_thread_mutex_unlock(&na_sm_addr->map_lock);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_mem_maps_release(struct na_sm_addr *na_sm_addr)
+{
+    while (!HG_LIST_IS_EMPTY(&na_sm_addr->maps)) {
+        struct na_sm_mem_map *mem_map = HG_LIST_FIRST(&na_sm_addr->maps);
+        na_return_t na_ret;
+
+        HG_LIST_REMOVE(mem_map, entry);
+        na_ret = na_sm_shm_unmap(NULL, mem_map->base, mem_map->size);
+        NA_CHECK_SUBSYS_ERROR_DONE(
+            addr, na_ret != NA_SUCCESS, "Could not unmap peer memory");
+        free(mem_map);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_mem_handle_set_export(struct na_sm_mem_export_list *mem_exports,
+    struct na_sm_mem_handle *na_sm_mem_handle)
+{
+    const struct iovec *iov = NA_SM_IOV(na_sm_mem_handle);
+    unsigned long iovcnt = na_sm_mem_handle->info.iovcnt;
+    struct na_sm_mem_export *mem_export;
+
+    hg_thread_spin_lock(&mem_exports->lock);
+    HG_LIST_FOREACH (mem_export, &mem_exports->list, entry) {
+        const char *base = (const char *) mem_export->base;
+        unsigned long i;
+
+        for (i = 0; i < iovcnt; i++) {
+            const char *seg = (const char *) iov[i].iov_base;
+
+            if (seg < base || seg + iov[i].iov_len > base + mem_export->size)
+                break;
+        }
+        if (i == iovcnt) {
+            na_sm_mem_handle->info.map_base = (uint64_t) (uintptr_t) base;
+            na_sm_mem_handle->info.map_size = (uint64_t) mem_export->size;
+            na_sm_mem_handle->info.map_id = mem_export->id;
+            break;
+        }
+    }
+    hg_thread_spin_unlock(&mem_exports->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_poll_wait(na_context_t *context, struct na_sm_endpoint *na_sm_endpoint,
+    unsigned int timeout, bool *progressed_ptr)
+{
+    struct hg_poll_event *events = NA_SM_CONTEXT(context)->events;
+    unsigned int nevents = 0, i;
+    bool progressed = false;
+    na_return_t ret = NA_SUCCESS;
+    int rc;
+
+    /* Just wait on a single event, anything greater may increase
+     * latency, and slow down progress, we will not wait next round
+     * if something is still in the queues */
+    rc = hg_poll_wait(
+        na_sm_endpoint->poll_set, timeout, NA_SM_MAX_EVENTS, events, &nevents);
+    NA_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, done, ret,
+        na_sm_errno_to_na(errno), "hg_poll_wait() failed");
+
+    if (nevents == 1 && (events[0].events & HG_POLLINTR)) {
         NA_LOG_SUBSYS_DEBUG(poll_loop, "Interrupted");
         *progressed_ptr = false;
         return ret;
@@ -3691,13 +4455,40 @@ done:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, bool *progressed_ptr)
+{
+    bool progressed = false;
+    na_return_t ret;
+
+    /* Check whether something is in one of the rx queues */
+    ret = na_sm_poll_rx_queues(na_sm_endpoint, &progressed);
+    NA_CHECK_SUBSYS_NA_ERROR(poll, done, ret, "Could not poll rx queues");
+
+    /* Look for message in cmd queue (if listening) */
+    if (na_sm_endpoint->source_addr->shared_region) {
+        bool progressed_cmd = false;
+
+        ret = na_sm_progress_cmd_queue(na_sm_endpoint, &progressed_cmd);
+        NA_CHECK_SUBSYS_NA_ERROR(
+            poll, done, ret, "Could not progress cmd queue");
+        progressed |= progressed_cmd;
+    }
+
+    *progressed_ptr = progressed;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_poll_rx_queues(
+    struct na_sm_endpoint *na_sm_endpoint, bool *progressed_ptr)
 {
     struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
     struct na_sm_addr *poll_addr;
     bool progressed = false;
     na_return_t ret = NA_SUCCESS;
 
-    /* Check whether something is in one of the rx queues */
     hg_thread_spin_lock(&poll_addr_list->lock);
     HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
         bool progressed_rx = false;
@@ -3714,22 +4505,40 @@ na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, bool *progressed_ptr)
     }
     hg_thread_spin_unlock(&poll_addr_list->lock);
 
-    /* Look for message in cmd queue (if listening) */
-    if (na_sm_endpoint->source_addr->shared_region) {
-        bool progressed_cmd = false;
-
-        ret = na_sm_progress_cmd_queue(na_sm_endpoint, &progressed_cmd);
-        NA_CHECK_SUBSYS_NA_ERROR(
-            poll, done, ret, "Could not progress cmd queue");
-        progressed |= progressed_cmd;
-    }
-
     *progressed_ptr = progressed;
 
 done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static bool
+na_sm_poll_park(struct na_sm_endpoint *na_sm_endpoint)
+{
+    struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
+    struct na_sm_addr *poll_addr;
+    bool empty = true;
+
+    /* Flags are left set if we do not wait, this only costs peers one
+     * extra notification */
+    hg_thread_spin_lock(&poll_addr_list->lock);
+    HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry)
+        hg_atomic_set32(&poll_addr->rx_queue->cons_wait, 1);
+
+    /* Order flags before reading queues (pairs with must_notify()) */
+    hg_atomic_fence();
+
+    HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
+        if (!na_sm_msg_queue_is_empty(poll_addr->rx_queue)) {
+            empty = false;
+            break;
+        }
+    }
+    hg_thread_spin_unlock(&poll_addr_list->lock);
+
+    return empty;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_progress_sock(struct na_sm_endpoint *na_sm_endpoint, bool *progressed)
@@ -3790,7 +4599,7 @@ na_sm_process_cmd(struct na_sm_endpoint *na_sm_endpoint,
 
     NA_LOG_SUBSYS_DEBUG(addr,
         "Processing cmd with %d from %d/%u/%u val=%" PRIu64, cmd_hdr.hdr.type,
-        cmd_hdr.hdr.pid, cmd_hdr.hdr.id & 0xff, cmd_hdr.hdr.pair_idx & 0xff,
+        cmd_hdr.hdr.pid, cmd_hdr.hdr.id & 0xff, cmd_hdr.hdr.pair_idx & 0xffff,
         cmd_hdr.val);
 
     switch (cmd_hdr.hdr.type) {
@@ -3945,7 +4754,7 @@ na_sm_progress_rx_queue(struct na_sm_endpoint *na_sm_endpoint,
             break;
         case NA_CB_SEND_EXPECTED:
             ret = na_sm_process_expected(
-                &na_sm_endpoint->expected_op_queue, poll_addr, msg_hdr);
+                &na_sm_endpoint->expected_op_table, poll_addr, msg_hdr);
             NA_CHECK_SUBSYS_NA_ERROR(
                 msg, done, ret, "Could not make progress on expected msg");
             break;
@@ -3967,7 +4776,7 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     struct na_sm_unexpected_msg_queue *unexpected_msg_queue)
 {
     struct na_sm_unexpected_info *na_sm_unexpected_info = NULL;
-    struct na_sm_op_id *na_sm_op_id = NULL;
+    struct na_sm_op_id *na_sm_op_id = NULL, *overflow_op_id = NULL;
     na_return_t ret = NA_SUCCESS;
 
     NA_LOG_SUBSYS_DEBUG(msg, "Processing unexpected msg");
@@ -3975,7 +4784,59 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     /* Pop op ID from queue */
     hg_thread_spin_lock(&unexpected_op_queue->lock);
     na_sm_op_id = HG_QUEUE_FIRST(&unexpected_op_queue->queue);
-    if (likely(na_sm_op_id)) {
+    if (likely(na_sm_op_id) && na_sm_op_id->multi_event) {
+        struct na_cb_completion_data *completion_data = NULL;
+        void *buf = NULL;
+        bool last = false;
+        na_return_t cb_ret;
+
+        /* Copy directly into the multi-recv buffer, the lock is kept so that
+         * events are completed in the same order as the buffer is filled.
+         * Messages already waiting for room in the ring go first. */
+        if (unlikely(hg_atomic_get32(&na_sm_op_id->info.multi_recv.overflow)))
+            cb_ret = NA_AGAIN;
+        else
+            cb_ret = na_sm_multi_recv_reserve(na_sm_op_id,
+                (size_t) msg_hdr.hdr.buf_size, &completion_data, &buf, &last);
+        if (likely(cb_ret != NA_AGAIN)) {
+            if (last) {
+                HG_QUEUE_POP_HEAD(&unexpected_op_queue->queue, entry);
+                hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
+            }
+            if (unlikely(cb_ret == NA_MSGSIZE)) {
+                /* Peers may use a larger eager size than what was posted */
+                NA_LOG_SUBSYS_ERROR(msg,
+                    "Unexpected msg size (%zu) exceeds space left in "
+                    "multi-recv buffer",
+                    (size_t) msg_hdr.hdr.buf_size);
+                na_sm_buf_release(
+                    &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+                na_sm_multi_recv_complete(na_sm_op_id, completion_data, cb_ret,
+                    NULL, (size_t) msg_hdr.hdr.buf_size, NULL,
+                    (na_tag_t) msg_hdr.hdr.tag, last);
+            } else {
+                if (msg_hdr.hdr.buf_size > 0) {
+                    na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
+                        msg_hdr.hdr.buf_idx, buf, msg_hdr.hdr.buf_size);
+                    na_sm_buf_release(&poll_addr->shared_region->copy_bufs,
+                        msg_hdr.hdr.buf_idx);
+                }
+                na_sm_multi_recv_complete(na_sm_op_id, completion_data, cb_ret,
+                    buf, (size_t) msg_hdr.hdr.buf_size, poll_addr,
+                    (na_tag_t) msg_hdr.hdr.tag, last);
+            }
+            hg_thread_spin_unlock(&unexpected_op_queue->lock);
+
+            return NA_SUCCESS;
+        }
+
+        /* Completion ring is full, keep message in unexpected msg queue
+         * until entries get released. Flag is set under the lock so that
+         * releases either see it or happen before the ring was found full. */
+        hg_atomic_set32(&na_sm_op_id->info.multi_recv.overflow, 1);
+        overflow_op_id = na_sm_op_id;
+        na_sm_op_id = NULL;
+    } else if (likely(na_sm_op_id)) {
         HG_QUEUE_POP_HEAD(&unexpected_op_queue->queue, entry);
         hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
     }
@@ -3990,6 +4851,18 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
                 .source = (na_addr_t *) poll_addr};
         na_sm_addr_ref_incr(poll_addr);
 
+        /* Peers may use a larger eager size than what was posted */
+        if (unlikely((size_t) msg_hdr.hdr.buf_size >
+                     na_sm_op_id->info.msg.buf_size)) {
+            NA_LOG_SUBSYS_ERROR(msg,
+                "Unexpected msg size (%zu) exceeds posted buffer size (%zu)",
+                (size_t) msg_hdr.hdr.buf_size, na_sm_op_id->info.msg.buf_size);
+            na_sm_buf_release(
+                &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+            na_sm_complete(na_sm_op_id, NA_MSGSIZE);
+            goto done;
+        }
+
         if (msg_hdr.hdr.buf_size > 0) {
             /* Copy buffer */
             na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
@@ -4005,9 +4878,9 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
         na_sm_complete(na_sm_op_id, NA_SUCCESS);
     } else {
         /* If no error and message arrived, keep a copy of the struct in
-         * the unexpected message queue (should rarely happen) */
-        na_sm_unexpected_info = (struct na_sm_unexpected_info *) malloc(
-            sizeof(struct na_sm_unexpected_info));
+         * the unexpected message queue (entries come from the slab) */
+        na_sm_unexpected_info = na_sm_unexpected_info_alloc(
+            &unexpected_msg_queue->slab, (size_t) msg_hdr.hdr.buf_size);
         NA_CHECK_SUBSYS_ERROR(msg, na_sm_unexpected_info == NULL, done, ret,
             NA_NOMEM, "Could not allocate unexpected info");
 
@@ -4016,13 +4889,6 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
         na_sm_unexpected_info->tag = (na_tag_t) msg_hdr.hdr.tag;
 
         if (na_sm_unexpected_info->buf_size > 0) {
-            /* Allocate buf */
-            na_sm_unexpected_info->buf =
-                malloc(na_sm_unexpected_info->buf_size);
-            NA_CHECK_SUBSYS_ERROR(msg, na_sm_unexpected_info->buf == NULL,
-                error, ret, NA_NOMEM,
-                "Could not allocate na_sm_unexpected_info buf");
-
             /* Copy buffer */
             na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
                 msg_hdr.hdr.buf_idx, na_sm_unexpected_info->buf,
@@ -4031,8 +4897,7 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
             /* Release buffer */
             na_sm_buf_release(
                 &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
-        } else
-            na_sm_unexpected_info->buf = NULL;
+        }
 
         /* Otherwise push the unexpected message into our unexpected queue so
          * that we can treat it later when a recv_unexpected is posted */
@@ -4040,38 +4905,370 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
         HG_QUEUE_PUSH_TAIL(
             &unexpected_msg_queue->queue, na_sm_unexpected_info, entry);
         hg_thread_spin_unlock(&unexpected_msg_queue->lock);
+
+        /* Multi-recv release drains it once entries are available, unless
+         * entries were released before the message could be queued */
+        if (unlikely(overflow_op_id)) {
+            NA_LOG_SUBSYS_DEBUG(msg,
+                "Multi-recv completion ring is full, queued unexpected msg");
+            if (!hg_atomic_get32(&overflow_op_id->info.multi_recv.overflow))
+                (void) na_sm_multi_recv_drain(
+                    &NA_SM_CLASS(overflow_op_id->na_class)->endpoint,
+                    overflow_op_id);
+        }
     }
 
 done:
     return ret;
+}
 
-error:
-    free(na_sm_unexpected_info);
-    return ret;
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_unexpected_slab_init(struct na_sm_unexpected_slab *slab)
+{
+    HG_QUEUE_INIT(&slab->free_list);
+    slab->chunks = NULL;
+    hg_thread_spin_init(&slab->lock);
+
+    HG_LOG_ADD_COUNTER64(na, &slab->overflow_count,
+        "sm_unexpected_overflow_count", "SM unexpected slab overflows");
+
+    /* Preallocate first chunk, only entry headers get touched */
+    return na_sm_unexpected_slab_grow(slab);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_unexpected_slab_destroy(struct na_sm_unexpected_slab *slab)
+{
+    while (slab->chunks) {
+        struct na_sm_unexpected_chunk *chunk = slab->chunks;
+
+        slab->chunks = chunk->next;
+        hg_mem_aligned_free(chunk);
+    }
+    hg_thread_spin_destroy(&slab->lock);
 }
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
-    struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr)
+na_sm_unexpected_slab_grow(struct na_sm_unexpected_slab *slab)
 {
-    struct na_sm_op_id *na_sm_op_id = NULL;
-    na_return_t ret = NA_SUCCESS;
+    struct na_sm_unexpected_chunk *chunk;
+    unsigned int i;
 
-    NA_LOG_SUBSYS_DEBUG(msg, "Processing expected msg");
+    chunk = (struct na_sm_unexpected_chunk *) hg_mem_aligned_alloc(
+        NA_SM_PAGE_SIZE, sizeof(*chunk));
+    if (chunk == NULL)
+        return NA_NOMEM;
 
-    /* Try to match addr/tag */
-    hg_thread_spin_lock(&expected_op_queue->lock);
-    HG_QUEUE_FOREACH (na_sm_op_id, &expected_op_queue->queue, entry) {
-        if (na_sm_op_id->addr == poll_addr &&
-            na_sm_op_id->info.msg.tag == msg_hdr.hdr.tag) {
+    for (i = 0; i < NA_SM_UNEXPECTED_SLAB_COUNT; i++) {
+        chunk->infos[i].inline_buf = chunk->bufs[i];
+        HG_QUEUE_PUSH_TAIL(&slab->free_list, &chunk->infos[i], entry);
+    }
+    chunk->next = slab->chunks;
+    slab->chunks = chunk;
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct na_sm_unexpected_info *
+na_sm_unexpected_info_alloc(struct na_sm_unexpected_slab *slab, size_t buf_size)
+{
+    struct na_sm_unexpected_info *na_sm_unexpected_info;
+
+    hg_thread_spin_lock(&slab->lock);
+    if (unlikely(HG_QUEUE_IS_EMPTY(&slab->free_list))) {
+        na_return_t na_ret;
+
+        /* Slab only grows when more msgs are pending than it can hold */
+        NA_LOG_SUBSYS_DEBUG(msg, "Unexpected msg slab is full, growing it");
+        hg_atomic_incr64(slab->overflow_count);
+        na_ret = na_sm_unexpected_slab_grow(slab);
+        if (na_ret != NA_SUCCESS) {
+            hg_thread_spin_unlock(&slab->lock);
+            return NULL;
+        }
+    }
+    na_sm_unexpected_info = HG_QUEUE_FIRST(&slab->free_list);
+    HG_QUEUE_POP_HEAD(&slab->free_list, entry);
+    hg_thread_spin_unlock(&slab->lock);
+
+    /* Msgs larger than the inline slot still need their own buffer */
+    if (likely(buf_size <= NA_SM_UNEXPECTED_INLINE_SIZE))
+        na_sm_unexpected_info->buf = na_sm_unexpected_info->inline_buf;
+    else {
+        na_sm_unexpected_info->buf = malloc(buf_size);
+        if (na_sm_unexpected_info->buf == NULL) {
+            na_sm_unexpected_info_free(slab, na_sm_unexpected_info);
+            return NULL;
+        }
+    }
+
+    return na_sm_unexpected_info;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_unexpected_info_free(struct na_sm_unexpected_slab *slab,
+    struct na_sm_unexpected_info *na_sm_unexpected_info)
+{
+    if (na_sm_unexpected_info->buf != na_sm_unexpected_info->inline_buf)
+        free(na_sm_unexpected_info->buf);
+    na_sm_unexpected_info->buf = NULL;
+
+    hg_thread_spin_lock(&slab->lock);
+    HG_QUEUE_PUSH_TAIL(&slab->free_list, na_sm_unexpected_info, entry);
+    hg_thread_spin_unlock(&slab->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_multi_recv_reserve(struct na_sm_op_id *na_sm_op_id, size_t buf_size,
+    struct na_cb_completion_data **completion_data_p, void **buf_p,
+    bool *last_p)
+{
+    struct na_sm_multi_recv_info *multi_recv = &na_sm_op_id->info.multi_recv;
+    size_t offset = multi_recv->offset;
+
+    *completion_data_p =
+        na_sm_completion_multi_push(&na_sm_op_id->completion_multi);
+    if (unlikely(*completion_data_p == NULL))
+        return NA_AGAIN;
+
+    /* Buffer is released as soon as a max size message no longer fits, a
+     * larger message can only come from a peer with a larger eager size */
+    if (unlikely(multi_recv->buf_size - offset < buf_size)) {
+        multi_recv->offset = multi_recv->buf_size;
+        *buf_p = NULL;
+        *last_p = true;
+
+        return NA_MSGSIZE;
+    }
+
+    *buf_p = (char *) multi_recv->buf + offset;
+
+    offset = (offset + buf_size + NA_SM_MULTI_RECV_ALIGN - 1) &
+             ~((size_t) NA_SM_MULTI_RECV_ALIGN - 1);
+    if (offset > multi_recv->buf_size)
+        offset = multi_recv->buf_size;
+    multi_recv->offset = offset;
+
+    *last_p = (multi_recv->buf_size - offset <
+               NA_SM_CLASS(na_sm_op_id->na_class)->unexpected_size_max);
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_multi_recv_complete(struct na_sm_op_id *na_sm_op_id,
+    struct na_cb_completion_data *completion_data, na_return_t cb_ret,
+    void *buf, size_t buf_size, struct na_sm_addr *source, na_tag_t tag,
+    bool last)
+{
+    completion_data->callback_info = (struct na_cb_info){
+        .info.multi_recv_unexpected =
+            (struct na_cb_info_multi_recv_unexpected){
+                .actual_buf_size = buf_size,
+                .source = (na_addr_t *) source,
+                .tag = tag,
+                .actual_buf = buf,
+                .last = last},
+        .arg = na_sm_op_id->completion_data.callback_info.arg,
+        .type = NA_CB_MULTI_RECV_UNEXPECTED,
+        .ret = cb_ret};
+    completion_data->callback = na_sm_op_id->completion_data.callback;
+    completion_data->plugin_callback = na_sm_release_multi;
+    completion_data->plugin_callback_args = na_sm_op_id;
+    if (source)
+        na_sm_addr_ref_incr(source);
+
+    /* Buffer is consumed, op ID can be reposted */
+    if (last)
+        hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_COMPLETED);
+
+    /* Add entry to NA completion queue */
+    na_cb_completion_add(na_sm_op_id->context, completion_data);
+}
+
+/*---------------------------------------------------------------------------*/
+static bool
+na_sm_multi_recv_drain(
+    struct na_sm_endpoint *na_sm_endpoint, struct na_sm_op_id *na_sm_op_id)
+{
+    struct na_sm_unexpected_msg_queue *unexpected_msg_queue =
+        &na_sm_endpoint->unexpected_msg_queue;
+    struct na_sm_op_queue *unexpected_op_queue =
+        &na_sm_endpoint->unexpected_op_queue;
+    bool drained = false;
+
+    for (;;) {
+        struct na_sm_unexpected_info *na_sm_unexpected_info;
+        struct na_cb_completion_data *completion_data = NULL;
+        void *buf = NULL;
+        bool last = false;
+        na_return_t cb_ret;
+
+        hg_thread_spin_lock(&unexpected_msg_queue->lock);
+        na_sm_unexpected_info = HG_QUEUE_FIRST(&unexpected_msg_queue->queue);
+        if (na_sm_unexpected_info == NULL) {
+            hg_thread_spin_unlock(&unexpected_msg_queue->lock);
+            break;
+        }
+
+        hg_thread_spin_lock(&unexpected_op_queue->lock);
+        if (!(hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_QUEUED)) {
+            /* Consumed or canceled in the meantime */
+            hg_thread_spin_unlock(&unexpected_op_queue->lock);
+            hg_thread_spin_unlock(&unexpected_msg_queue->lock);
+            break;
+        }
+        cb_ret = na_sm_multi_recv_reserve(na_sm_op_id,
+            na_sm_unexpected_info->buf_size, &completion_data, &buf, &last);
+        if (cb_ret == NA_AGAIN) {
+            hg_atomic_set32(&na_sm_op_id->info.multi_recv.overflow, 1);
+            hg_thread_spin_unlock(&unexpected_op_queue->lock);
+            hg_thread_spin_unlock(&unexpected_msg_queue->lock);
+            break;
+        }
+        HG_QUEUE_POP_HEAD(&unexpected_msg_queue->queue, entry);
+        hg_thread_spin_unlock(&unexpected_msg_queue->lock);
+
+        if (last) {
+            HG_QUEUE_REMOVE(&unexpected_op_queue->queue, na_sm_op_id,
+                na_sm_op_id, entry);
+            hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
+        }
+        if (unlikely(cb_ret == NA_MSGSIZE)) {
+            NA_LOG_SUBSYS_ERROR(msg,
+                "Unexpected msg size (%zu) exceeds space left in multi-recv "
+                "buffer",
+                na_sm_unexpected_info->buf_size);
+            na_sm_multi_recv_complete(na_sm_op_id, completion_data, cb_ret,
+                NULL, na_sm_unexpected_info->buf_size, NULL,
+                na_sm_unexpected_info->tag, last);
+        } else {
+            if (na_sm_unexpected_info->buf_size > 0)
+                memcpy(buf, na_sm_unexpected_info->buf,
+                    na_sm_unexpected_info->buf_size);
+            na_sm_multi_recv_complete(na_sm_op_id, completion_data, cb_ret,
+                buf, na_sm_unexpected_info->buf_size,
+                na_sm_unexpected_info->na_sm_addr, na_sm_unexpected_info->tag,
+                last);
+        }
+        hg_thread_spin_unlock(&unexpected_op_queue->lock);
+
+        na_sm_unexpected_info_free(
+            &unexpected_msg_queue->slab, na_sm_unexpected_info);
+        drained = true;
+    }
+
+    return drained;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE unsigned int
+na_sm_op_table_hash(struct na_sm_addr *na_sm_addr, na_tag_t tag)
+{
+    /* Tags are usually allocated sequentially by the upper layer, keep them
+     * as low bits and only mix in the address */
+    uint64_t key = ((uint64_t) (uintptr_t) na_sm_addr >> 6) *
+                   UINT64_C(0x9E3779B97F4A7C15);
+
+    return ((unsigned int) (key >> 32) ^ (unsigned int) tag) &
+           (NA_SM_OP_TABLE_SIZE - 1);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_op_table_init(struct na_sm_op_table *op_table)
+{
+    unsigned int i;
+
+    for (i = 0; i < NA_SM_OP_TABLE_SIZE; i++)
+        HG_QUEUE_INIT(&op_table->buckets[i]);
+    hg_thread_spin_init(&op_table->lock);
+    op_table->count = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_op_table_push(
+    struct na_sm_op_table *op_table, struct na_sm_op_id *na_sm_op_id)
+{
+    unsigned int idx =
+        na_sm_op_table_hash(na_sm_op_id->addr, na_sm_op_id->info.msg.tag);
+
+    hg_thread_spin_lock(&op_table->lock);
+    HG_QUEUE_PUSH_TAIL(&op_table->buckets[idx], na_sm_op_id, entry);
+    hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_QUEUED);
+    op_table->count++;
+    hg_thread_spin_unlock(&op_table->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct na_sm_op_id *
+na_sm_op_table_match(struct na_sm_op_table *op_table,
+    struct na_sm_addr *na_sm_addr, na_tag_t tag)
+{
+    unsigned int idx = na_sm_op_table_hash(na_sm_addr, tag);
+    struct na_sm_op_id *na_sm_op_id;
+
+    /* Ops sharing a bucket are kept in posting order */
+    hg_thread_spin_lock(&op_table->lock);
+    HG_QUEUE_FOREACH (na_sm_op_id, &op_table->buckets[idx], entry) {
+        if (na_sm_op_id->addr == na_sm_addr &&
+            na_sm_op_id->info.msg.tag == tag) {
             HG_QUEUE_REMOVE(
-                &expected_op_queue->queue, na_sm_op_id, na_sm_op_id, entry);
+                &op_table->buckets[idx], na_sm_op_id, na_sm_op_id, entry);
             hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
+            op_table->count--;
             break;
         }
     }
-    hg_thread_spin_unlock(&expected_op_queue->lock);
+    hg_thread_spin_unlock(&op_table->lock);
+
+    return na_sm_op_id;
+}
+
+/*---------------------------------------------------------------------------*/
+static bool
+na_sm_op_table_cancel(
+    struct na_sm_op_table *op_table, struct na_sm_op_id *na_sm_op_id)
+{
+    unsigned int idx =
+        na_sm_op_table_hash(na_sm_op_id->addr, na_sm_op_id->info.msg.tag);
+    bool canceled = false;
+
+    hg_thread_spin_lock(&op_table->lock);
+    if (hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_QUEUED) {
+        hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_CANCELED);
+        HG_QUEUE_REMOVE(
+            &op_table->buckets[idx], na_sm_op_id, na_sm_op_id, entry);
+        hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
+        op_table->count--;
+        canceled = true;
+    }
+    hg_thread_spin_unlock(&op_table->lock);
+
+    return canceled;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_process_expected(struct na_sm_op_table *expected_op_table,
+    struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr)
+{
+    struct na_sm_op_id *na_sm_op_id = NULL;
+    na_return_t ret = NA_SUCCESS;
+
+    NA_LOG_SUBSYS_DEBUG(msg, "Processing expected msg");
+
+    /* Try to match addr/tag */
+    na_sm_op_id = na_sm_op_table_match(
+        expected_op_table, poll_addr, (na_tag_t) msg_hdr.hdr.tag);
 
     NA_CHECK_SUBSYS_ERROR(op, na_sm_op_id == NULL, done, ret, NA_INVALID_ARG,
         "Invalid operation ID");
@@ -4080,6 +5277,18 @@ na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
     na_sm_op_id->completion_data.callback_info.info.recv_expected
         .actual_buf_size = msg_hdr.hdr.buf_size;
 
+    /* Peers may use a larger eager size than what was posted */
+    if (unlikely(
+            (size_t) msg_hdr.hdr.buf_size > na_sm_op_id->info.msg.buf_size)) {
+        NA_LOG_SUBSYS_ERROR(msg,
+            "Expected msg size (%zu) exceeds posted buffer size (%zu)",
+            (size_t) msg_hdr.hdr.buf_size, na_sm_op_id->info.msg.buf_size);
+        na_sm_buf_release(
+            &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+        na_sm_complete(na_sm_op_id, NA_MSGSIZE);
+        goto done;
+    }
+
     if (msg_hdr.hdr.buf_size > 0) {
         /* Copy buffer */
         na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
@@ -4232,6 +5441,96 @@ na_sm_release(void *arg)
     }
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_release_multi(void *arg)
+{
+    struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) arg;
+
+    na_sm_completion_multi_pop(&na_sm_op_id->completion_multi);
+
+    /* Pick up messages that could not be received while the ring was full */
+    if (unlikely(hg_atomic_cas32(
+            &na_sm_op_id->info.multi_recv.overflow, 1, 0))) {
+        struct na_sm_class *na_sm_class = NA_SM_CLASS(na_sm_op_id->na_class);
+
+        if (na_sm_multi_recv_drain(&na_sm_class->endpoint, na_sm_op_id))
+            na_sm_complete_signal(na_sm_class);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_completion_multi_init(
+    struct na_sm_completion_multi *completion_multi, uint32_t size)
+{
+    na_return_t ret;
+
+    completion_multi->data = (struct na_cb_completion_data *) calloc(
+        size, sizeof(struct na_cb_completion_data));
+    NA_CHECK_SUBSYS_ERROR(op, completion_multi->data == NULL, error, ret,
+        NA_NOMEM, "Could not allocate %" PRIu32 " completion data entries",
+        size);
+    completion_multi->size = size;
+    completion_multi->mask = (int32_t) (size - 1);
+    hg_atomic_init32(&completion_multi->head, 0);
+    hg_atomic_init32(&completion_multi->tail, 0);
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_completion_multi_destroy(struct na_sm_completion_multi *completion_multi)
+{
+    free(completion_multi->data);
+    completion_multi->data = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct na_cb_completion_data *
+na_sm_completion_multi_push(struct na_sm_completion_multi *completion_multi)
+{
+    struct na_cb_completion_data *completion_data;
+    int32_t head, next, tail;
+
+    head = hg_atomic_get32(&completion_multi->head);
+    next = (head + 1) & completion_multi->mask;
+    tail = hg_atomic_get32(&completion_multi->tail);
+
+    if (next == tail)
+        /* Full */
+        return NULL;
+
+    completion_data = &completion_multi->data[head];
+
+    hg_atomic_set32(&completion_multi->head, next);
+
+    return completion_data;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_completion_multi_pop(struct na_sm_completion_multi *completion_multi)
+{
+    int32_t head, next, tail;
+
+    /* Entries can be released concurrently by multiple trigger threads */
+    do {
+        tail = hg_atomic_get32(&completion_multi->tail);
+        head = hg_atomic_get32(&completion_multi->head);
+
+        if (head == tail)
+            /* Empty */
+            return;
+
+        next = (tail + 1) & completion_multi->mask;
+    } while (!hg_atomic_cas32(&completion_multi->tail, tail, next));
+}
+
 /********************/
 /* Plugin callbacks */
 /********************/
@@ -4254,7 +5553,9 @@ na_sm_initialize(
 {
     struct na_init_info na_init_info = NA_INIT_INFO_INITIALIZER;
     struct na_sm_class *na_sm_class = NULL;
+    unsigned int pair_max = NA_SM_MAX_PEERS_DEFAULT;
     struct rlimit rlimit;
+    const char *env;
     na_return_t ret;
     int rc;
 
@@ -4285,10 +5586,46 @@ na_sm_initialize(
 #endif
     na_sm_class->context_max = na_init_info.max_contexts;
 
+    /* Exported memory */
+    HG_LIST_INIT(&na_sm_class->mem_exports.list);
+    hg_thread_spin_init(&na_sm_class->mem_exports.lock);
+    na_sm_class->mem_exports.id_next = 1;
+
+    /* Eager msg sizes, larger msgs are backed by larger copy buf classes */
+    na_sm_class->unexpected_size_max = (na_init_info.max_unexpected_size)
+                                           ? na_init_info.max_unexpected_size
+                                           : NA_SM_UNEXPECTED_SIZE;
+    na_sm_class->expected_size_max = (na_init_info.max_expected_size)
+                                         ? na_init_info.max_expected_size
+                                         : NA_SM_EXPECTED_SIZE;
+    if (na_sm_class->unexpected_size_max > NA_SM_COPY_BUF_SIZE_MAX ||
+        na_sm_class->expected_size_max > NA_SM_COPY_BUF_SIZE_MAX) {
+        NA_LOG_SUBSYS_WARNING(cls,
+            "Max msg sizes (%zu, %zu) exceed copy buf size, using %zu",
+            na_sm_class->unexpected_size_max, na_sm_class->expected_size_max,
+            (size_t) NA_SM_COPY_BUF_SIZE_MAX);
+        na_sm_class->unexpected_size_max =
+            MIN(na_sm_class->unexpected_size_max, NA_SM_COPY_BUF_SIZE_MAX);
+        na_sm_class->expected_size_max =
+            MIN(na_sm_class->expected_size_max, NA_SM_COPY_BUF_SIZE_MAX);
+    }
+
+    /* Max number of peers that can connect to us */
+    if ((env = getenv("NA_SM_MAX_PEERS")) != NULL) {
+        long val = atol(env);
+
+        if (val < 1 || val > NA_SM_MAX_PEERS_LIMIT)
+            NA_LOG_SUBSYS_WARNING(cls,
+                "NA_SM_MAX_PEERS (%ld) must be between 1 and %d, using %d",
+                val, NA_SM_MAX_PEERS_LIMIT, NA_SM_MAX_PEERS_DEFAULT);
+        else
+            pair_max = (unsigned int) val;
+    }
+
     /* Open endpoint */
     ret = na_sm_endpoint_open(&na_sm_class->endpoint, na_info->host_name,
         listen, na_init_info.progress_mode & NA_NO_BLOCK,
-        (uint32_t) rlimit.rlim_cur);
+        (uint32_t) rlimit.rlim_cur, pair_max);
     NA_CHECK_SUBSYS_NA_ERROR(cls, error, ret, "Could not open endpoint");
 
     na_class->plugin_class = (void *) na_sm_class;
@@ -4305,11 +5642,23 @@ error:
 static na_return_t
 na_sm_finalize(na_class_t *na_class)
 {
+    struct na_sm_mem_export_list *mem_exports;
     na_return_t ret = NA_SUCCESS;
 
     if (!na_class->plugin_class)
         goto done;
 
+    /* Release exported memory that was not freed */
+    mem_exports = &NA_SM_CLASS(na_class)->mem_exports;
+    while (!HG_LIST_IS_EMPTY(&mem_exports->list)) {
+        struct na_sm_mem_export *mem_export = HG_LIST_FIRST(&mem_exports->list);
+
+        NA_LOG_SUBSYS_WARNING(cls, "Exported memory (%p) was not freed",
+            mem_export->base);
+        NA_SM_Mem_free(na_class, mem_export->base);
+    }
+    hg_thread_spin_destroy(&mem_exports->lock);
+
     NA_LOG_SUBSYS_DEBUG(cls, "Closing endpoint");
 
     /* Close endpoint */
@@ -4323,6 +5672,13 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static bool
+na_sm_has_opt_feature(na_class_t NA_UNUSED *na_class, unsigned long flags)
+{
+    return flags & NA_OPT_MULTI_RECV;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_context_create(
@@ -4367,7 +5723,7 @@ na_sm_cleanup(void)
 
 /*---------------------------------------------------------------------------*/
 static na_op_id_t *
-na_sm_op_create(na_class_t *na_class, unsigned long NA_UNUSED flags)
+na_sm_op_create(na_class_t *na_class, unsigned long flags)
 {
     struct na_sm_op_id *na_sm_op_id = NULL;
 
@@ -4378,6 +5734,16 @@ na_sm_op_create(na_class_t *na_class, unsigned long NA_UNUSED flags)
 
     na_sm_op_id->na_class = na_class;
 
+    if (flags & NA_OP_MULTI) {
+        na_return_t ret;
+
+        ret = na_sm_completion_multi_init(
+            &na_sm_op_id->completion_multi, NA_SM_OP_MULTI_CQ_SIZE);
+        NA_CHECK_SUBSYS_NA_ERROR(
+            op, error, ret, "Could not allocate multi-operation queue");
+        na_sm_op_id->multi_event = true;
+    }
+
     /* Completed by default */
     hg_atomic_init32(&na_sm_op_id->status, NA_SM_OP_COMPLETED);
 
@@ -4387,18 +5753,39 @@ na_sm_op_create(na_class_t *na_class, unsigned long NA_UNUSED flags)
 
 done:
     return (na_op_id_t *) na_sm_op_id;
+
+error:
+    free(na_sm_op_id);
+    return NULL;
 }
 
 /*---------------------------------------------------------------------------*/
 static void
-na_sm_op_destroy(na_class_t NA_UNUSED *na_class, na_op_id_t *op_id)
+na_sm_op_destroy(na_class_t *na_class, na_op_id_t *op_id)
 {
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
 
-    NA_CHECK_SUBSYS_WARNING(op,
-        !(hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_COMPLETED),
-        "Attempting to use OP ID that was not completed (%s)",
-        na_cb_type_to_string(na_sm_op_id->completion_data.callback_info.type));
+    if (na_sm_op_id->multi_event) {
+        /* Multi-events may not be fully completed when they are destroyed */
+        struct na_sm_op_queue *unexpected_op_queue =
+            &NA_SM_CLASS(na_class)->endpoint.unexpected_op_queue;
+
+        hg_thread_spin_lock(&unexpected_op_queue->lock);
+        if (hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_QUEUED) {
+            HG_QUEUE_REMOVE(&unexpected_op_queue->queue, na_sm_op_id,
+                na_sm_op_id, entry);
+            hg_atomic_and32(&na_sm_op_id->status, ~NA_SM_OP_QUEUED);
+        }
+        hg_thread_spin_unlock(&unexpected_op_queue->lock);
+
+        na_sm_completion_multi_destroy(&na_sm_op_id->completion_multi);
+    } else {
+        NA_CHECK_SUBSYS_WARNING(op,
+            !(hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_COMPLETED),
+            "Attempting to use OP ID that was not completed (%s)",
+            na_cb_type_to_string(
+                na_sm_op_id->completion_data.callback_info.type));
+    }
 
     free(na_sm_op_id);
 }
@@ -4614,16 +6001,16 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE size_t
-na_sm_msg_get_max_unexpected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_unexpected_size(const na_class_t *na_class)
 {
-    return NA_SM_UNEXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->unexpected_size_max;
 }
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE size_t
-na_sm_msg_get_max_expected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_expected_size(const na_class_t *na_class)
 {
-    return NA_SM_EXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->expected_size_max;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4655,9 +6042,10 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
         &NA_SM_CLASS(na_class)->endpoint.unexpected_msg_queue;
     struct na_sm_unexpected_info *na_sm_unexpected_info;
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
-    na_return_t ret;
+    na_return_t ret, cb_ret = NA_SUCCESS;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_UNEXPECTED_SIZE, error, ret,
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size > NA_SM_CLASS(na_class)->unexpected_size_max, error, ret,
         NA_OVERFLOW, "Exceeds unexpected size, %zu", buf_size);
 
     /* Check op_id */
@@ -4688,14 +6076,19 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
                 .source = (na_addr_t *) na_sm_unexpected_info->na_sm_addr};
         na_sm_addr_ref_incr(na_sm_unexpected_info->na_sm_addr);
 
-        if (na_sm_unexpected_info->buf_size > 0) {
+        if (unlikely(na_sm_unexpected_info->buf_size > buf_size)) {
+            NA_LOG_SUBSYS_ERROR(msg,
+                "Unexpected msg size (%zu) exceeds posted buffer size (%zu)",
+                na_sm_unexpected_info->buf_size, buf_size);
+            cb_ret = NA_MSGSIZE;
+        } else if (na_sm_unexpected_info->buf_size > 0) {
             /* Copy buffers */
             memcpy(na_sm_op_id->info.msg.buf.ptr, na_sm_unexpected_info->buf,
                 na_sm_unexpected_info->buf_size);
-            free(na_sm_unexpected_info->buf);
         }
-        free(na_sm_unexpected_info);
-        na_sm_complete(na_sm_op_id, NA_SUCCESS);
+        na_sm_unexpected_info_free(
+            &unexpected_msg_queue->slab, na_sm_unexpected_info);
+        na_sm_complete(na_sm_op_id, cb_ret);
 
         /* Notify local completion */
         na_sm_complete_signal(NA_SM_CLASS(na_class));
@@ -4721,6 +6114,58 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_msg_multi_recv_unexpected(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, void *buf, size_t buf_size,
+    void NA_UNUSED *plugin_data, na_op_id_t *op_id)
+{
+    struct na_sm_endpoint *na_sm_endpoint = &NA_SM_CLASS(na_class)->endpoint;
+    struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
+    na_return_t ret;
+
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size < NA_SM_CLASS(na_class)->unexpected_size_max, error, ret,
+        NA_INVALID_ARG, "Multi-recv buffer size (%zu) is smaller than %zu",
+        buf_size, NA_SM_CLASS(na_class)->unexpected_size_max);
+
+    /* Check op_id */
+    NA_CHECK_SUBSYS_ERROR(op, na_sm_op_id == NULL, error, ret, NA_INVALID_ARG,
+        "Invalid operation ID");
+    NA_CHECK_SUBSYS_ERROR(op, !na_sm_op_id->multi_event, error, ret,
+        NA_INVALID_ARG, "Operation ID was not created with NA_OP_MULTI");
+    NA_CHECK_SUBSYS_ERROR(op,
+        !(hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_COMPLETED), error,
+        ret, NA_BUSY, "Attempting to use OP ID that was not completed (%s)",
+        na_cb_type_to_string(na_sm_op_id->completion_data.callback_info.type));
+
+    NA_SM_OP_RESET_MULTI_RECV(na_sm_op_id, context, callback, arg);
+
+    /* We assume buf remains valid (safe because we pre-allocate buffers) */
+    na_sm_op_id->info.multi_recv.buf = buf;
+    na_sm_op_id->info.multi_recv.buf_size = buf_size;
+    na_sm_op_id->info.multi_recv.offset = 0;
+    hg_atomic_set32(&na_sm_op_id->info.multi_recv.overflow, 0);
+
+    /* Queue op_id first so that new messages are directly received into the
+     * buffer while previously received messages are being drained */
+    hg_thread_spin_lock(&na_sm_endpoint->unexpected_op_queue.lock);
+    HG_QUEUE_PUSH_TAIL(
+        &na_sm_endpoint->unexpected_op_queue.queue, na_sm_op_id, entry);
+    hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_QUEUED);
+    hg_thread_spin_unlock(&na_sm_endpoint->unexpected_op_queue.lock);
+
+    /* Look for unexpected messages already received */
+    if (unlikely(na_sm_multi_recv_drain(na_sm_endpoint, na_sm_op_id)))
+        /* Notify local completion */
+        na_sm_complete_signal(NA_SM_CLASS(na_class));
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_msg_send_expected(na_class_t *na_class, na_context_t *context,
@@ -4740,13 +6185,14 @@ na_sm_msg_recv_expected(na_class_t *na_class, na_context_t *context,
     void NA_UNUSED *plugin_data, na_addr_t *source_addr,
     uint8_t NA_UNUSED source_id, na_tag_t tag, na_op_id_t *op_id)
 {
-    struct na_sm_op_queue *expected_op_queue =
-        &NA_SM_CLASS(na_class)->endpoint.expected_op_queue;
+    struct na_sm_op_table *expected_op_table =
+        &NA_SM_CLASS(na_class)->endpoint.expected_op_table;
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) source_addr;
     na_return_t ret;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_EXPECTED_SIZE, error, ret,
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size > NA_SM_CLASS(na_class)->expected_size_max, error, ret,
         NA_OVERFLOW, "Exceeds expected size, %zu", buf_size);
 
     /* Check op_id */
@@ -4767,11 +6213,8 @@ na_sm_msg_recv_expected(na_class_t *na_class, na_context_t *context,
 
     /* Expected messages must always be pre-posted, therefore a message should
      * never arrive before that call returns (not completes), simply add
-     * op_id to queue */
-    hg_thread_spin_lock(&expected_op_queue->lock);
-    HG_QUEUE_PUSH_TAIL(&expected_op_queue->queue, na_sm_op_id, entry);
-    hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_QUEUED);
-    hg_thread_spin_unlock(&expected_op_queue->lock);
+     * op_id to table */
+    na_sm_op_table_push(expected_op_table, na_sm_op_id);
 
     return NA_SUCCESS;
 
@@ -4781,7 +6224,7 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_mem_handle_create(na_class_t NA_UNUSED *na_class, void *buf,
+na_sm_mem_handle_create(na_class_t *na_class, void *buf,
     size_t buf_size, unsigned long flags, na_mem_handle_t **mem_handle_p)
 {
     struct na_sm_mem_handle *na_sm_mem_handle = NULL;
@@ -4798,6 +6241,8 @@ na_sm_mem_handle_create(na_class_t NA_UNUSED *na_class, void *buf,
     na_sm_mem_handle->info.iovcnt = 1;
     na_sm_mem_handle->info.flags = flags & 0xff;
     na_sm_mem_handle->info.len = buf_size;
+    na_sm_mem_handle_set_export(
+        &NA_SM_CLASS(na_class)->mem_exports, na_sm_mem_handle);
 
     *mem_handle_p = (na_mem_handle_t *) na_sm_mem_handle;
 
@@ -4849,6 +6294,8 @@ na_sm_mem_handle_create_segments(na_class_t *na_class,
     }
     na_sm_mem_handle->info.iovcnt = segment_count;
     na_sm_mem_handle->info.flags = flags & 0xff;
+    na_sm_mem_handle_set_export(
+        &NA_SM_CLASS(na_class)->mem_exports, na_sm_mem_handle);
 
     *mem_handle_p = (na_mem_handle_t *) na_sm_mem_handle;
 
@@ -5021,18 +6468,12 @@ static NA_INLINE bool
 na_sm_poll_try_wait(na_class_t *na_class, na_context_t NA_UNUSED *context)
 {
     struct na_sm_endpoint *na_sm_endpoint = &NA_SM_CLASS(na_class)->endpoint;
-    struct na_sm_addr *na_sm_addr;
     bool empty = false;
 
-    /* Check whether something is in one of the rx queues */
-    hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-    HG_LIST_FOREACH (na_sm_addr, &na_sm_endpoint->poll_addr_list.list, entry) {
-        if (!na_sm_msg_queue_is_empty(na_sm_addr->rx_queue)) {
-            hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
-            return false;
-        }
-    }
-    hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+    /* Check whether something is in one of the rx queues, peers only notify
+     * us once we have asked for it */
+    if (!na_sm_poll_park(na_sm_endpoint))
+        return false;
 
     /* Check whether something is in the retry queue */
     hg_thread_spin_lock(&na_sm_endpoint->retry_op_queue.lock);
@@ -5061,11 +6502,34 @@ na_sm_progress(
         bool progressed = false;
 
         if (na_sm_endpoint->poll_set) {
+            unsigned int poll_timeout =
+                hg_time_to_ms(hg_time_subtract(deadline, now));
+            bool retry_empty, progressed_wait = false;
+
+            /* Peers do not signal when queue space is released, do not block
+             * while ops are waiting to be retried */
+            hg_thread_spin_lock(&na_sm_endpoint->retry_op_queue.lock);
+            retry_empty =
+                HG_QUEUE_IS_EMPTY(&na_sm_endpoint->retry_op_queue.queue);
+            hg_thread_spin_unlock(&na_sm_endpoint->retry_op_queue.lock);
+            if (!retry_empty)
+                poll_timeout = 0;
+
+            /* Peers do not signal every message, look at rx queues first and
+             * only block once peers have been asked to notify us */
+            ret = na_sm_poll_rx_queues(na_sm_endpoint, &progressed);
+            NA_CHECK_SUBSYS_NA_ERROR(
+                poll, error, ret, "Could not poll rx queues");
+            if (progressed ||
+                (poll_timeout > 0 && !na_sm_poll_park(na_sm_endpoint)))
+                poll_timeout = 0;
+
             /* Make blocking progress */
-            ret = na_sm_poll_wait(context, na_sm_endpoint,
-                hg_time_to_ms(hg_time_subtract(deadline, now)), &progressed);
+            ret = na_sm_poll_wait(
+                context, na_sm_endpoint, poll_timeout, &progressed_wait);
             NA_CHECK_SUBSYS_NA_ERROR(poll, error, ret,
                 "Could not make blocking progress on context");
+            progressed |= progressed_wait;
         } else {
             /* Make non-blocking progress */
             ret = na_sm_poll(na_sm_endpoint, &progressed);
@@ -5098,6 +6562,7 @@ na_sm_cancel(
 {
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     struct na_sm_op_queue *op_queue = NULL;
+    bool canceled = false;
     int32_t status;
     na_return_t ret;
 
@@ -5113,12 +6578,15 @@ na_sm_cancel(
 
     switch (na_sm_op_id->completion_data.callback_info.type) {
         case NA_CB_RECV_UNEXPECTED:
+        case NA_CB_MULTI_RECV_UNEXPECTED:
             /* Must remove op_id from unexpected op queue */
             op_queue = &NA_SM_CLASS(na_class)->endpoint.unexpected_op_queue;
             break;
         case NA_CB_RECV_EXPECTED:
-            /* Must remove op_id from unexpected op queue */
-            op_queue = &NA_SM_CLASS(na_class)->endpoint.expected_op_queue;
+            /* Must remove op_id from expected op table */
+            canceled = na_sm_op_table_cancel(
+                &NA_SM_CLASS(na_class)->endpoint.expected_op_table,
+                na_sm_op_id);
             break;
         case NA_CB_SEND_UNEXPECTED:
         case NA_CB_SEND_EXPECTED:
@@ -5137,8 +6605,6 @@ na_sm_cancel(
 
     /* Remove op id from queue it is on */
     if (op_queue) {
-        bool canceled = false;
-
         hg_thread_spin_lock(&op_queue->lock);
         if (hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_QUEUED) {
             hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_CANCELED);
@@ -5153,13 +6619,13 @@ na_sm_cancel(
             }
         }
         hg_thread_spin_unlock(&op_queue->lock);
+    }
 
-        /* Cancel op id */
-        if (canceled) {
-            na_sm_complete(na_sm_op_id, NA_CANCELED);
+    /* Cancel op id */
+    if (canceled) {
+        na_sm_complete(na_sm_op_id, NA_CANCELED);
 
-            na_sm_complete_signal(NA_SM_CLASS(na_class));
-        }
+        na_sm_complete_signal(NA_SM_CLASS(na_class));
     }
 
     return NA_SUCCESS;
@@ -91,6 +91,30 @@ NA_SM_Host_id_copy(na_sm_id_t *dst_p, na_sm_id_t src);
 NA_PUBLIC bool
 NA_SM_Host_id_cmp(na_sm_id_t id1, na_sm_id_t id2);
 
+/**
+ * Allocate memory that can be exported to peers. RMA operations that target
+ * memory handles created within that memory are then completed by peers with
+ * plain copies through a shared mapping instead of CMA system calls. Buffer
+ * size is rounded up to the page size.
+ *
+ * \param na_class [IN/OUT]     pointer to SM class
+ * \param size [IN]             buffer size
+ *
+ * \return Pointer to allocated memory or NULL in case of failure
+ */
+NA_PUBLIC void *
+NA_SM_Mem_alloc(na_class_t *na_class, size_t size);
+
+/**
+ * Free memory allocated with NA_SM_Mem_alloc(). Memory handles that reference
+ * that memory must be freed first.
+ *
+ * \param na_class [IN/OUT]     pointer to SM class
+ * \param buf [IN]              pointer to buffer
+ */
+NA_PUBLIC void
+NA_SM_Mem_free(na_class_t *na_class, void *buf);
+
 #ifdef __cplusplus
 }
 #endif
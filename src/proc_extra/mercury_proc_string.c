@@ -58,35 +58,30 @@ hg_proc_hg_string_object_t(hg_proc_t proc, void *string)
             if (ret != HG_SUCCESS)
                 goto done;
             if (string_len) {
-                strobj->data = (char *) malloc(string_len);
-                if (strobj->data == NULL) {
-                    ret = HG_NOMEM;
-                    goto done;
-                }
-                ret = hg_proc_bytes(proc, strobj->data, string_len);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
+                /* Data may be borrowed from the proc buffer */
+                ret = hg_proc_bytes_ptr(
+                    proc, (void **) &strobj->data, string_len);
+                if (ret != HG_SUCCESS)
                     goto done;
-                }
                 ret =
                     hg_proc_hg_uint8_t(proc, (hg_uint8_t *) &strobj->is_const);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
-                    goto done;
-                }
+                if (ret != HG_SUCCESS)
+                    goto error;
                 ret =
                     hg_proc_hg_uint8_t(proc, (hg_uint8_t *) &strobj->is_owned);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
-                    goto done;
-                }
+                if (ret != HG_SUCCESS)
+                    goto error;
             } else
                 strobj->data = NULL;
             break;
         case HG_FREE:
+#ifndef HG_HAS_XDR
+            /* Borrowed strings are released along with the proc buffer */
+            if (hg_proc_get_flags(proc) & HG_PROC_ZERO_COPY) {
+                strobj->data = NULL;
+                break;
+            }
+#endif
             ret = hg_string_object_free(strobj);
             if (ret != HG_SUCCESS)
                 goto done;
@@ -97,4 +92,13 @@ hg_proc_hg_string_object_t(hg_proc_t proc, void *string)
 
 done:
     return ret;
+
+error:
+#ifndef HG_HAS_XDR
+    if (!(hg_proc_get_flags(proc) & HG_PROC_ZERO_COPY))
+#endif
+        free(strobj->data);
+    strobj->data = NULL;
+
+    return ret;
 }
@@ -76,3 +76,42 @@ hg_atomic_queue_free(struct hg_atomic_queue *hg_atomic_queue)
 {
     hg_mem_aligned_free(hg_atomic_queue);
 }
+
+/*---------------------------------------------------------------------------*/
+struct hg_atomic_queue *
+hg_atomic_queue_alloc_numa(unsigned int count, int node)
+{
+    struct hg_atomic_queue *hg_atomic_queue = NULL;
+
+    HG_UTIL_CHECK_ERROR_NORET(
+        !powerof2(count), done, "atomic queue size must be power of 2");
+
+    /* Memory is page aligned and zeroed */
+    hg_atomic_queue = hg_mem_numa_alloc(
+        sizeof(struct hg_atomic_queue) + count * sizeof(hg_atomic_int64_t),
+        node);
+    HG_UTIL_CHECK_ERROR_NORET(
+        hg_atomic_queue == NULL, done, "Could not allocate atomic queue");
+
+    hg_atomic_queue->prod_size = hg_atomic_queue->cons_size = count;
+    hg_atomic_queue->prod_mask = hg_atomic_queue->cons_mask = count - 1;
+    hg_atomic_init32(&hg_atomic_queue->prod_head, 0);
+    hg_atomic_init32(&hg_atomic_queue->cons_head, 0);
+    hg_atomic_init32(&hg_atomic_queue->prod_tail, 0);
+    hg_atomic_init32(&hg_atomic_queue->cons_tail, 0);
+
+done:
+    return hg_atomic_queue;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_atomic_queue_free_numa(struct hg_atomic_queue *hg_atomic_queue)
+{
+    if (hg_atomic_queue == NULL)
+        return;
+
+    hg_mem_numa_free(hg_atomic_queue,
+        sizeof(struct hg_atomic_queue) +
+            hg_atomic_queue->prod_size * sizeof(hg_atomic_int64_t));
+}
@@ -105,6 +105,26 @@ hg_atomic_queue_alloc(unsigned int count);
 HG_UTIL_PUBLIC void
 hg_atomic_queue_free(struct hg_atomic_queue *hg_atomic_queue);
 
+/**
+ * Allocate a new queue that can hold \count elements from memory bound to NUMA
+ * node \node (see hg_mem_numa_alloc()).
+ *
+ * \param count [IN]                maximum number of elements
+ * \param node [IN]                 NUMA node index
+ *
+ * \return pointer to allocated queue or NULL on failure
+ */
+HG_UTIL_PUBLIC struct hg_atomic_queue *
+hg_atomic_queue_alloc_numa(unsigned int count, int node);
+
+/**
+ * Free an existing queue allocated from hg_atomic_queue_alloc_numa().
+ *
+ * \param hg_atomic_queue [IN]      pointer to queue
+ */
+HG_UTIL_PUBLIC void
+hg_atomic_queue_free_numa(struct hg_atomic_queue *hg_atomic_queue);
+
 /**
  * Push an entry to the queue.
  *
@@ -136,6 +156,21 @@ hg_atomic_queue_pop_mc(struct hg_atomic_queue *hg_atomic_queue);
 static HG_UTIL_INLINE void *
 hg_atomic_queue_pop_sc(struct hg_atomic_queue *hg_atomic_queue);
 
+/**
+ * Pop at most \max_count entries from the queue (multi-consumer). Entries
+ * are claimed using a single consumer reservation and are returned in FIFO
+ * order.
+ *
+ * \param hg_atomic_queue [IN/OUT]  pointer to queue
+ * \param entries [OUT]             array of at least \max_count pointers
+ * \param max_count [IN]            maximum number of entries to pop
+ *
+ * \return Number of entries popped or 0 if queue is empty
+ */
+static HG_UTIL_INLINE unsigned int
+hg_atomic_queue_pop_mc_batch(struct hg_atomic_queue *hg_atomic_queue,
+    void **entries, unsigned int max_count);
+
 /**
  * Determine whether queue is empty.
  *
@@ -251,6 +286,52 @@ hg_atomic_queue_pop_sc(struct hg_atomic_queue *hg_atomic_queue)
     return entry;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE unsigned int
+hg_atomic_queue_pop_mc_batch(struct hg_atomic_queue *hg_atomic_queue,
+    void **entries, unsigned int max_count)
+{
+    int32_t cons_head, cons_next;
+    unsigned int count, i;
+
+    if (max_count == 0)
+        return 0;
+
+    do {
+        cons_head = hg_atomic_get32(&hg_atomic_queue->cons_head);
+        count = ((unsigned int) hg_atomic_get32(&hg_atomic_queue->prod_tail) -
+                    (unsigned int) cons_head) &
+                hg_atomic_queue->cons_mask;
+
+        if (count == 0)
+            /* Empty */
+            return 0;
+        if (count > max_count)
+            count = max_count;
+
+        cons_next =
+            (cons_head + (int32_t) count) & (int) hg_atomic_queue->cons_mask;
+    } while (
+        !hg_atomic_cas32(&hg_atomic_queue->cons_head, cons_head, cons_next));
+
+    for (i = 0; i < count; i++)
+        entries[i] = (void *) hg_atomic_get64(
+            &hg_atomic_queue->ring[(cons_head + (int32_t) i) &
+                                   (int) hg_atomic_queue->cons_mask]);
+
+    /*
+     * If there are other dequeues in progress
+     * that preceded us, we need to wait for them
+     * to complete
+     */
+    while (hg_atomic_get32(&hg_atomic_queue->cons_tail) != cons_head)
+        cpu_spinwait();
+
+    hg_atomic_set32(&hg_atomic_queue->cons_tail, cons_next);
+
+    return count;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_UTIL_INLINE bool
 hg_atomic_queue_is_empty(struct hg_atomic_queue *hg_atomic_queue)
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MERCURY_CRC32C_H
+#define MERCURY_CRC32C_H
+
+#include "mercury_util_config.h"
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Update CRC32C (Castagnoli) of a stream of data with len bytes of buf.
+ * Starting from a CRC of 0, the result is the standard CRC32C of the data.
+ * The SSE4.2 or ARMv8 CRC instructions are used when available.
+ *
+ * \param crc [IN]              CRC of previous data (0 initially)
+ * \param buf [IN]              pointer to data
+ * \param len [IN]              size of data
+ *
+ * \return updated CRC
+ */
+HG_UTIL_PUBLIC uint32_t
+hg_crc32c_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * Copy len bytes from src to dest and update CRC32C with the copied data.
+ * Data is checksummed while it is still in cache, which avoids reading the
+ * buffer a second time.
+ *
+ * \param crc [IN]              CRC of previous data (0 initially)
+ * \param dest [OUT]            pointer to destination buffer
+ * \param src [IN]              pointer to source buffer
+ * \param len [IN]              size of data
+ *
+ * \return updated CRC
+ */
+HG_UTIL_PUBLIC uint32_t
+hg_crc32c_copy(uint32_t crc, void *dest, const void *src, size_t len);
+
+/**
+ * Combine the CRC32C of two consecutive blocks of data, crc1 being the CRC of
+ * the first block and crc2 the CRC of the second block of len2 bytes.
+ * Combining crc1 with a crc2 of 0 gives the contribution of the first block to
+ * the CRC of both blocks, which allows the CRC of blocks that are checksummed
+ * in any order to be accumulated with XOR.
+ *
+ * \param crc1 [IN]             CRC of first block
+ * \param crc2 [IN]             CRC of second block
+ * \param len2 [IN]             size of second block
+ *
+ * \return CRC of both blocks
+ */
+HG_UTIL_PUBLIC uint32_t
+hg_crc32c_combine(uint32_t crc1, uint32_t crc2, size_t len2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_CRC32C_H */
@@ -21,6 +21,10 @@
 #    include <sys/stat.h> /* For mode constants */
 #    include <sys/types.h>
 #    include <unistd.h>
+#    ifdef __linux__
+#        include <linux/mempolicy.h> /* For MPOL_* constants */
+#        include <sys/syscall.h>
+#    endif
 #endif
 #include <stdlib.h>
 
@@ -159,6 +163,154 @@ hg_mem_aligned_free(void *mem_ptr)
 #endif
 }
 
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_numa_node_get(void)
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu, node;
+
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0)
+        return -1;
+
+    return (int) node;
+#else
+    return -1;
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_numa_node_prefer(int node, struct hg_mem_numa_policy *old_policy)
+{
+    int ret;
+
+#if defined(__linux__) && defined(SYS_set_mempolicy) &&                        \
+    defined(SYS_get_mempolicy)
+    struct hg_mem_numa_policy policy;
+    long rc;
+
+    HG_UTIL_CHECK_ERROR(node < 0 || node >= HG_MEM_NUMA_NODE_MAX, error, ret,
+        HG_UTIL_FAIL, "NUMA node index %d is not valid (max %d)", node,
+        HG_MEM_NUMA_NODE_MAX);
+
+    if (old_policy) {
+        rc = syscall(SYS_get_mempolicy, &old_policy->mode, old_policy->mask,
+            (unsigned long) HG_MEM_NUMA_NODE_MAX, NULL, 0UL);
+        HG_UTIL_CHECK_ERROR(rc != 0, error, ret, HG_UTIL_FAIL,
+            "get_mempolicy() failed (%s)", strerror(errno));
+    }
+
+    memset(policy.mask, 0, sizeof(policy.mask));
+    policy.mask[(size_t) node / (8 * sizeof(unsigned long))] |=
+        1UL << ((size_t) node % (8 * sizeof(unsigned long)));
+    policy.mode = MPOL_PREFERRED;
+
+    ret = hg_mem_numa_policy_restore(&policy);
+    HG_UTIL_CHECK_ERROR_NORET(
+        ret != HG_UTIL_SUCCESS, error, "Could not prefer NUMA node %d", node);
+#else
+    (void) node;
+    (void) old_policy;
+    HG_UTIL_CHECK_ERROR(1, error, ret, HG_UTIL_FAIL, "not implemented");
+#endif
+
+    return HG_UTIL_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_numa_policy_restore(const struct hg_mem_numa_policy *policy)
+{
+    int ret;
+
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    long rc;
+
+    /* Mask size is off by one for set_mempolicy() */
+    rc = syscall(SYS_set_mempolicy, policy->mode,
+        (policy->mode == MPOL_DEFAULT) ? NULL : policy->mask,
+        (policy->mode == MPOL_DEFAULT)
+            ? 0UL
+            : (unsigned long) HG_MEM_NUMA_NODE_MAX + 1);
+    HG_UTIL_CHECK_ERROR(rc != 0, error, ret, HG_UTIL_FAIL,
+        "set_mempolicy() failed (%s)", strerror(errno));
+#else
+    (void) policy;
+    HG_UTIL_CHECK_ERROR(1, error, ret, HG_UTIL_FAIL, "not implemented");
+#endif
+
+    return HG_UTIL_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_mem_numa_alloc(size_t size, int node)
+{
+    void *mem_ptr = NULL;
+
+#ifdef _WIN32
+    (void) node;
+    mem_ptr = calloc(1, size);
+    HG_UTIL_CHECK_ERROR_NORET(mem_ptr == NULL, error, "calloc() failed");
+#else
+    mem_ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    HG_UTIL_CHECK_ERROR_NORET(
+        mem_ptr == MAP_FAILED, error, "mmap() failed (%s)", strerror(errno));
+
+    if (node >= 0) {
+#    if defined(__linux__) && defined(SYS_mbind)
+        unsigned long mask[HG_MEM_NUMA_NODE_MAX / (8 * sizeof(unsigned long))];
+        long rc;
+
+        HG_UTIL_CHECK_ERROR_NORET(node >= HG_MEM_NUMA_NODE_MAX, error_unmap,
+            "NUMA node index %d is not valid (max %d)", node,
+            HG_MEM_NUMA_NODE_MAX);
+        memset(mask, 0, sizeof(mask));
+        mask[(size_t) node / (8 * sizeof(unsigned long))] |=
+            1UL << ((size_t) node % (8 * sizeof(unsigned long)));
+
+        /* Mask size is off by one for mbind() */
+        rc = syscall(SYS_mbind, mem_ptr, size, MPOL_PREFERRED, mask,
+            (unsigned long) HG_MEM_NUMA_NODE_MAX + 1, 0U);
+        HG_UTIL_CHECK_ERROR_NORET(rc != 0, error_unmap,
+            "mbind() failed (%s)", strerror(errno));
+#    endif
+    }
+#endif
+
+    return mem_ptr;
+
+#if !defined(_WIN32) && defined(__linux__) && defined(SYS_mbind)
+error_unmap:
+    (void) munmap(mem_ptr, size);
+#endif
+error:
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_mem_numa_free(void *mem_ptr, size_t size)
+{
+    if (mem_ptr == NULL)
+        return;
+
+#ifdef _WIN32
+    (void) size;
+    free(mem_ptr);
+#else
+    (void) munmap(mem_ptr, size);
+#endif
+}
+
 /*---------------------------------------------------------------------------*/
 void *
 hg_mem_header_alloc(size_t header_size, size_t alignment, size_t size)
@@ -10,16 +10,23 @@
 
 #include "mercury_util_config.h"
 
-/*************************************/
-/* Public Type and Struct Definition */
-/*************************************/
-
 /*****************/
 /* Public Macros */
 /*****************/
 
 #define HG_MEM_CACHE_LINE_SIZE 64
 #define HG_MEM_PAGE_SIZE       4096
+#define HG_MEM_NUMA_NODE_MAX   1024
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+/* Memory policy of a thread */
+struct hg_mem_numa_policy {
+    unsigned long mask[HG_MEM_NUMA_NODE_MAX / (8 * sizeof(unsigned long))];
+    int mode;
+};
 
 /*********************/
 /* Public Prototypes */
@@ -86,6 +93,61 @@ hg_mem_huge_alloc(size_t size);
 HG_UTIL_PUBLIC int
 hg_mem_huge_free(void *mem_ptr, size_t size);
 
+/**
+ * Get the NUMA node of the CPU that the calling thread is running on.
+ *
+ * \return NUMA node index on success, or negative if it cannot be determined
+ */
+HG_UTIL_PUBLIC int
+hg_mem_numa_node_get(void);
+
+/**
+ * Set the preferred NUMA node for new memory allocations made by the calling
+ * thread. The previous memory policy of the thread is saved to \old_policy
+ * if not NULL, so that it can later be restored with
+ * hg_mem_numa_policy_restore().
+ *
+ * \param node [IN]             NUMA node index
+ * \param old_policy [OUT]      pointer to previous memory policy
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_PUBLIC int
+hg_mem_numa_node_prefer(int node, struct hg_mem_numa_policy *old_policy);
+
+/**
+ * Restore memory policy of the calling thread.
+ *
+ * \param policy [IN]           pointer to memory policy
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_PUBLIC int
+hg_mem_numa_policy_restore(const struct hg_mem_numa_policy *policy);
+
+/**
+ * Allocate size bytes of zeroed memory from fresh pages bound to NUMA node
+ * \node. Pages are placed on that node when first touched, regardless of the
+ * thread touching them. If \node is negative, the default memory policy
+ * applies.
+ *
+ * \param size [IN]             total requested size
+ * \param node [IN]             NUMA node index
+ *
+ * \return a pointer to the allocated memory, or NULL in case of failure
+ */
+HG_UTIL_PUBLIC void *
+hg_mem_numa_alloc(size_t size, int node);
+
+/**
+ * Free memory allocated from hg_mem_numa_alloc().
+ *
+ * \param mem_ptr [IN]          pointer to allocated memory
+ * \param size [IN]             allocated size
+ */
+HG_UTIL_PUBLIC void
+hg_mem_numa_free(void *mem_ptr, size_t size);
+
 /**
  * Allocate a buffer with a `size`-bytes, `alignment`-aligned payload
  * preceded by a `header_size` header, padding the allocation with up
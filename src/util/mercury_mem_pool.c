@@ -5,17 +5,26 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE
+#endif
 #include "mercury_mem_pool.h"
 
+#include "mercury_atomic.h"
 #include "mercury_mem.h"
-#include "mercury_queue.h"
+#include "mercury_thread.h"
 #include "mercury_thread_condition.h"
 #include "mercury_thread_mutex.h"
-#include "mercury_thread_spin.h"
 #include "mercury_util_error.h"
 
+#ifdef HG_UTIL_HAS_SCHED_GETCPU
+#    include <sched.h>
+#endif
 #include <stdlib.h>
 #include <string.h>
+#ifndef _WIN32
+#    include <unistd.h>
+#endif
 
 /****************/
 /* Local Macros */
@@ -33,6 +42,22 @@
         ((type *) ((char *) ptr - offsetof(type, member)))
 #endif
 
+/* Max number of blocks per pool */
+#define HG_MEM_POOL_BLOCK_MAX (1024)
+
+/* Number of chunks cached per magazine, half of it is exchanged at once with
+ * the shared free list */
+#define HG_MEM_POOL_MAGAZINE_SIZE (32)
+
+/* Max number of magazines (one per CPU) */
+#define HG_MEM_POOL_MAGAZINE_MAX (256)
+
+/* Free list head is made of a chunk ID (0 if empty) and of an ABA tag */
+#define HG_MEM_POOL_HEAD_ID(head)  ((uint32_t) ((uint64_t) (head) &0xffffffff))
+#define HG_MEM_POOL_HEAD_TAG(head) ((uint64_t) (head) >> 32)
+#define HG_MEM_POOL_HEAD(tag, id)                                              \
+    ((int64_t) (((uint64_t) (tag) << 32) | (uint64_t) (id)))
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -41,8 +66,10 @@
  * Memory chunk (points to actual data).
  */
 struct hg_mem_pool_chunk {
-    HG_QUEUE_ENTRY(hg_mem_pool_chunk) entry; /* Entry in chunk_list */
-    char *chunk;                             /* Must be last        */
+    struct hg_mem_pool_block *block; /* Block chunk belongs to    */
+    hg_atomic_int32_t next;          /* Next chunk ID (free list) */
+    uint32_t id;                     /* Chunk ID                  */
+    char chunk[];                    /* Must be last              */
 };
 
 /**
@@ -50,27 +77,41 @@ struct hg_mem_pool_chunk {
  * buffer is registered.
  */
 struct hg_mem_pool_block {
-    HG_QUEUE_HEAD(hg_mem_pool_chunk) chunks; /* Chunk list           */
-    HG_QUEUE_ENTRY(hg_mem_pool_block) entry; /* Entry in block list  */
-    void *mr_handle;                         /* Pointer to MR handle */
-    hg_thread_spin_t chunk_lock;             /* Chunk list lock      */
+    void *mr_handle; /* Pointer to MR handle */
+    size_t size;     /* Size of block        */
+    unsigned int id; /* Block index          */
+    bool huge;       /* Backed by huge pages */
+};
+
+/**
+ * Per-CPU magazine of free chunks. A magazine is owned by whichever thread
+ * manages to acquire it, other threads fall back to the shared free list.
+ */
+struct hg_mem_pool_magazine {
+    HG_UTIL_ALIGNED(hg_atomic_int32_t busy, HG_MEM_CACHE_LINE_SIZE); /* Used */
+    unsigned int count; /* Number of chunks */
+    struct hg_mem_pool_chunk *chunks[HG_MEM_POOL_MAGAZINE_SIZE]; /* Chunks */
 };
 
 /**
  * Memory pool. A pool is composed of multiple blocks.
  */
 struct hg_mem_pool {
+    hg_atomic_int64_t free_head;                   /* Free list head  */
+    struct hg_mem_pool_magazine *magazines;        /* Magazines       */
+    unsigned int magazine_mask;                    /* Magazine mask   */
     hg_thread_mutex_t extend_mutex;                /* Extend mutex    */
     hg_thread_cond_t extend_cond;                  /* Extend cond     */
-    HG_QUEUE_HEAD(hg_mem_pool_block) blocks;       /* Block list      */
+    hg_atomic_int32_t block_count;                 /* Block count     */
     hg_mem_pool_register_func_t register_func;     /* Register func   */
     hg_mem_pool_deregister_func_t deregister_func; /* Deregister func */
-    unsigned long flags;                           /* Optional flags */
+    unsigned long flags;                           /* Optional flags  */
     void *arg;                                     /* Func args       */
     size_t chunk_size;                             /* Chunk size      */
+    size_t chunk_stride;                           /* Chunk stride    */
     size_t chunk_count;                            /* Chunk count     */
     int extending;                                 /* Extending pool  */
-    hg_thread_spin_t block_lock;                   /* Block list lock */
+    struct hg_mem_pool_block *blocks[HG_MEM_POOL_BLOCK_MAX]; /* Blocks */
 };
 
 /********************/
@@ -79,14 +120,48 @@ struct hg_mem_pool {
 
 /* Allocate new pool block */
 static struct hg_mem_pool_block *
-hg_mem_pool_block_alloc(size_t chunk_size, size_t chunk_count,
-    hg_mem_pool_register_func_t register_func, unsigned long flags, void *arg);
+hg_mem_pool_block_alloc(struct hg_mem_pool *hg_mem_pool, unsigned int id);
 
 /* Free pool block */
 static void
 hg_mem_pool_block_free(struct hg_mem_pool_block *hg_mem_pool_block,
     hg_mem_pool_deregister_func_t deregister_func, void *arg);
 
+/* Allocate new block and push its chunks to the free list */
+static int
+hg_mem_pool_extend(struct hg_mem_pool *hg_mem_pool);
+
+/* Get chunk from its ID */
+static HG_UTIL_INLINE struct hg_mem_pool_chunk *
+hg_mem_pool_chunk_get(struct hg_mem_pool *hg_mem_pool, uint32_t id);
+
+/* Pop up to count chunks from free list */
+static unsigned int
+hg_mem_pool_pop(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk **chunks, unsigned int count);
+
+/* Push count chunks to free list */
+static void
+hg_mem_pool_push(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk **chunks, unsigned int count);
+
+/* Push already linked chunks to free list */
+static void
+hg_mem_pool_push_list(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk *first, struct hg_mem_pool_chunk *last);
+
+/* Acquire magazine of current CPU */
+static HG_UTIL_INLINE struct hg_mem_pool_magazine *
+hg_mem_pool_magazine_acquire(struct hg_mem_pool *hg_mem_pool);
+
+/* Release magazine */
+static HG_UTIL_INLINE void
+hg_mem_pool_magazine_release(struct hg_mem_pool_magazine *magazine);
+
+/* Flush chunks of other magazines to free list */
+static void
+hg_mem_pool_magazine_flush(struct hg_mem_pool *hg_mem_pool);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -99,30 +174,58 @@ hg_mem_pool_create(size_t chunk_size, size_t chunk_count, size_t block_count,
     hg_mem_pool_deregister_func_t deregister_func, void *arg)
 {
     struct hg_mem_pool *hg_mem_pool = NULL;
-    size_t i;
+    unsigned int magazine_count = 1, i;
+    long cpu_count = 1;
+
+    HG_UTIL_CHECK_ERROR_NORET(chunk_count == 0 || chunk_count > UINT32_MAX /
+                                                      HG_MEM_POOL_BLOCK_MAX,
+        done, "Invalid chunk count (%zu)", chunk_count);
+    HG_UTIL_CHECK_ERROR_NORET(block_count > HG_MEM_POOL_BLOCK_MAX, done,
+        "Block count (%zu) exceeds max (%d)", block_count,
+        HG_MEM_POOL_BLOCK_MAX);
 
-    hg_mem_pool = (struct hg_mem_pool *) malloc(sizeof(struct hg_mem_pool));
+    hg_mem_pool = (struct hg_mem_pool *) calloc(1, sizeof(struct hg_mem_pool));
     HG_UTIL_CHECK_ERROR_NORET(
         hg_mem_pool == NULL, done, "Could not allocate memory pool");
-    HG_QUEUE_INIT(&hg_mem_pool->blocks);
+    hg_atomic_init64(&hg_mem_pool->free_head, 0);
+    hg_atomic_init32(&hg_mem_pool->block_count, 0);
     hg_mem_pool->register_func = register_func;
     hg_mem_pool->deregister_func = deregister_func;
     hg_mem_pool->flags = flags;
     hg_mem_pool->arg = arg;
     hg_mem_pool->chunk_size = chunk_size;
+    hg_mem_pool->chunk_stride =
+        (offsetof(struct hg_mem_pool_chunk, chunk) + chunk_size +
+            HG_MEM_CACHE_LINE_SIZE - 1) &
+        ~((size_t) HG_MEM_CACHE_LINE_SIZE - 1);
     hg_mem_pool->chunk_count = chunk_count;
     hg_thread_mutex_init(&hg_mem_pool->extend_mutex);
     hg_thread_cond_init(&hg_mem_pool->extend_cond);
-    hg_thread_spin_init(&hg_mem_pool->block_lock);
     hg_mem_pool->extending = 0;
 
-    /* Allocate single block */
+    /* One magazine per CPU */
+#ifdef _SC_NPROCESSORS_CONF
+    cpu_count = sysconf(_SC_NPROCESSORS_CONF);
+#endif
+    while (magazine_count < (unsigned int) cpu_count &&
+           magazine_count < HG_MEM_POOL_MAGAZINE_MAX)
+        magazine_count <<= 1;
+    hg_mem_pool->magazine_mask = magazine_count - 1;
+    hg_mem_pool->magazines = (struct hg_mem_pool_magazine *)
+        hg_mem_aligned_alloc(HG_MEM_CACHE_LINE_SIZE,
+            magazine_count * sizeof(struct hg_mem_pool_magazine));
+    HG_UTIL_CHECK_ERROR_NORET(
+        hg_mem_pool->magazines == NULL, error, "Could not allocate magazines");
+    for (i = 0; i < magazine_count; i++) {
+        hg_mem_pool->magazines[i].count = 0;
+        hg_atomic_init32(&hg_mem_pool->magazines[i].busy, 0);
+    }
+
+    /* Allocate initial blocks */
     for (i = 0; i < block_count; i++) {
-        struct hg_mem_pool_block *hg_mem_pool_block = hg_mem_pool_block_alloc(
-            chunk_size, chunk_count, register_func, flags, arg);
-        HG_UTIL_CHECK_ERROR_NORET(hg_mem_pool_block == NULL, error,
+        int rc = hg_mem_pool_extend(hg_mem_pool);
+        HG_UTIL_CHECK_ERROR_NORET(rc != HG_UTIL_SUCCESS, error,
             "Could not allocate block of %zu bytes", chunk_size * chunk_count);
-        HG_QUEUE_PUSH_TAIL(&hg_mem_pool->blocks, hg_mem_pool_block, entry);
     }
 
 done:
@@ -137,71 +240,106 @@ error:
 void
 hg_mem_pool_destroy(struct hg_mem_pool *hg_mem_pool)
 {
+    int32_t block_count, i;
+
     if (!hg_mem_pool)
         return;
 
-    while (!HG_QUEUE_IS_EMPTY(&hg_mem_pool->blocks)) {
-        struct hg_mem_pool_block *hg_mem_pool_block =
-            HG_QUEUE_FIRST(&hg_mem_pool->blocks);
-        HG_QUEUE_POP_HEAD(&hg_mem_pool->blocks, entry);
-        hg_mem_pool_block_free(
-            hg_mem_pool_block, hg_mem_pool->deregister_func, hg_mem_pool->arg);
-    }
+    block_count = hg_atomic_get32(&hg_mem_pool->block_count);
+    for (i = 0; i < block_count; i++)
+        hg_mem_pool_block_free(hg_mem_pool->blocks[i],
+            hg_mem_pool->deregister_func, hg_mem_pool->arg);
+
+    hg_mem_aligned_free(hg_mem_pool->magazines);
     hg_thread_mutex_destroy(&hg_mem_pool->extend_mutex);
     hg_thread_cond_destroy(&hg_mem_pool->extend_cond);
-    hg_thread_spin_destroy(&hg_mem_pool->block_lock);
     free(hg_mem_pool);
 }
 
 /*---------------------------------------------------------------------------*/
 static struct hg_mem_pool_block *
-hg_mem_pool_block_alloc(size_t chunk_size, size_t chunk_count,
-    hg_mem_pool_register_func_t register_func, unsigned long flags, void *arg)
+hg_mem_pool_block_alloc(struct hg_mem_pool *hg_mem_pool, unsigned int id)
 {
     struct hg_mem_pool_block *hg_mem_pool_block = NULL;
     size_t page_size = (size_t) hg_mem_get_page_size();
+    size_t block_header = (sizeof(struct hg_mem_pool_block) +
+                              HG_MEM_CACHE_LINE_SIZE - 1) &
+                          ~((size_t) HG_MEM_CACHE_LINE_SIZE - 1);
     void *mem_ptr = NULL, *mr_handle = NULL;
+    bool huge = false;
     size_t block_size, i;
-    size_t block_header = sizeof(struct hg_mem_pool_block);
-    size_t chunk_header = offsetof(struct hg_mem_pool_chunk, chunk);
 
-    /* Size of block struct + number of chunks x (chunk_size + size of entry) */
-    block_size = block_header + chunk_count * (chunk_header + chunk_size);
+    /* Size of block struct + number of chunks x chunk stride */
+    block_size =
+        block_header + hg_mem_pool->chunk_count * hg_mem_pool->chunk_stride;
 
-    /* Allocate backend buffer */
-    mem_ptr = hg_mem_aligned_alloc(page_size, block_size);
-    HG_UTIL_CHECK_ERROR_NORET(
-        mem_ptr == NULL, done, "Could not allocate %zu bytes", block_size);
-    memset(mem_ptr, 0, block_size);
+    /* Allocate backend buffer, use huge pages if requested and available */
+    if (hg_mem_pool->flags & HG_MEM_POOL_HUGE_PAGES) {
+        size_t huge_page_size = (size_t) hg_mem_get_hugepage_size();
 
-    /* Register memory if registration function is provided */
-    if (register_func) {
-        int rc = register_func(mem_ptr, block_size, flags, &mr_handle, arg);
-        if (unlikely(rc != HG_UTIL_SUCCESS)) {
-            hg_mem_aligned_free(mem_ptr);
-            HG_UTIL_GOTO_ERROR(done, mem_ptr, NULL, "register_func() failed");
+        if (huge_page_size > 0) {
+            size_t huge_size = (block_size + huge_page_size - 1) &
+                               ~(huge_page_size - 1);
+
+            mem_ptr = hg_mem_huge_alloc(huge_size);
+            if (mem_ptr != NULL) {
+                block_size = huge_size;
+                huge = true;
+            }
         }
+        if (mem_ptr == NULL)
+            HG_UTIL_LOG_WARNING("Could not allocate block of %zu bytes from "
+                                "huge pages, using default pages",
+                block_size);
+    }
+    if (mem_ptr == NULL) {
+        mem_ptr = hg_mem_aligned_alloc(page_size, block_size);
+        HG_UTIL_CHECK_ERROR_NORET(
+            mem_ptr == NULL, error, "Could not allocate %zu bytes", block_size);
+        memset(mem_ptr, 0, block_size);
+    }
+
+    /* Register memory if registration function is provided */
+    if (hg_mem_pool->register_func) {
+        int rc = hg_mem_pool->register_func(mem_ptr, block_size,
+            hg_mem_pool->flags & ~HG_MEM_POOL_HUGE_PAGES, &mr_handle,
+            hg_mem_pool->arg);
+        HG_UTIL_CHECK_ERROR_NORET(
+            rc != HG_UTIL_SUCCESS, error, "register_func() failed");
     }
 
     /* Map allocated memory to block */
     hg_mem_pool_block = (struct hg_mem_pool_block *) mem_ptr;
-
-    HG_QUEUE_INIT(&hg_mem_pool_block->chunks);
-    hg_thread_spin_init(&hg_mem_pool_block->chunk_lock);
     hg_mem_pool_block->mr_handle = mr_handle;
+    hg_mem_pool_block->size = block_size;
+    hg_mem_pool_block->id = id;
+    hg_mem_pool_block->huge = huge;
 
-    /* Assign chunks and insert them to free list */
-    for (i = 0; i < chunk_count; i++) {
+    /* Assign chunks, IDs start at 1 so that 0 marks the end of free list */
+    for (i = 0; i < hg_mem_pool->chunk_count; i++) {
         struct hg_mem_pool_chunk *hg_mem_pool_chunk =
             (struct hg_mem_pool_chunk *) ((char *) hg_mem_pool_block +
                                           block_header +
-                                          i * (chunk_header + chunk_size));
-        HG_QUEUE_PUSH_TAIL(
-            &hg_mem_pool_block->chunks, hg_mem_pool_chunk, entry);
+                                          i * hg_mem_pool->chunk_stride);
+        hg_mem_pool_chunk->block = hg_mem_pool_block;
+        hg_mem_pool_chunk->id =
+            (uint32_t) (id * hg_mem_pool->chunk_count + i + 1);
+        hg_atomic_init32(&hg_mem_pool_chunk->next,
+            (i + 1 < hg_mem_pool->chunk_count)
+                ? (int32_t) (hg_mem_pool_chunk->id + 1)
+                : 0);
     }
 
-done:
     return hg_mem_pool_block;
+
+error:
+    if (mem_ptr != NULL) {
+        if (huge)
+            (void) hg_mem_huge_free(mem_ptr, block_size);
+        else
+            hg_mem_aligned_free(mem_ptr);
+    }
+    return NULL;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -220,17 +358,176 @@ hg_mem_pool_block_free(struct hg_mem_pool_block *hg_mem_pool_block,
     }
 
 done:
-    hg_thread_spin_destroy(&hg_mem_pool_block->chunk_lock);
-    hg_mem_aligned_free((void *) hg_mem_pool_block);
+    if (hg_mem_pool_block->huge)
+        (void) hg_mem_huge_free(
+            (void *) hg_mem_pool_block, hg_mem_pool_block->size);
+    else
+        hg_mem_aligned_free((void *) hg_mem_pool_block);
     return;
 }
 
+/*---------------------------------------------------------------------------*/
+static int
+hg_mem_pool_extend(struct hg_mem_pool *hg_mem_pool)
+{
+    struct hg_mem_pool_block *hg_mem_pool_block;
+    struct hg_mem_pool_chunk *first, *last;
+    int32_t block_count = hg_atomic_get32(&hg_mem_pool->block_count);
+    uint32_t first_id;
+    int ret;
+
+    HG_UTIL_CHECK_ERROR(block_count == HG_MEM_POOL_BLOCK_MAX, done, ret,
+        HG_UTIL_FAIL, "Reached max number of blocks (%d)",
+        HG_MEM_POOL_BLOCK_MAX);
+
+    hg_mem_pool_block =
+        hg_mem_pool_block_alloc(hg_mem_pool, (unsigned int) block_count);
+    HG_UTIL_CHECK_ERROR(hg_mem_pool_block == NULL, done, ret, HG_UTIL_FAIL,
+        "Could not allocate block of %zu bytes",
+        hg_mem_pool->chunk_size * hg_mem_pool->chunk_count);
+
+    /* Publish block before its chunks become visible */
+    hg_mem_pool->blocks[block_count] = hg_mem_pool_block;
+    hg_atomic_set32(&hg_mem_pool->block_count, block_count + 1);
+
+    /* Chunks were linked at block allocation, push them all at once */
+    first_id = (uint32_t) ((size_t) block_count * hg_mem_pool->chunk_count + 1);
+    first = hg_mem_pool_chunk_get(hg_mem_pool, first_id);
+    last = hg_mem_pool_chunk_get(
+        hg_mem_pool, first_id + (uint32_t) hg_mem_pool->chunk_count - 1);
+    hg_mem_pool_push_list(hg_mem_pool, first, last);
+
+    ret = HG_UTIL_SUCCESS;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE struct hg_mem_pool_chunk *
+hg_mem_pool_chunk_get(struct hg_mem_pool *hg_mem_pool, uint32_t id)
+{
+    size_t index = (size_t) (id - 1);
+    size_t block_header = (sizeof(struct hg_mem_pool_block) +
+                              HG_MEM_CACHE_LINE_SIZE - 1) &
+                          ~((size_t) HG_MEM_CACHE_LINE_SIZE - 1);
+
+    return (struct hg_mem_pool_chunk
+            *) ((char *) hg_mem_pool->blocks[index / hg_mem_pool->chunk_count] +
+                block_header +
+                (index % hg_mem_pool->chunk_count) * hg_mem_pool->chunk_stride);
+}
+
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_mem_pool_pop(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk **chunks, unsigned int count)
+{
+    unsigned int i;
+    int64_t head;
+    uint32_t next;
+
+    /* Chunk memory is never released while the pool exists so reading next
+     * IDs is always safe. Nodes that are in the list are never modified, if
+     * the head (and its tag) did not change, the chain that was read is
+     * therefore consistent. */
+    do {
+        head = hg_atomic_get64(&hg_mem_pool->free_head);
+        next = HG_MEM_POOL_HEAD_ID(head);
+        for (i = 0; i < count && next != 0; i++) {
+            chunks[i] = hg_mem_pool_chunk_get(hg_mem_pool, next);
+            next = (uint32_t) hg_atomic_get32(&chunks[i]->next);
+        }
+        if (i == 0)
+            return 0;
+    } while (!hg_atomic_cas64(&hg_mem_pool->free_head, head,
+        HG_MEM_POOL_HEAD(HG_MEM_POOL_HEAD_TAG(head) + 1, next)));
+
+    return i;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_mem_pool_push(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk **chunks, unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 1; i < count; i++)
+        hg_atomic_set32(&chunks[i - 1]->next, (int32_t) chunks[i]->id);
+
+    hg_mem_pool_push_list(hg_mem_pool, chunks[0], chunks[count - 1]);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_mem_pool_push_list(struct hg_mem_pool *hg_mem_pool,
+    struct hg_mem_pool_chunk *first, struct hg_mem_pool_chunk *last)
+{
+    int64_t head;
+
+    do {
+        head = hg_atomic_get64(&hg_mem_pool->free_head);
+        hg_atomic_set32(&last->next, (int32_t) HG_MEM_POOL_HEAD_ID(head));
+    } while (!hg_atomic_cas64(&hg_mem_pool->free_head, head,
+        HG_MEM_POOL_HEAD(HG_MEM_POOL_HEAD_TAG(head) + 1, first->id)));
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE struct hg_mem_pool_magazine *
+hg_mem_pool_magazine_acquire(struct hg_mem_pool *hg_mem_pool)
+{
+    struct hg_mem_pool_magazine *magazine;
+    unsigned int index;
+
+#ifdef HG_UTIL_HAS_SCHED_GETCPU
+    int cpu = sched_getcpu();
+
+    index = (cpu < 0) ? 0 : (unsigned int) cpu;
+#else
+    index = (unsigned int) ((uintptr_t) hg_thread_self() >> 12);
+#endif
+    magazine = &hg_mem_pool->magazines[index & hg_mem_pool->magazine_mask];
+
+    /* Never wait, the thread may have been preempted while holding it */
+    if (hg_atomic_get32(&magazine->busy) ||
+        !hg_atomic_cas32(&magazine->busy, 0, 1))
+        return NULL;
+
+    return magazine;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE void
+hg_mem_pool_magazine_release(struct hg_mem_pool_magazine *magazine)
+{
+    hg_atomic_set32(&magazine->busy, 0);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_mem_pool_magazine_flush(struct hg_mem_pool *hg_mem_pool)
+{
+    unsigned int i;
+
+    for (i = 0; i <= hg_mem_pool->magazine_mask; i++) {
+        struct hg_mem_pool_magazine *magazine = &hg_mem_pool->magazines[i];
+
+        if (!hg_atomic_cas32(&magazine->busy, 0, 1))
+            continue;
+        if (magazine->count > 0) {
+            hg_mem_pool_push(hg_mem_pool, magazine->chunks, magazine->count);
+            magazine->count = 0;
+        }
+        hg_mem_pool_magazine_release(magazine);
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 void *
 hg_mem_pool_alloc(
     struct hg_mem_pool *hg_mem_pool, size_t size, void **mr_handle)
 {
-    struct hg_mem_pool_block *hg_mem_pool_block;
     struct hg_mem_pool_chunk *hg_mem_pool_chunk = NULL;
     void *mem_ptr = NULL;
 
@@ -240,61 +537,55 @@ hg_mem_pool_alloc(
         NULL, "MR handle is NULL");
 
     do {
-        int found = 0;
-
-        /* Check whether we can get a block from one of the pools */
-        hg_thread_spin_lock(&hg_mem_pool->block_lock);
-        HG_QUEUE_FOREACH (hg_mem_pool_block, &hg_mem_pool->blocks, entry) {
-            hg_thread_spin_lock(&hg_mem_pool_block->chunk_lock);
-            found = !HG_QUEUE_IS_EMPTY(&hg_mem_pool_block->chunks);
-            hg_thread_spin_unlock(&hg_mem_pool_block->chunk_lock);
-            if (found)
-                break;
-        }
-        hg_thread_spin_unlock(&hg_mem_pool->block_lock);
+        struct hg_mem_pool_magazine *magazine;
+
+        /* Fast path, take chunk from magazine of current CPU and refill it
+         * from free list when empty */
+        magazine = hg_mem_pool_magazine_acquire(hg_mem_pool);
+        if (magazine != NULL) {
+            if (magazine->count == 0)
+                magazine->count = hg_mem_pool_pop(hg_mem_pool,
+                    magazine->chunks, HG_MEM_POOL_MAGAZINE_SIZE / 2);
+            if (magazine->count > 0)
+                hg_mem_pool_chunk = magazine->chunks[--magazine->count];
+            hg_mem_pool_magazine_release(magazine);
+        } else
+            (void) hg_mem_pool_pop(hg_mem_pool, &hg_mem_pool_chunk, 1);
+        if (hg_mem_pool_chunk != NULL)
+            break;
 
-        /* If not, allocate and register a new pool */
-        if (!found) {
-            /* Let other threads sleep while the pool is being extended */
-            hg_thread_mutex_lock(&hg_mem_pool->extend_mutex);
-            if (hg_mem_pool->extending) {
-                hg_thread_cond_wait(
-                    &hg_mem_pool->extend_cond, &hg_mem_pool->extend_mutex);
-                hg_thread_mutex_unlock(&hg_mem_pool->extend_mutex);
-                continue;
-            }
-            hg_mem_pool->extending = 1;
+        /* Let other threads sleep while the pool is being extended */
+        hg_thread_mutex_lock(&hg_mem_pool->extend_mutex);
+        if (hg_mem_pool->extending) {
+            hg_thread_cond_wait(
+                &hg_mem_pool->extend_cond, &hg_mem_pool->extend_mutex);
             hg_thread_mutex_unlock(&hg_mem_pool->extend_mutex);
-
-            hg_mem_pool_block = hg_mem_pool_block_alloc(hg_mem_pool->chunk_size,
-                hg_mem_pool->chunk_count, hg_mem_pool->register_func,
-                hg_mem_pool->flags, hg_mem_pool->arg);
-            HG_UTIL_CHECK_ERROR(hg_mem_pool_block == NULL, done, mem_ptr, NULL,
-                "Could not allocate block of %zu bytes",
-                hg_mem_pool->chunk_size * hg_mem_pool->chunk_count);
-
-            hg_thread_spin_lock(&hg_mem_pool->block_lock);
-            HG_QUEUE_PUSH_TAIL(&hg_mem_pool->blocks, hg_mem_pool_block, entry);
-            hg_thread_spin_unlock(&hg_mem_pool->block_lock);
-
+            continue;
+        }
+        hg_mem_pool->extending = 1;
+        hg_thread_mutex_unlock(&hg_mem_pool->extend_mutex);
+
+        /* Reclaim chunks cached by other CPUs before allocating a new block */
+        hg_mem_pool_magazine_flush(hg_mem_pool);
+        if (HG_MEM_POOL_HEAD_ID(hg_atomic_get64(&hg_mem_pool->free_head)) ==
+                0 &&
+            hg_mem_pool_extend(hg_mem_pool) != HG_UTIL_SUCCESS) {
             hg_thread_mutex_lock(&hg_mem_pool->extend_mutex);
             hg_mem_pool->extending = 0;
             hg_thread_cond_broadcast(&hg_mem_pool->extend_cond);
             hg_thread_mutex_unlock(&hg_mem_pool->extend_mutex);
+            HG_UTIL_GOTO_ERROR(done, mem_ptr, NULL, "Could not extend pool");
         }
 
-        /* Try to pick a node from one of the available pools */
-        hg_thread_spin_lock(&hg_mem_pool_block->chunk_lock);
-        if (!HG_QUEUE_IS_EMPTY(&hg_mem_pool_block->chunks)) {
-            hg_mem_pool_chunk = HG_QUEUE_FIRST(&hg_mem_pool_block->chunks);
-            HG_QUEUE_POP_HEAD(&hg_mem_pool_block->chunks, entry);
-        }
-        hg_thread_spin_unlock(&hg_mem_pool_block->chunk_lock);
-    } while (!hg_mem_pool_chunk);
+        hg_thread_mutex_lock(&hg_mem_pool->extend_mutex);
+        hg_mem_pool->extending = 0;
+        hg_thread_cond_broadcast(&hg_mem_pool->extend_cond);
+        hg_thread_mutex_unlock(&hg_mem_pool->extend_mutex);
+    } while (hg_mem_pool_chunk == NULL);
 
-    mem_ptr = &hg_mem_pool_chunk->chunk;
-    if (mr_handle && hg_mem_pool_block)
-        *mr_handle = hg_mem_pool_block->mr_handle;
+    mem_ptr = hg_mem_pool_chunk->chunk;
+    if (mr_handle)
+        *mr_handle = hg_mem_pool_chunk->block->mr_handle;
 
 done:
     return mem_ptr;
@@ -305,32 +596,31 @@ void
 hg_mem_pool_free(
     struct hg_mem_pool *hg_mem_pool, void *mem_ptr, void *mr_handle)
 {
-    struct hg_mem_pool_block *hg_mem_pool_block;
-    int found = 0;
+    struct hg_mem_pool_chunk *hg_mem_pool_chunk;
+    struct hg_mem_pool_magazine *magazine;
 
     if (!mem_ptr)
         return;
 
-    /* Put the node back to the pool */
-    hg_thread_spin_lock(&hg_mem_pool->block_lock);
-    HG_QUEUE_FOREACH (hg_mem_pool_block, &hg_mem_pool->blocks, entry) {
-        /* If MR handle is NULL, it does not really matter which pool we push
-         * the node back to.
-         */
-        if (hg_mem_pool_block->mr_handle == mr_handle) {
-            struct hg_mem_pool_chunk *hg_mem_pool_chunk =
-                container_of(mem_ptr, struct hg_mem_pool_chunk, chunk);
-            hg_thread_spin_lock(&hg_mem_pool_block->chunk_lock);
-            HG_QUEUE_PUSH_TAIL(
-                &hg_mem_pool_block->chunks, hg_mem_pool_chunk, entry);
-            hg_thread_spin_unlock(&hg_mem_pool_block->chunk_lock);
-            found = 1;
-            break;
-        }
+    /* Block is directly retrieved from chunk header */
+    hg_mem_pool_chunk = container_of(mem_ptr, struct hg_mem_pool_chunk, chunk);
+    HG_UTIL_CHECK_WARNING(hg_mem_pool_chunk->block->mr_handle != mr_handle,
+        "MR handle does not match memory block");
+
+    magazine = hg_mem_pool_magazine_acquire(hg_mem_pool);
+    if (magazine == NULL) {
+        hg_mem_pool_push(hg_mem_pool, &hg_mem_pool_chunk, 1);
+        return;
     }
-    hg_thread_spin_unlock(&hg_mem_pool->block_lock);
 
-    HG_UTIL_CHECK_WARNING(found != 1, "Memory block was not found");
+    /* Return half of the magazine to free list when full */
+    if (magazine->count == HG_MEM_POOL_MAGAZINE_SIZE) {
+        magazine->count -= HG_MEM_POOL_MAGAZINE_SIZE / 2;
+        hg_mem_pool_push(hg_mem_pool, &magazine->chunks[magazine->count],
+            HG_MEM_POOL_MAGAZINE_SIZE / 2);
+    }
+    magazine->chunks[magazine->count++] = hg_mem_pool_chunk;
+    hg_mem_pool_magazine_release(magazine);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -338,13 +628,11 @@ size_t
 hg_mem_pool_chunk_offset(
     struct hg_mem_pool *hg_mem_pool, void *mem_ptr, void *mr_handle)
 {
-    struct hg_mem_pool_block *hg_mem_pool_block;
+    struct hg_mem_pool_chunk *hg_mem_pool_chunk =
+        container_of(mem_ptr, struct hg_mem_pool_chunk, chunk);
 
-    hg_thread_spin_lock(&hg_mem_pool->block_lock);
-    HG_QUEUE_FOREACH (hg_mem_pool_block, &hg_mem_pool->blocks, entry)
-        if (hg_mem_pool_block->mr_handle == mr_handle)
-            break;
-    hg_thread_spin_unlock(&hg_mem_pool->block_lock);
+    (void) hg_mem_pool;
+    (void) mr_handle;
 
-    return (size_t) ((char *) mem_ptr - (char *) hg_mem_pool_block);
+    return (size_t) ((char *) mem_ptr - (char *) hg_mem_pool_chunk->block);
 }
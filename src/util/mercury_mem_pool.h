@@ -42,6 +42,10 @@ typedef int (*hg_mem_pool_deregister_func_t)(void *handle, void *arg);
 /* Public Macros */
 /*****************/
 
+/* Back memory blocks with huge pages when available (this flag is not passed
+ * to register functions) */
+#define HG_MEM_POOL_HUGE_PAGES (1UL << (sizeof(unsigned long) * 8 - 1))
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -53,7 +57,11 @@ extern "C" {
 /**
  * Create a memory pool with \block_count of size \chunk_count x \chunk_size
  * bytes. Optionally register and deregister memory for each block using
- * \register_func and \deregister_func respectively.
+ * \register_func and \deregister_func respectively. Chunks are cached per CPU
+ * and allocating or releasing a chunk does not take any lock unless the pool
+ * must be extended. Passing HG_MEM_POOL_HUGE_PAGES in \flags allocates
+ * blocks from huge pages, falling back to default pages if none are
+ * available.
  *
  * \param chunk_size [IN]       size of chunks
  * \param chunk_count [IN]      number of chunks